@@ -35,6 +35,7 @@
 #include "MeasureUpdateCommand.hpp"
 #include "MeasureManager.hpp"
 
+#include "../utilities/core/Checksum.hpp"
 #include "../utilities/core/Filesystem.hpp"
 #include "../utilities/bcl/BCLMeasure.hpp"
 #include "../scriptengine/ScriptEngine.hpp"
@@ -334,6 +335,18 @@ $ openstudio measure new --list-for-first-taxonomy-tag HVAC
         }
       }
       fmt::print("Found {} measure directories to update\n", subDirPaths.size());
+
+      // checksum the files of all the measures across threads up front, getMeasure then finds them in the checksum cache
+      std::vector<openstudio::path> filePaths;
+      for (const auto& subDirPath : subDirPaths) {
+        if (auto measure_ = BCLMeasure::load(subDirPath)) {
+          for (const BCLFileReference& file : measure_->files()) {
+            filePaths.push_back(file.path());
+          }
+        }
+      }
+      openstudio::cachedChecksums(filePaths);
+
       for (const auto& subDirPath : subDirPaths) {
         measureManager.getMeasure(subDirPath, true);
       }
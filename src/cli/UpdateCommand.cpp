@@ -19,34 +19,37 @@
 namespace openstudio {
 namespace cli {
 
-  bool runModelUpdateCommand(const openstudio::path& p, bool keep) {
-    std::vector<openstudio::path> osmPaths;
-
-    openstudio::osversion::VersionTranslator vt;
+  bool runModelUpdateCommand(const openstudio::path& p, bool keep, unsigned numThreads) {
+    std::vector<openstudio::path> relPaths;
 
     if (openstudio::filesystem::is_directory(p)) {
       for (auto const& dir_entry : boost::filesystem::directory_iterator{p}) {
         const auto& thePath = dir_entry.path();
         if (openstudio::filesystem::is_regular_file(thePath) && thePath.extension() == ".osm") {
-          osmPaths.emplace_back(thePath);
+          relPaths.emplace_back(thePath);
         }
       }
     } else {
-      osmPaths.push_back(p);
+      relPaths.push_back(p);
+    }
+
+    std::vector<openstudio::path> osmPaths;
+    osmPaths.reserve(relPaths.size());
+    for (const auto& relPath : relPaths) {
+      osmPaths.push_back(openstudio::filesystem::system_complete(relPath));
     }
 
+    // updateFiles makes one call at a time, so lines from several workers do not interleave
+    auto fileStarted = [&relPaths](size_t i) { fmt::print("'{}'\n", relPaths[i].string()); };
+
     bool result = true;
-    for (const auto& relPath : osmPaths) {
-      fmt::print("'{}'\n", relPath.string());
-      auto osmPath = openstudio::filesystem::system_complete(relPath);
-      if (keep) {
-        openstudio::path backupPath = osmPath;
-        backupPath.replace_extension(openstudio::toPath(".osm.orig"));
-        openstudio::filesystem::copy_file(osmPath, backupPath, openstudio::filesystem::copy_options::overwrite_existing);
+    for (const auto& fileResult : openstudio::osversion::VersionTranslator::updateFiles(osmPaths, numThreads, keep, fileStarted)) {
+      const auto& osmPath = fileResult.path();
+      for (const auto& logMessage : fileResult.errors()) {
+        fmt::print(stderr, "'{}': {}\n", osmPath.string(), logMessage.logMessage());
       }
-      if (auto model_ = vt.loadModel(osmPath)) {
+      if (fileResult.success()) {
         fmt::print("Updated '{}'\n", osmPath.string());
-        model_->save(osmPath, true);
       } else {
         fmt::print("Could not read model at '{}'\n", osmPath.string());
         result = false;
@@ -15,7 +15,7 @@ class ScriptEngineInstance;
 
 namespace cli {
 
-  bool runModelUpdateCommand(const openstudio::path& p, bool keep);
+  bool runModelUpdateCommand(const openstudio::path& p, bool keep, unsigned numThreads = 1);
 
   void executeRubyScriptCommand(openstudio::path rubyScriptPath, ScriptEngineInstance& rubyEngine, const std::vector<std::string>& arguments);
   void executePythonScriptCommand(openstudio::path pythonScriptPath, ScriptEngineInstance& pythonEngine, const std::vector<std::string>& arguments);
@@ -288,11 +288,14 @@ int main(int argc, char* argv[]) {
       auto* updateCommand = app.add_subcommand("update", "Updates OpenStudio Models to the current version");
       updateCommand->add_flag("-k,--keep", keep, "Keep original files");
 
+      unsigned jobs = 1;
+      updateCommand->add_option("-j,--jobs", jobs, "Number of models to update at once, 0 uses one per hardware thread")->capture_default_str();
+
       openstudio::filesystem::path updateOsmPath;
       updateCommand->add_option("path", updateOsmPath, "Path to OSM or directory containing osms")->required(true);
 
-      updateCommand->callback([&keep, &updateOsmPath] {
-        if (!openstudio::cli::runModelUpdateCommand(updateOsmPath, keep)) {
+      updateCommand->callback([&keep, &jobs, &updateOsmPath] {
+        if (!openstudio::cli::runModelUpdateCommand(updateOsmPath, keep, jobs)) {
           throw std::runtime_error("Failed to update some models");
         }
       });
@@ -46,7 +46,14 @@
 %ignore ForwardTranslatorInitializer;
 %ignore openstudio::energyplus::detail::ForwardTranslatorInitializer;
 
+// std::function is not wrapped
+%ignore openstudio::energyplus::ErrorFileParser;
+
+// std::ostream is not wrapped
+%ignore openstudio::energyplus::ForwardTranslator::translateModelToStream;
+
 %include <energyplus/ErrorFile.hpp>
+%template(ErrorFileMessageVector) std::vector<openstudio::energyplus::ErrorFileMessage>;
 %include <energyplus/ForwardTranslator.hpp>
 %include <energyplus/ReverseTranslator.hpp>
 
@@ -5,135 +5,375 @@
 
 #include "ErrorFile.hpp"
 
-#include <boost/regex.hpp>
-#include <boost/algorithm/string.hpp>
+#include "../utilities/core/Compare.hpp"
+
+#include <boost/optional.hpp>
+
+#include <cstring>
 
 namespace openstudio {
 namespace energyplus {
 
-  /// constructor
-  ErrorFile::ErrorFile(const openstudio::path& errPath) : m_completed(false), m_completedSuccessfully(false) {
-    openstudio::filesystem::ifstream ifs(errPath);
-    parse(ifs);
-    ifs.close();
+  namespace {
+
+    // same characters as \s
+    bool isSpace(char c) {
+      return (c == ' ') || (c == '\t') || (c == '\n') || (c == '\v') || (c == '\f') || (c == '\r');
+    }
+
+    // same characters as [[:alpha:]] in the C locale
+    bool isAlpha(char c) {
+      return ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z'));
+    }
+
+    size_t skipSpaces(std::string_view line, size_t pos) {
+      while ((pos < line.size()) && isSpace(line[pos])) {
+        ++pos;
+      }
+      return pos;
+    }
+
+    size_t skipStars(std::string_view line, size_t pos) {
+      while ((pos < line.size()) && (line[pos] == '*')) {
+        ++pos;
+      }
+      return pos;
+    }
+
+    bool startsWith(std::string_view line, size_t pos, std::string_view prefix) {
+      return (pos <= line.size()) && (line.substr(pos, prefix.size()) == prefix);
+    }
+
+    std::string_view trimRight(std::string_view text) {
+      while (!text.empty() && isSpace(text.back())) {
+        text.remove_suffix(1);
+      }
+      return text;
+    }
+
+    std::string_view trim(std::string_view text) {
+      text = trimRight(text);
+      while (!text.empty() && isSpace(text.front())) {
+        text.remove_prefix(1);
+      }
+      return text;
+    }
+
+    // every line of a warning or error starts with \s*\**\s+\*\* e.g. "   ** Warning **" or "   **   ~~~   **"
+    // the leading spaces either come before the "**" or a run of stars does, returns the positions just after the "**"
+    // at most two candidates, npos if there is no such candidate
+    std::pair<size_t, size_t> messagePrefixEnds(std::string_view line) {
+      std::pair<size_t, size_t> result(std::string_view::npos, std::string_view::npos);
+      const size_t spacesEnd = skipSpaces(line, 0);
+      if ((spacesEnd > 0) && startsWith(line, spacesEnd, "**")) {
+        result.first = spacesEnd + 2;
+      }
+      const size_t starsEnd = skipStars(line, spacesEnd);
+      if (starsEnd > spacesEnd) {
+        const size_t pos = skipSpaces(line, starsEnd);
+        if ((pos > starsEnd) && startsWith(line, pos, "**")) {
+          result.second = pos + 2;
+        }
+      }
+      return result;
+    }
+
+    // first line of a warning or error, e.g. "   ** Warning ** rest of line"
+    bool matchMessageStart(std::string_view line, size_t pos, std::string_view& type, std::string_view& rest) {
+      if (pos == std::string_view::npos) {
+        return false;
+      }
+      const size_t typeBegin = skipSpaces(line, pos);
+      size_t typeEnd = typeBegin;
+      while ((typeEnd < line.size()) && isAlpha(line[typeEnd])) {
+        ++typeEnd;
+      }
+      if (typeEnd == typeBegin) {
+        return false;
+      }
+      const size_t starsBegin = skipSpaces(line, typeEnd);
+      if (!startsWith(line, starsBegin, "**")) {
+        return false;
+      }
+      type = line.substr(typeBegin, typeEnd - typeBegin);
+      rest = line.substr(starsBegin + 2);
+      return true;
+    }
+
+    // continuation of a warning or error, e.g. "   **   ~~~   ** rest of line"
+    bool matchMessageContinue(std::string_view line, size_t pos, std::string_view& rest) {
+      if (pos == std::string_view::npos) {
+        return false;
+      }
+      const size_t tildesBegin = skipSpaces(line, pos);
+      if (!startsWith(line, tildesBegin, "~~~")) {
+        return false;
+      }
+      const size_t starsBegin = skipSpaces(line, tildesBegin + 3);
+      if (!startsWith(line, starsBegin, "**")) {
+        return false;
+      }
+      rest = line.substr(starsBegin + 2);
+      return true;
+    }
+
+    // \s*\*+ followed by text, e.g. "   ************* EnergyPlus Completed Successfully"
+    bool matchStarredLine(std::string_view line, std::string_view& text) {
+      const size_t starsBegin = skipSpaces(line, 0);
+      const size_t starsEnd = skipStars(line, starsBegin);
+      if ((starsEnd == starsBegin) || !startsWith(line, starsEnd, " ")) {
+        return false;
+      }
+      text = line.substr(starsEnd + 1);
+      return true;
+    }
+
+    bool isCompletedSuccessfully(std::string_view text) {
+      if (startsWith(text, 0, "EnergyPlus Completed Successfully")) {
+        return true;
+      }
+      // GroundTempCalc\S* Completed Successfully
+      if (startsWith(text, 0, "GroundTempCalc")) {
+        size_t pos = std::strlen("GroundTempCalc");
+        while ((pos < text.size()) && !isSpace(text[pos])) {
+          ++pos;
+        }
+        return startsWith(text, pos, " Completed Successfully");
+      }
+      return false;
+    }
+
+    bool isTerminated(std::string_view text) {
+      return startsWith(text, 0, "EnergyPlus Terminated");
+    }
+
+    boost::optional<ErrorLevel> errorLevel(const std::string& type) {
+      if (istringEqual(type, "Warning")) {
+        return ErrorLevel(ErrorLevel::Warning);
+      } else if (istringEqual(type, "Severe")) {
+        return ErrorLevel(ErrorLevel::Severe);
+      } else if (istringEqual(type, "Fatal")) {
+        return ErrorLevel(ErrorLevel::Fatal);
+      }
+      return boost::none;
+    }
+
+  }  // namespace
+
+  ErrorFileMessage::ErrorFileMessage(const ErrorLevel& level, const std::string& message, unsigned lineNumber)
+    : level(level), message(message), count(1), firstLine(lineNumber), lastLine(lineNumber) {}
+
+  ErrorFileParser::ErrorFileParser(Callback callback)
+    : m_callback(std::move(callback)),
+      m_offset(0),
+      m_numLines(0),
+      m_completed(false),
+      m_completedSuccessfully(false),
+      m_hasPending(false),
+      m_pendingLine(0) {}
+
+  void ErrorFileParser::parse(const char* data, size_t size) {
+    const char* end = data + size;
+    while ((data < end) && !m_completed) {
+      const auto* newline = static_cast<const char*>(std::memchr(data, '\n', end - data));
+      if (newline == nullptr) {
+        m_partialLine.append(data, end);
+        break;
+      }
+      if (m_partialLine.empty()) {
+        parseLine(std::string_view(data, newline - data));
+      } else {
+        m_partialLine.append(data, newline);
+        parseLine(m_partialLine);
+        m_partialLine.clear();
+      }
+      data = newline + 1;
+    }
   }
 
-  /// get warnings
-  std::vector<std::string> ErrorFile::warnings() const {
-    return m_warnings;
+  void ErrorFileParser::parse(const std::string& text) {
+    parse(text.data(), text.size());
   }
 
-  /// get severe errors
-  std::vector<std::string> ErrorFile::severeErrors() const {
-    return m_severeErrors;
+  bool ErrorFileParser::update(const openstudio::path& errPath) {
+    openstudio::filesystem::ifstream ifs(errPath, std::ios_base::in | std::ios_base::binary);
+    if (!ifs.is_open()) {
+      return false;
+    }
+    ifs.seekg(static_cast<std::streamoff>(m_offset));
+    if (!ifs) {
+      return false;
+    }
+
+    std::vector<char> buffer(1 << 16);
+    while (!m_completed) {
+      ifs.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+      const std::streamsize numRead = ifs.gcount();
+      if (numRead <= 0) {
+        break;
+      }
+      m_offset += static_cast<std::uintmax_t>(numRead);
+      parse(buffer.data(), static_cast<size_t>(numRead));
+    }
+    return true;
   }
 
-  /// get fatal errors
-  std::vector<std::string> ErrorFile::fatalErrors() const {
-    return m_fatalErrors;
+  void ErrorFileParser::finish() {
+    if (!m_partialLine.empty() && !m_completed) {
+      std::string line;
+      std::swap(line, m_partialLine);
+      parseLine(line);
+    }
+    m_partialLine.clear();
+    flushPending();
   }
 
-  /// did EnergyPlus complete or crash
-  bool ErrorFile::completed() const {
+  bool ErrorFileParser::completed() const {
     return m_completed;
   }
 
-  /// completed successfully
-  bool ErrorFile::completedSuccessfully() const {
+  bool ErrorFileParser::completedSuccessfully() const {
     return m_completedSuccessfully;
   }
 
-  void ErrorFile::parse(openstudio::filesystem::ifstream& is) {
-    std::string line;
+  unsigned ErrorFileParser::numLines() const {
+    return m_numLines;
+  }
 
-    // matches[1], warning/error type
-    // matches[2], rest of line
-    boost::regex warningOrError(R"(^\s*\**\s+\*\*\s*([[:alpha:]]+)\s*\*\*(.*)$)");
+  const std::vector<ErrorFileMessage>& ErrorFileParser::messages() const {
+    return m_messages;
+  }
 
-    // matches[1], rest of line
-    boost::regex warningOrErrorContinue(R"(^\s*\**\s+\*\*\s*~~~\s*\*\*(.*)$)");
+  void ErrorFileParser::parseLine(std::string_view line) {
+    ++m_numLines;
 
-    // completed successfully
-    boost::regex completedSuccessful(R"(^\s*\*+ EnergyPlus Completed Successfully.*)");
+    // getline would keep the carriage return of CRLF files, it is never part of a message
+    if (!line.empty() && (line.back() == '\r')) {
+      line.remove_suffix(1);
+    }
 
-    // ground temp completed successfully
-    boost::regex groundTempCompletedSuccessful(R"(^\s*\*+ GroundTempCalc\S* Completed Successfully.*)");
+    const std::pair<size_t, size_t> prefixEnds = messagePrefixEnds(line);
+    std::string_view type;
+    std::string_view rest;
 
-    // completed unsuccessfully
-    boost::regex completedUnsuccessful(R"(^\s*\*+ EnergyPlus Terminated.*)");
+    if (m_hasPending) {
+      if (matchMessageContinue(line, prefixEnds.first, rest) || matchMessageContinue(line, prefixEnds.second, rest)) {
+        m_pendingMessage += '\n';
+        m_pendingMessage.append(trimRight(rest));
+        return;
+      }
+      flushPending();
+    }
 
-    // repeat count
+    if (matchMessageStart(line, prefixEnds.first, type, rest) || matchMessageStart(line, prefixEnds.second, type, rest)) {
+      m_hasPending = true;
+      m_pendingType.assign(type);
+      m_pendingMessage.assign(trim(rest));
+      m_pendingLine = m_numLines;
+      return;
+    }
 
-    // read the file line by line using regexes
-    bool alreadyGotLine = false;
+    std::string_view text;
+    if (matchStarredLine(line, text)) {
+      if (isCompletedSuccessfully(text)) {
+        m_completed = true;
+        m_completedSuccessfully = true;
+      } else if (isTerminated(text)) {
+        m_completed = true;
+        m_completedSuccessfully = false;
+      }
+    }
+  }
 
-    while (alreadyGotLine || std::getline(is, line)) {
+  void ErrorFileParser::flushPending() {
+    if (!m_hasPending) {
+      return;
+    }
+    m_hasPending = false;
 
-      alreadyGotLine = false;
-      boost::smatch matches;
+    boost::optional<ErrorLevel> level = errorLevel(m_pendingType);
+    if (!level) {
+      LOG(Error, "Unknown warning or error level '" << m_pendingType << "' on line " << m_pendingLine);
+      return;
+    }
 
-      // LOG(Trace, "Parsing ErrorFile Line '" << line << "'");
+    // recurring warnings and errors only differ by the numbers in them, e.g. values, times and object name suffixes
+    std::string key = level->valueName();
+    key += ':';
+    bool inNumber = false;
+    for (char c : m_pendingMessage) {
+      const bool isDigit = (c >= '0') && (c <= '9');
+      if (!isDigit) {
+        key += c;
+      } else if (!inNumber) {
+        key += '#';
+      }
+      inNumber = isDigit;
+    }
+    auto [it, inserted] = m_messageIndices.try_emplace(std::move(key), m_messages.size());
+    if (inserted) {
+      m_messages.emplace_back(*level, m_pendingMessage, m_pendingLine);
+    } else {
+      ErrorFileMessage& message = m_messages[it->second];
+      ++message.count;
+      message.lastLine = m_pendingLine;
+    }
 
-      // parse the file
-      if (boost::regex_search(line, matches, warningOrError)) {
+    if (m_callback) {
+      m_callback(*level, m_pendingMessage, m_pendingLine);
+    }
+  }
 
-        std::string warningOrErrorType = std::string(matches[1].first, matches[1].second);
-        boost::trim(warningOrErrorType);
-        std::string warningOrErrorString = std::string(matches[2].first, matches[2].second);
-        boost::trim(warningOrErrorString);
+  /// constructor
+  ErrorFile::ErrorFile(const openstudio::path& errPath) : m_completed(false), m_completedSuccessfully(false) {
+    ErrorFileParser parser([this](const ErrorLevel& level, const std::string& message, unsigned /*lineNumber*/) {
+      switch (level.value()) {
+        case ErrorLevel::Warning:
+          m_warnings.push_back(message);
+          break;
+        case ErrorLevel::Severe:
+          m_severeErrors.push_back(message);
+          break;
+        case ErrorLevel::Fatal:
+          m_fatalErrors.push_back(message);
+          break;
+      }
+    });
+    parser.update(errPath);
+    parser.finish();
 
-        // read the rest of the multi line warning or error
-        while (true) {
-          // std::streampos pos = is.tellg();
-          if (!std::getline(is, line)) {
-            break;
-          }
-          if (boost::regex_search(line, matches, warningOrErrorContinue)) {
-            std::string temp = std::string(matches[1].first, matches[1].second);
-            boost::trim_right(temp);
-            warningOrErrorString += "\n" + temp;
-          } else {
-            // unget the line
-            // is.seekg(pos);
-            // Instead of rewind then reread (which fails on Windows if you have LF line endings)
-            // We just use this bool to avoid having to re-read the line.
-            alreadyGotLine = true;
-            break;
-          }
-        }
+    m_messages = parser.messages();
+    m_completed = parser.completed();
+    m_completedSuccessfully = parser.completedSuccessfully();
+  }
 
-        // LOG(Trace, "Error parsed: " << warningOrErrorString);
-
-        // correctly sort warnings and errors
-        try {
-          ErrorLevel level(warningOrErrorType);
-
-          switch (level.value()) {
-            case ErrorLevel::Warning:
-              m_warnings.push_back(warningOrErrorString);
-              break;
-            case ErrorLevel::Severe:
-              m_severeErrors.push_back(warningOrErrorString);
-              break;
-            case ErrorLevel::Fatal:
-              m_fatalErrors.push_back(warningOrErrorString);
-              break;
-          }
-
-        } catch (...) {
-          LOG(Error, "Unknown warning or error level '" << warningOrErrorType << "' for line '" << line << "'");
-        }
+  /// get warnings
+  std::vector<std::string> ErrorFile::warnings() const {
+    return m_warnings;
+  }
 
-      } else if (boost::regex_match(line, completedSuccessful) || boost::regex_match(line, groundTempCompletedSuccessful)) {
-        m_completed = true;
-        m_completedSuccessfully = true;
-        break;
-      } else if (boost::regex_match(line, completedUnsuccessful)) {
-        m_completed = true;
-        m_completedSuccessfully = false;
-        break;
-      }
-    }
+  /// get severe errors
+  std::vector<std::string> ErrorFile::severeErrors() const {
+    return m_severeErrors;
+  }
+
+  /// get fatal errors
+  std::vector<std::string> ErrorFile::fatalErrors() const {
+    return m_fatalErrors;
+  }
+
+  /// did EnergyPlus complete or crash
+  bool ErrorFile::completed() const {
+    return m_completed;
+  }
+
+  /// completed successfully
+  bool ErrorFile::completedSuccessfully() const {
+    return m_completedSuccessfully;
+  }
+
+  std::vector<ErrorFileMessage> ErrorFile::messages() const {
+    return m_messages;
   }
 
 }  // namespace energyplus
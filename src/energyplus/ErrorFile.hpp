@@ -12,7 +12,11 @@
 #include "../utilities/core/Enum.hpp"
 #include "../utilities/core/Logger.hpp"
 
+#include <cstdint>
+#include <functional>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace openstudio {
@@ -30,6 +34,77 @@ namespace energyplus {
 
   // clang-format on
 
+  /** A warning or error from the err file. Recurring messages, i.e. with the same level and the same text once numbers are
+   *  ignored, are counted together and message is the full text of the first occurrence. Line numbers are 1-based. */
+  struct ENERGYPLUS_API ErrorFileMessage
+  {
+    ErrorFileMessage(const ErrorLevel& level, const std::string& message, unsigned lineNumber);
+
+    ErrorLevel level;
+    std::string message;
+    unsigned count;
+    unsigned firstLine;
+    unsigned lastLine;
+  };
+
+  /** Incremental parser for eplusout.err. Each line is classified by hand rather than with regular expressions. A warning or
+   *  error is passed to the callback as soon as the following line shows that it is complete. Text can be fed in chunks of
+   *  any size, and update() reads whatever has been appended to a file since the previous call, so an err file can be
+   *  followed while EnergyPlus is still writing it. */
+  class ENERGYPLUS_API ErrorFileParser
+  {
+   public:
+    /// called with the level, full text and first line number of each warning or error, in file order
+    using Callback = std::function<void(const ErrorLevel& level, const std::string& message, unsigned lineNumber)>;
+
+    explicit ErrorFileParser(Callback callback = Callback());
+
+    /// parse the next chunk of the file, an incomplete last line is kept until more text arrives
+    void parse(const char* data, size_t size);
+
+    void parse(const std::string& text);
+
+    /// parse everything appended to errPath since the last call, returns false if the file cannot be read
+    bool update(const openstudio::path& errPath);
+
+    /// parse any incomplete last line and report the pending warning or error, call once the file is complete
+    void finish();
+
+    /// did EnergyPlus complete or crash, text after the completion line is ignored
+    bool completed() const;
+
+    /// completed successfully
+    bool completedSuccessfully() const;
+
+    /// number of lines parsed so far
+    unsigned numLines() const;
+
+    /// warnings and errors parsed so far, in order of first occurrence
+    const std::vector<ErrorFileMessage>& messages() const;
+
+   private:
+    REGISTER_LOGGER("energyplus.ErrorFileParser");
+
+    void parseLine(std::string_view line);
+
+    void flushPending();
+
+    Callback m_callback;
+    std::string m_partialLine;
+    std::uintmax_t m_offset;
+    unsigned m_numLines;
+    bool m_completed;
+    bool m_completedSuccessfully;
+
+    bool m_hasPending;
+    std::string m_pendingType;
+    std::string m_pendingMessage;
+    unsigned m_pendingLine;
+
+    std::vector<ErrorFileMessage> m_messages;
+    std::unordered_map<std::string, size_t> m_messageIndices;
+  };
+
   class ENERGYPLUS_API ErrorFile
   {
    public:
@@ -51,11 +126,13 @@ namespace energyplus {
     /// completed successfully
     bool completedSuccessfully() const;
 
+    /// warnings and errors with recurring ones counted together, in order of first occurrence
+    std::vector<ErrorFileMessage> messages() const;
+
    private:
     REGISTER_LOGGER("energyplus.ErrorFile");
 
-    void parse(openstudio::filesystem::ifstream& is);
-
+    std::vector<ErrorFileMessage> m_messages;
     std::vector<std::string> m_warnings;
     std::vector<std::string> m_severeErrors;
     std::vector<std::string> m_fatalErrors;
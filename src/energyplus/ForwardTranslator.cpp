@@ -55,9 +55,11 @@
 #include "../utilities/idf/IdfExtensibleGroup.hpp"
 #include "../utilities/idf/IdfFile.hpp"
 #include "../utilities/idf/WorkspaceObjectOrder.hpp"
+#include "../utilities/idd/IddFieldProperties.hpp"
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/FilesystemHelpers.hpp"
+#include "../utilities/core/UUID.hpp"
 #include "../utilities/geometry/BoundingBox.hpp"
 #include "../utilities/time/Time.hpp"
 #include "../utilities/plot/ProgressBar.hpp"
@@ -76,12 +78,15 @@
 
 #include "../utilities/idd/IddEnums.hpp"
 
+#include "../utilities/core/Compare.hpp"
 #include "../utilities/core/Deprecated.hpp"
 
 #include <algorithm>
 #include <iterator>
+#include <set>
 #include <sstream>
 #include <thread>
+#include <unordered_map>
 
 using namespace openstudio::model;
 
@@ -110,15 +115,35 @@ namespace energyplus {
 
     // When m_forwardTranslatorOptions.excludeSpaceTranslation() is false, could we skip the (expensive) clone since we aren't combining spaces?
     // No, we are still doing stuff like removing orphan loads, spaces not part of a thermal zone, etc
+    // Callers that no longer need the model can use translateModelInPlace to skip the clone
     auto modelCopy = model.clone(true).cast<Model>();
 
+    return translateModelInPlace(modelCopy, progressBar);
+  }
+
+  Workspace ForwardTranslator::translateModelInPlace(Model& model, ProgressBar* progressBar) {
+
+    m_progressBar = progressBar;
+    if (m_progressBar) {
+      m_progressBar->setMinimum(0);
+      m_progressBar->setMaximum(model.numObjects());
+    }
+
+    return translateModelPrivate(model, true);
+  }
+
+  bool ForwardTranslator::translateModelToStream(Model& model, std::ostream& os, ProgressBar* progressBar) {
+
     m_progressBar = progressBar;
     if (m_progressBar) {
       m_progressBar->setMinimum(0);
       m_progressBar->setMaximum(model.numObjects());
     }
 
-    return translateModelPrivate(modelCopy, true);
+    translateToIdfObjects(model, true);
+    printIdfObjects(os);
+
+    return static_cast<bool>(os);
   }
 
   Workspace ForwardTranslator::translateModelObject(ModelObject& modelObject) {
@@ -207,6 +232,103 @@ namespace energyplus {
   };
 
   Workspace ForwardTranslator::translateModelPrivate(model::Model& model, bool fullModelTranslation) {
+    translateToIdfObjects(model, fullModelTranslation);
+
+    Workspace workspace(StrictnessLevel::Minimal, IddFileType::EnergyPlus);
+    OptionalWorkspaceObject vo = workspace.versionObject();
+    OS_ASSERT(vo);
+    workspace.removeObject(vo->handle());
+
+    workspace.setFastNaming(true);
+    workspace.addObjects(m_idfObjects);
+    workspace.setFastNaming(false);
+    OS_ASSERT(workspace.getObjectsByType(IddObjectType::Version).size() == 1U);
+
+    return workspace;
+  }
+
+  void ForwardTranslator::printIdfObjects(std::ostream& os) {
+
+    // index named objects by name, in translation order, and rename the ones conflicting with an earlier object like
+    // Workspace::addObjects does: same name and a common reference list
+    std::vector<std::string> names(m_idfObjects.size());
+    std::unordered_map<std::string, std::vector<size_t>> nameToObjectIndices;
+    boost::optional<size_t> versionIndex;
+    for (size_t i = 0; i < m_idfObjects.size(); ++i) {
+      const IdfObject& idfObject = m_idfObjects[i];
+      if (idfObject.iddObject().type() == IddObjectType::Version) {
+        OS_ASSERT(!versionIndex);
+        versionIndex = i;
+      }
+      if (!idfObject.iddObject().hasNameField()) {
+        continue;
+      }
+      boost::optional<std::string> name_ = idfObject.name();
+      if (!name_ || name_->empty()) {
+        continue;
+      }
+      names[i] = *name_;
+      std::vector<size_t>& sameName = nameToObjectIndices[istringKey(*name_)];
+      const std::vector<std::string> references = idfObject.iddObject().references();
+      if (std::any_of(sameName.cbegin(), sameName.cend(), [this, &references](size_t other) {
+            return !intersectReferenceLists(references, m_idfObjects[other].iddObject().references()).empty();
+          })) {
+        names[i] = toString(createUUID());
+        LOG(Info, "Renamed " << idfObject.briefDescription() << " to '" << names[i] << "' to avoid a name conflict.");
+      }
+      sameName.push_back(i);
+    }
+    OS_ASSERT(versionIndex);
+
+    // resolve object list fields like Workspace::addObjects does: the field takes the name of the object it points to, looked up
+    // under the translated names before renaming, or is cleared. Each object is written as soon as it is resolved, with the same
+    // layout as Workspace::toIdfFile().print(): no header, version object first, then objects in translation order
+    auto resolveAndPrint = [this, &names, &nameToObjectIndices, &os](size_t i) {
+      IdfObject& idfObject = m_idfObjects[i];
+      if (!names[i].empty() && (names[i] != idfObject.nameString())) {
+        idfObject.setName(names[i]);
+      }
+      for (unsigned index : idfObject.objectListFields()) {
+        if (index >= idfObject.numFields()) {
+          break;
+        }
+        std::string targetName = idfObject.getString(index).get();
+        if (targetName.empty()) {
+          continue;
+        }
+        boost::optional<size_t> targetIndex;
+        auto it = nameToObjectIndices.find(istringKey(targetName));
+        if (it != nameToObjectIndices.end()) {
+          const std::set<std::string> objectLists = idfObject.iddObject().objectLists(index);
+          for (size_t candidate : it->second) {
+            const std::vector<std::string> references = m_idfObjects[candidate].iddObject().references();
+            if (std::any_of(references.cbegin(), references.cend(), [&objectLists](const auto& ref) { return objectLists.count(ref) > 0; })) {
+              targetIndex = candidate;
+              break;
+            }
+          }
+        }
+        if (targetIndex) {
+          idfObject.setString(index, names[*targetIndex]);
+        } else {
+          LOG(Warn, idfObject.briefDescription() << ", points to an object named " << targetName << " from field " << index
+                                                 << ", but that object cannot be located.");
+          idfObject.setString(index, "");
+        }
+      }
+      idfObject.print(os);
+    };
+
+    os << '\n';
+    resolveAndPrint(*versionIndex);
+    for (size_t i = 0; i < m_idfObjects.size(); ++i) {
+      if (i != *versionIndex) {
+        resolveAndPrint(i);
+      }
+    }
+  }
+
+  void ForwardTranslator::translateToIdfObjects(model::Model& model, bool fullModelTranslation) {
     reset();
 
     // translate Version first
@@ -611,18 +733,6 @@ namespace energyplus {
       // add output requests
       this->createStandardOutputRequests(model);
     }
-
-    Workspace workspace(StrictnessLevel::Minimal, IddFileType::EnergyPlus);
-    OptionalWorkspaceObject vo = workspace.versionObject();
-    OS_ASSERT(vo);
-    workspace.removeObject(vo->handle());
-
-    workspace.setFastNaming(true);
-    workspace.addObjects(m_idfObjects);
-    workspace.setFastNaming(false);
-    OS_ASSERT(workspace.getObjectsByType(IddObjectType::Version).size() == 1U);
-
-    return workspace;
   }
 
   // struct for sorting children in forward translator
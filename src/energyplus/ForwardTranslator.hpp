@@ -515,6 +515,21 @@ namespace energyplus {
    */
     Workspace translateModel(const model::Model& model, ProgressBar* progressBar = nullptr);
 
+    /** Translates the given Model to a Workspace without cloning it first. The translator modifies the model as it goes
+   *  (spaces are combined, orphan objects removed, shading controls split per zone, defaults added, etc.), so only use this when the
+   *  model is not needed afterwards. Produces the same Workspace as translateModel, without the cost and memory of the clone.
+   */
+    Workspace translateModelInPlace(model::Model& model, ProgressBar* progressBar = nullptr);
+
+    /** Translates the given Model and writes the resulting IDF to os, without building an intermediate Workspace. Like
+   *  translateModelInPlace, the model is not cloned and is modified by the translation, so only use this when the model is not
+   *  needed afterwards, e.g. to write an IDF to run a simulation. Object list fields are resolved by name as the Workspace
+   *  would, and objects sharing a name and a reference list with an object translated before them are renamed to a UUID, as
+   *  Workspace::addObjects does, so EnergyPlus sees unique names. For a model without such duplicates the text written is the
+   *  same as translateModel(model).toIdfFile().print(os). Returns false if the stream is in a failed state after writing.
+   */
+    bool translateModelToStream(model::Model& model, std::ostream& os, ProgressBar* progressBar = nullptr);
+
     /** Translates a ModelObject into a Workspace
    */
     Workspace translateModelObject(model::ModelObject& modelObject);
@@ -588,6 +603,13 @@ namespace energyplus {
    */
     Workspace translateModelPrivate(model::Model& model, bool fullModelTranslation);
 
+    // Does the work of translateModelPrivate, leaving the translated objects in m_idfObjects
+    void translateToIdfObjects(model::Model& model, bool fullModelTranslation);
+
+    // Writes m_idfObjects to os as the Workspace built by translateModelPrivate would be printed, renaming duplicate names and
+    // replacing object list fields by the name of the object they resolve to (or an empty string if they do not resolve)
+    void printIdfObjects(std::ostream& os);
+
     // Pick up the Zone, ZoneList, Space or SpaceList (if allowSpaceType is true) object for a given SpaceLoad (or SpaceLoadInstance)
     IdfObject getSpaceLoadParent(const model::SpaceLoad& sp, bool allowSpaceType = true);
 
@@ -12,10 +12,14 @@
 
 #include <resources.hxx>
 
+#include <algorithm>
 #include <sstream>
 #include <fstream>
 
 using openstudio::energyplus::ErrorFile;
+using openstudio::energyplus::ErrorFileMessage;
+using openstudio::energyplus::ErrorFileParser;
+using openstudio::energyplus::ErrorLevel;
 
 TEST_F(EnergyPlusFixture, ErrorFile_NoErrorsNoWarnings) {
   openstudio::path path = resourcesPath() / openstudio::toPath("energyplus/ErrorFiles/NoErrorsNoWarnings.err");
@@ -90,3 +94,115 @@ TEST_F(EnergyPlusFixture, ErrorFile_WarningsAndCrash) {
   EXPECT_FALSE(errorFile.completed());
   EXPECT_FALSE(errorFile.completedSuccessfully());
 }
+
+TEST_F(EnergyPlusFixture, ErrorFile_RepeatingWarnings) {
+  openstudio::path path = resourcesPath() / openstudio::toPath("energyplus/ErrorFiles/RepeatingWarnings.err");
+
+  ErrorFile errorFile(path);
+  EXPECT_EQ(static_cast<unsigned>(52), errorFile.warnings().size());
+  EXPECT_TRUE(errorFile.completed());
+  EXPECT_TRUE(errorFile.completedSuccessfully());
+
+  // warnings that only differ by their numbers are counted together
+  std::vector<ErrorFileMessage> messages = errorFile.messages();
+  ASSERT_EQ(static_cast<unsigned>(15), messages.size());
+  unsigned total = 0;
+  for (const ErrorFileMessage& message : messages) {
+    EXPECT_EQ(ErrorLevel::Warning, message.level.value());
+    EXPECT_LE(message.firstLine, message.lastLine);
+    total += message.count;
+  }
+  EXPECT_EQ(static_cast<unsigned>(52), total);
+
+  EXPECT_EQ("IP: Note -- Some missing fields have been filled with defaults. See the audit output file for details.", messages[0].message);
+  EXPECT_EQ(static_cast<unsigned>(1), messages[0].count);
+  EXPECT_EQ(static_cast<unsigned>(2), messages[0].firstLine);
+
+  auto it = std::find_if(messages.begin(), messages.end(),
+                         [](const ErrorFileMessage& message) { return message.message.find("at RUN PERIOD 1") != std::string::npos; });
+  ASSERT_NE(messages.end(), it);
+  EXPECT_EQ(static_cast<unsigned>(13), it->count);
+  EXPECT_EQ(static_cast<unsigned>(104), it->firstLine);
+  EXPECT_EQ(static_cast<unsigned>(131), it->lastLine);
+}
+
+TEST_F(EnergyPlusFixture, ErrorFileParser_Streaming) {
+  openstudio::path path = resourcesPath() / openstudio::toPath("energyplus/ErrorFiles/WarningsAndSevere.err");
+  ErrorFile errorFile(path);
+
+  std::string text;
+  {
+    std::ifstream ifs(openstudio::toString(path), std::ios_base::binary);
+    std::stringstream ss;
+    ss << ifs.rdbuf();
+    text = ss.str();
+  }
+
+  std::vector<std::string> warnings;
+  std::vector<std::string> severeErrors;
+  std::vector<std::string> fatalErrors;
+  ErrorFileParser::Callback callback = [&](const ErrorLevel& level, const std::string& message, unsigned /*lineNumber*/) {
+    if (level == ErrorLevel::Warning) {
+      warnings.push_back(message);
+    } else if (level == ErrorLevel::Severe) {
+      severeErrors.push_back(message);
+    } else {
+      fatalErrors.push_back(message);
+    }
+  };
+
+  // text arriving in small chunks, as while EnergyPlus is writing, gives the same result
+  ErrorFileParser parser(callback);
+  for (size_t pos = 0; pos < text.size(); pos += 7) {
+    parser.parse(text.data() + pos, std::min<size_t>(7, text.size() - pos));
+  }
+  parser.finish();
+  EXPECT_EQ(errorFile.warnings(), warnings);
+  EXPECT_EQ(errorFile.severeErrors(), severeErrors);
+  EXPECT_EQ(errorFile.fatalErrors(), fatalErrors);
+  EXPECT_TRUE(parser.completed());
+  EXPECT_FALSE(parser.completedSuccessfully());
+  EXPECT_EQ(errorFile.messages().size(), parser.messages().size());
+
+  // following a file that is still being written
+  warnings.clear();
+  severeErrors.clear();
+  fatalErrors.clear();
+  openstudio::path growingPath = openstudio::tempDir() / openstudio::toPath("ErrorFileParser_Streaming.err");
+  const size_t half = text.size() / 2;
+  {
+    std::ofstream ofs(openstudio::toString(growingPath), std::ios_base::binary | std::ios_base::trunc);
+    ofs << text.substr(0, half);
+  }
+  ErrorFileParser parser2(callback);
+  EXPECT_TRUE(parser2.update(growingPath));
+  EXPECT_FALSE(parser2.completed());
+  const size_t numWarningsSoFar = warnings.size();
+  EXPECT_LT(0u, numWarningsSoFar);
+  EXPECT_GT(errorFile.warnings().size(), numWarningsSoFar);
+  {
+    std::ofstream ofs(openstudio::toString(growingPath), std::ios_base::binary | std::ios_base::app);
+    ofs << text.substr(half);
+  }
+  EXPECT_TRUE(parser2.update(growingPath));
+  parser2.finish();
+  EXPECT_EQ(errorFile.warnings(), warnings);
+  EXPECT_EQ(errorFile.severeErrors(), severeErrors);
+  EXPECT_EQ(errorFile.fatalErrors(), fatalErrors);
+  EXPECT_TRUE(parser2.completed());
+
+  EXPECT_FALSE(ErrorFileParser().update(openstudio::tempDir() / openstudio::toPath("ErrorFileParser_DoesNotExist.err")));
+}
+
+TEST_F(EnergyPlusFixture, ErrorFileParser_CRLF) {
+  ErrorFileParser parser;
+  parser.parse("   ** Warning ** First warning  \r\n   **   ~~~   ** continued  \r\n   ** Severe  ** An error\r\n"
+               "   ************* EnergyPlus Completed Successfully-- 1 Warning; 1 Severe Errors\r\n");
+  parser.finish();
+  ASSERT_EQ(2u, parser.messages().size());
+  EXPECT_EQ("First warning\n continued", parser.messages()[0].message);
+  EXPECT_EQ("An error", parser.messages()[1].message);
+  EXPECT_EQ(ErrorLevel::Severe, parser.messages()[1].level.value());
+  EXPECT_TRUE(parser.completedSuccessfully());
+  EXPECT_EQ(4u, parser.numLines());
+}
@@ -61,6 +61,7 @@
 #include <utilities/idd/Schedule_Compact_FieldEnums.hxx>
 #include <utilities/idd/ZoneCapacitanceMultiplier_ResearchSpecial_FieldEnums.hxx>
 #include <utilities/idd/Output_Variable_FieldEnums.hxx>
+#include <utilities/idd/Space_FieldEnums.hxx>
 #include <utilities/idd/IddEnums.hxx>
 #include <utilities/idd/IddFactory.hxx>
 
@@ -125,6 +126,74 @@ TEST_F(EnergyPlusFixture, ForwardTranslator_ExampleModel) {
   // workspace.save(toPath("./example.idf"), true);
 }
 
+TEST_F(EnergyPlusFixture, ForwardTranslator_translateModelInPlace) {
+  for (bool excludeSpaceTranslation : {false, true}) {
+    Model model = exampleModel();
+    ForwardTranslator forwardTranslator;
+    forwardTranslator.setExcludeSpaceTranslation(excludeSpaceTranslation);
+
+    Workspace workspace = forwardTranslator.translateModel(model);
+    std::stringstream ss;
+    workspace.toIdfFile().print(ss);
+
+    Workspace workspaceInPlace = forwardTranslator.translateModelInPlace(model);
+    std::stringstream ssInPlace;
+    workspaceInPlace.toIdfFile().print(ssInPlace);
+
+    EXPECT_EQ(ss.str(), ssInPlace.str()) << "excludeSpaceTranslation=" << std::boolalpha << excludeSpaceTranslation;
+  }
+}
+
+TEST_F(EnergyPlusFixture, ForwardTranslator_translateModelToStream) {
+  for (bool excludeSpaceTranslation : {false, true}) {
+    Model model = exampleModel();
+    ForwardTranslator forwardTranslator;
+    forwardTranslator.setExcludeSpaceTranslation(excludeSpaceTranslation);
+
+    Workspace workspace = forwardTranslator.translateModel(model);
+    std::stringstream ss;
+    workspace.toIdfFile().print(ss);
+
+    // translates in place, so it runs last
+    std::stringstream ssStream;
+    EXPECT_TRUE(forwardTranslator.translateModelToStream(model, ssStream));
+
+    EXPECT_EQ(ss.str(), ssStream.str()) << "excludeSpaceTranslation=" << std::boolalpha << excludeSpaceTranslation;
+  }
+}
+
+TEST_F(EnergyPlusFixture, ForwardTranslator_translateModelToStream_DuplicateNames) {
+  // OS:ThermalZone and OS:Space do not share a reference list, but Zone and Space do, so EnergyPlus would reject both names
+  Model model;
+  ThermalZone thermalZone(model);
+  EXPECT_TRUE(thermalZone.setName("Office"));
+  Space space(model);
+  EXPECT_TRUE(space.setName("Office"));
+  EXPECT_TRUE(space.setThermalZone(thermalZone));
+
+  ForwardTranslator forwardTranslator;
+  forwardTranslator.setExcludeSpaceTranslation(false);
+  std::stringstream ss;
+  EXPECT_TRUE(forwardTranslator.translateModelToStream(model, ss));
+
+  OptionalIdfFile idfFile = IdfFile::load(ss, IddFileType::EnergyPlus);
+  ASSERT_TRUE(idfFile);
+  std::vector<IdfObject> zones = idfFile->getObjectsByType(IddObjectType::Zone);
+  std::vector<IdfObject> spaces = idfFile->getObjectsByType(IddObjectType::Space);
+  ASSERT_EQ(1u, zones.size());
+  ASSERT_EQ(1u, spaces.size());
+  EXPECT_FALSE(istringEqual(zones[0].nameString(), spaces[0].nameString()));
+  EXPECT_TRUE(istringEqual("Office", zones[0].nameString()) || istringEqual("Office", spaces[0].nameString()));
+
+  // the space still points to its zone under the zone's final name
+  EXPECT_EQ(zones[0].nameString(), spaces[0].getString(SpaceFields::ZoneName).get());
+
+  // the Workspace finds nothing left to rename
+  Workspace workspace(*idfFile);
+  EXPECT_EQ(zones[0].nameString(), workspace.getObjectsByType(IddObjectType::Zone)[0].nameString());
+  EXPECT_EQ(spaces[0].nameString(), workspace.getObjectsByType(IddObjectType::Space)[0].nameString());
+}
+
 TEST_F(EnergyPlusFixture, ForwardTranslatorTest_TranslateAirLoopHVAC) {
   openstudio::model::Model model;
   EXPECT_TRUE(model.getOptionalUniqueModelObject<Version>()) << "Blank model does not include a Version object.";
@@ -0,0 +1,66 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../ErrorFile.hpp"
+
+#include "../../utilities/core/Path.hpp"
+
+#include <fstream>
+
+using namespace openstudio;
+using namespace openstudio::energyplus;
+
+// synthetic err file made of recurring warnings like a long annual run produces, about 400 bytes per warning
+openstudio::path makeErrFile(int64_t nWarnings) {
+  openstudio::path errPath = openstudio::tempDir() / openstudio::toPath("ErrorFile_Benchmark_" + std::to_string(nWarnings) + ".err");
+  std::ofstream ofs(openstudio::toString(errPath), std::ios_base::binary | std::ios_base::trunc);
+  ofs << "Program Version,EnergyPlus, Version 23.2.0-7636e6b3e9, YMD=2023.11.14 12:00,\n";
+  ofs << "   ************* Beginning Simulation\n";
+  for (int64_t i = 0; i < nWarnings; ++i) {
+    const int64_t day = 1 + (i % 365);
+    ofs << "   ** Warning ** CalcDoe2DXCoil: Coil:Cooling:DX:SingleSpeed \"COIL COOLING DX SINGLE SPEED " << (i % 20)
+        << "\" - Full load outlet air dry-bulb temperature < 2C. Outlet temperature = " << -0.01 * (i % 500) << " C.\n";
+    ofs << "   **   ~~~   **  ...Occurrence info = RUN PERIOD 1, " << (1 + day / 31) << "/" << (1 + day % 28) << " 21:10 - 21:12\n";
+    ofs << "   **   ~~~   ** ... Possible reasons for low outlet air dry-bulb temperatures are: This DX coil\n";
+    if (i % 10 == 0) {
+      ofs << "   ** Severe  ** SimHVAC: Maximum iterations (20) exceeded for all HVAC loops, at RUN PERIOD 1\n";
+    }
+  }
+  ofs << "   ************* EnergyPlus Completed Successfully-- " << nWarnings << " Warning; " << (nWarnings / 10) << " Severe Errors\n";
+  return errPath;
+}
+
+static void BM_ErrorFile(benchmark::State& state) {
+  openstudio::path errPath = makeErrFile(state.range(0));
+
+  for (auto _ : state) {
+    ErrorFile errorFile(errPath);
+    benchmark::DoNotOptimize(errorFile);
+  }
+
+  state.SetComplexityN(state.range(0));
+  openstudio::filesystem::remove(errPath);
+}
+
+static void BM_ErrorFileParser(benchmark::State& state) {
+  openstudio::path errPath = makeErrFile(state.range(0));
+
+  // streaming with a callback and no stored strings
+  for (auto _ : state) {
+    size_t numMessages = 0;
+    ErrorFileParser parser([&numMessages](const ErrorLevel&, const std::string&, unsigned) { ++numMessages; });
+    parser.update(errPath);
+    parser.finish();
+    benchmark::DoNotOptimize(numMessages);
+  }
+
+  state.SetComplexityN(state.range(0));
+  openstudio::filesystem::remove(errPath);
+}
+
+BENCHMARK(BM_ErrorFile)->Unit(benchmark::kMillisecond)->RangeMultiplier(10)->Range(1000, 100000)->Complexity();
+BENCHMARK(BM_ErrorFileParser)->Unit(benchmark::kMillisecond)->RangeMultiplier(10)->Range(1000, 100000)->Complexity();
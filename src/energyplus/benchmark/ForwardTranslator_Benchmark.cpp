@@ -8,10 +8,14 @@
 #include "../ForwardTranslator.hpp"
 
 #include "../../model/Model.hpp"
+#include "../../model/Model_Impl.hpp"
 
 #include "../../utilities/core/Logger.hpp"
 #include "../../utilities/core/FileLogSink.hpp"
 #include "../../utilities/idf/Workspace.hpp"
+#include "../../utilities/idf/IdfFile.hpp"
+
+#include <sstream>
 
 using namespace openstudio;
 using namespace openstudio::model;
@@ -58,6 +62,82 @@ static void BM_FT_ExampleModel_newFT(benchmark::State& state) {
   state.SetComplexityN(state.range(0));
 }
 
+static void BM_FT_ExampleModel_InPlace(benchmark::State& state) {
+
+  FileLogSink logFile(toPath("./ForwardTranslator_Benchmark.log"));
+  logFile.setLogLevel(Error);
+  openstudio::Logger::instance().standardOutLogger().disable();
+
+  Model model = exampleModel();
+
+  ForwardTranslator forwardTranslator;
+  forwardTranslator.setExcludeSpaceTranslation(state.range(1) == 0 ? false : true);
+
+  // Code inside this loop is measured repeatedly, the translated models are cloned outside of the timed section
+  for (auto _ : state) {
+    for (auto i = 0; i <= state.range(0); ++i) {
+      state.PauseTiming();
+      auto modelCopy = model.clone(true).cast<Model>();
+      state.ResumeTiming();
+      Workspace workspace = forwardTranslator.translateModelInPlace(modelCopy);
+    }
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_FT_ExampleModel_PrintWorkspace(benchmark::State& state) {
+
+  FileLogSink logFile(toPath("./ForwardTranslator_Benchmark.log"));
+  logFile.setLogLevel(Error);
+  openstudio::Logger::instance().standardOutLogger().disable();
+
+  Model model = exampleModel();
+
+  ForwardTranslator forwardTranslator;
+  forwardTranslator.setExcludeSpaceTranslation(state.range(1) == 0 ? false : true);
+
+  // Code inside this loop is measured repeatedly, the translated models are cloned outside of the timed section so that this
+  // only differs from BM_FT_ExampleModel_ToStream by building and printing the Workspace
+  for (auto _ : state) {
+    for (auto i = 0; i <= state.range(0); ++i) {
+      state.PauseTiming();
+      auto modelCopy = model.clone(true).cast<Model>();
+      state.ResumeTiming();
+      std::stringstream ss;
+      Workspace workspace = forwardTranslator.translateModelInPlace(modelCopy);
+      workspace.toIdfFile().print(ss);
+    }
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_FT_ExampleModel_ToStream(benchmark::State& state) {
+
+  FileLogSink logFile(toPath("./ForwardTranslator_Benchmark.log"));
+  logFile.setLogLevel(Error);
+  openstudio::Logger::instance().standardOutLogger().disable();
+
+  Model model = exampleModel();
+
+  ForwardTranslator forwardTranslator;
+  forwardTranslator.setExcludeSpaceTranslation(state.range(1) == 0 ? false : true);
+
+  // Code inside this loop is measured repeatedly, the translated models are cloned outside of the timed section
+  for (auto _ : state) {
+    for (auto i = 0; i <= state.range(0); ++i) {
+      state.PauseTiming();
+      auto modelCopy = model.clone(true).cast<Model>();
+      state.ResumeTiming();
+      std::stringstream ss;
+      forwardTranslator.translateModelToStream(modelCopy, ss);
+    }
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
 // Regular run, with n=512
 /*
 BENCHMARK(BM_WorkspaceSetNameWithChecks)->Unit(benchmark::kMillisecond)->Arg(512);
@@ -71,3 +151,9 @@ BENCHMARK(BM_WorkspaceSetNameWithoutAnyChecks)->Unit(benchmark::kMillisecond)->A
 BENCHMARK(BM_FT_ExampleModel_newFT)->Unit(benchmark::kMillisecond)->Ranges({{1, 256}, {0, 1}})->Complexity();
 
 BENCHMARK(BM_FT_ExampleModel_sameFT)->Unit(benchmark::kMillisecond)->Ranges({{1, 256}, {0, 1}})->Complexity();
+
+BENCHMARK(BM_FT_ExampleModel_InPlace)->Unit(benchmark::kMillisecond)->Ranges({{1, 256}, {0, 1}})->Complexity();
+
+BENCHMARK(BM_FT_ExampleModel_PrintWorkspace)->Unit(benchmark::kMillisecond)->Ranges({{1, 256}, {0, 1}})->Complexity();
+
+BENCHMARK(BM_FT_ExampleModel_ToStream)->Unit(benchmark::kMillisecond)->Ranges({{1, 256}, {0, 1}})->Complexity();
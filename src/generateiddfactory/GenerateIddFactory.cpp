@@ -72,6 +72,7 @@ void initializeOutFiles(GenerateIddFactoryOutFiles& outFiles, const std::vector<
                                   << "#include <utilities/core/Logger.hpp>" << '\n'
                                   << '\n'
                                   << "#include <map>" << '\n'
+                                  << "#include <mutex>" << '\n'
                                   << '\n'
                                   << "namespace openstudio{" << '\n'
                                   << '\n'
@@ -189,6 +190,9 @@ void initializeOutFiles(GenerateIddFactoryOutFiles& outFiles, const std::vector<
                                   << "  typedef std::multimap<IddObjectType,IddFileType> IddObjectSourceFileMap;" << '\n'
                                   << "  IddObjectSourceFileMap m_sourceFileMap;" << '\n'
                                   << '\n'
+                                  << "  // IddFiles are immutable outside of the factory, so they are built once and shared" << '\n'
+                                  << "  mutable std::mutex m_iddFilesMutex;" << '\n'
+                                  << "  mutable std::map<IddFileType,IddFile> m_iddFiles;" << '\n'
                                   << "  mutable std::map<VersionString,IddFile> m_osIddFiles;" << '\n'
                                   << "};" << '\n'
                                   << '\n'
@@ -667,6 +671,12 @@ void completeOutFiles(const IddFileFactoryDataVector& iddFiles, GenerateIddFacto
     << "    return result; " << '\n'
     << "  }" << '\n'
     << '\n'
+    << "  std::lock_guard<std::mutex> lock(m_iddFilesMutex);" << '\n'
+    << "  std::map<IddFileType, IddFile>::const_iterator cached = m_iddFiles.find(fileType);" << '\n'
+    << "  if (cached != m_iddFiles.end()) {" << '\n'
+    << "    return cached->second;" << '\n'
+    << "  }" << '\n'
+    << '\n'
     << "  // Add the IddObjects." << '\n'
     << "  for(IddObjectCallbackMap::const_iterator it = m_callbackMap.begin()," << '\n'
     << "      itend = m_callbackMap.end(); it != itend; ++it) {" << '\n'
@@ -682,6 +692,7 @@ void completeOutFiles(const IddFileFactoryDataVector& iddFiles, GenerateIddFacto
     << "  }" << '\n'
     << "  catch (...) {}" << '\n'
     << '\n'
+    << "  m_iddFiles[fileType] = result;" << '\n'
     << "  return result;" << '\n'
     << "}" << '\n'
     << '\n'
@@ -708,6 +719,8 @@ void completeOutFiles(const IddFileFactoryDataVector& iddFiles, GenerateIddFacto
     << "    return getIddFile(fileType);" << '\n'
     << "  }" << '\n'
     << "  else {" << '\n'
+    << "    // held while parsing, so that concurrent version translations share a single parse of each file" << '\n'
+    << "    std::lock_guard<std::mutex> lock(m_iddFilesMutex);" << '\n'
     << "    std::map<VersionString, IddFile>::const_iterator it = m_osIddFiles.find(version);" << '\n'
     << "    if (it != m_osIddFiles.end()) {" << '\n'
     << "      return it->second;" << '\n'
@@ -719,7 +732,8 @@ void completeOutFiles(const IddFileFactoryDataVector& iddFiles, GenerateIddFacto
     << "    if (::openstudio::embedded_files::hasFile(iddPath) && (version < currentVersion)) {" << '\n'
     << "      std::stringstream ss;" << '\n'
     << "      ss << ::openstudio::embedded_files::getFileAsString(iddPath);" << '\n'
-    << "      result = IddFile::load(ss);" << '\n'
+    << "      // objects are independent of each other, parse them on all hardware threads" << '\n'
+    << "      result = IddFile::load(ss, 0u);" << '\n'
     << "    }" << '\n'
     << "    if (result) {" << '\n'
     << "      m_osIddFiles[version] = *result;" << '\n'
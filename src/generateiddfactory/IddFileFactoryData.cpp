@@ -177,8 +177,8 @@ void IddFileFactoryData::parseFile(const path& outPath, const std::string& outFi
                       << '\n'
                       << "    // Rely on C++11 static initialization and Initialize on First Use Idiom" << '\n'
                       << "    // to make sure all statics are initialized properly, thread safely" << '\n'
-                      << "    std::stringstream ss;" << '\n'
-                      << "    ss << \"" << m_readyLineForOutput(line) << "\\n\";";
+                      << "    const std::string text =" << '\n'
+                      << "      \"" << m_readyLineForOutput(line) << "\\n\"";
 
     // start collecting field names
     // (requires \field tag, which is expected to occur one per line)
@@ -192,12 +192,12 @@ void IddFileFactoryData::parseFile(const path& outPath, const std::string& outFi
       boost::trim(trimLine);
       if (trimLine.empty()) {
         // finish writing create function
-        cxxFile->tempFile << '\n'
+        cxxFile->tempFile << ";" << '\n'
                           << '\n'
                           << "    IddObjectType objType(IddObjectType::" << objectName.first << ");" << '\n'
                           << "    OptionalIddObject oObj = IddObject::load(\"" << objectName.second << "\"," << '\n'
                           << "                                             \"" << group << "\"," << '\n'
-                          << "                                             ss.str()," << '\n'
+                          << "                                             text," << '\n'
                           << "                                             objType);" << '\n'
                           << "    OS_ASSERT(oObj);" << '\n'
                           << "    return *oObj;" << '\n'
@@ -295,7 +295,7 @@ void IddFileFactoryData::parseFile(const path& outPath, const std::string& outFi
       }
 
       // continue writing create function
-      cxxFile->tempFile << '\n' << "    ss << \"" << m_readyLineForOutput(line) << "\\n\";";
+      cxxFile->tempFile << '\n' << "      \"" << m_readyLineForOutput(line) << "\\n\"";
 
       // look for field name
       std::string fieldName;
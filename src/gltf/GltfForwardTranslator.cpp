@@ -57,6 +57,7 @@
 #include "../utilities/geometry/Transformation.hpp"
 #include "../utilities/geometry/Geometry.hpp"
 #include "../utilities/geometry/Polygon3d.hpp"
+#include "../utilities/geometry/PointSet.hpp"
 
 #define TINYGLTF_IMPLEMENTATION
 #define STB_IMAGE_IMPLEMENTATION
@@ -111,22 +112,6 @@ namespace gltf {
     coordinatesBv.byteStride = 12;
   }
 
-  // Finds the vertex Index from all Vertices of a planar Surface
-  // param : point3d
-  // param : allPoints
-  // param : tol
-  // returns :  index of the Vertex
-  size_t getOrCreateVertexIndexT(const Point3d& point3d, std::vector<Point3d>& allPoints, double tol = 0.001) {
-    size_t n = allPoints.size();
-    for (size_t i = 0; i < n; ++i) {
-      if (openstudio::getDistance(point3d, allPoints[i]) < tol) {
-        return i;
-      }
-    }
-    allPoints.push_back(point3d);
-    return (allPoints.size() - 1);
-  }
-
   template <typename T>
   std::vector<T> getObjectsAndSort(const model::Model& model) {
     std::vector<T> objects;
@@ -309,7 +294,7 @@ namespace gltf {
         finalFaceVertices.push_back(faceVertices);
       }
 
-      Point3dVector allVertices;
+      PointSet allVertices;
       Point3dVector triangleVertices;
       std::vector<size_t> faceIndices;
       for (const auto& finalFaceVerts : finalFaceVertices) {
@@ -318,14 +303,14 @@ namespace gltf {
         auto it = finalVerts.rbegin();
         auto itend = finalVerts.rend();
         for (; it != itend; ++it) {
-          faceIndices.push_back(getOrCreateVertexIndexT(*it, allVertices));
+          faceIndices.push_back(allVertices.insert(*it));
         }
       }
 
       Vector3d outwardNormal = planarSurface.outwardNormal();
       Vector3dVector normalVectors(allVertices.size(), outwardNormal);
 
-      detail::ShapeComponentIds shapeComponentIds(faceIndices, allVertices, normalVectors, indicesBuffer, coordinatesBuffer, accessors);
+      detail::ShapeComponentIds shapeComponentIds(faceIndices, allVertices.points(), normalVectors, indicesBuffer, coordinatesBuffer, accessors);
 
       tinygltf::Primitive& thisPrimitive = targetMesh.primitives.emplace_back();
       thisPrimitive.attributes["NORMAL"] = shapeComponentIds.normalsAccessorId;
@@ -0,0 +1,312 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include "LazyModel.hpp"
+#include "Model_Impl.hpp"
+
+#include "../osversion/VersionTranslator.hpp"
+
+#include "../utilities/core/Filesystem.hpp"
+#include "../utilities/core/UUID.hpp"
+#include "../utilities/idd/IddFileAndFactoryWrapper.hpp"
+#include "../utilities/idf/IdfObject.hpp"
+#include "../utilities/idf/IdfTokenizer.hpp"
+#include "../utilities/idf/WorkspaceObject_Impl.hpp"
+
+#include <utilities/idd/IddEnums.hxx>
+#include <utilities/idd/OS_Version_FieldEnums.hxx>
+
+#include <OpenStudio.hxx>
+
+#include <boost/functional/hash.hpp>
+
+#include <map>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace openstudio {
+namespace model {
+
+  namespace detail {
+
+    namespace {
+
+      // the second field of an object, which is the handle in the OpenStudio IDD
+      std::string_view handleField(std::string_view objectText) {
+        size_t fieldBegin = std::string_view::npos;
+        size_t segmentBegin = 0;
+        std::string_view result;
+        for (size_t i = 0; i < objectText.size(); ++i) {
+          const char c = objectText[i];
+          if (c == '!') {
+            if (fieldBegin != std::string_view::npos) {
+              std::string_view segment = idfTokenizer::trim(objectText.substr(segmentBegin, i - segmentBegin));
+              if (!segment.empty()) {
+                result = segment;
+              }
+            }
+            i = objectText.find('\n', i);
+            if (i == std::string_view::npos) {
+              break;
+            }
+            segmentBegin = i + 1;
+          } else if ((c == ',') || (c == ';')) {
+            if (fieldBegin != std::string_view::npos) {
+              std::string_view segment = idfTokenizer::trim(objectText.substr(segmentBegin, i - segmentBegin));
+              return segment.empty() ? result : segment;
+            }
+            if (c == ';') {
+              break;
+            }
+            fieldBegin = i + 1;
+            segmentBegin = fieldBegin;
+          }
+        }
+        return result;
+      }
+
+    }  // namespace
+
+    class LazyModel_Impl
+    {
+     public:
+      // reads and indexes the file, returns false if it is not a lazy loadable OSM
+      bool index(const path& osmPath);
+
+      void loadObjects(const std::vector<size_t>& indices);
+
+      // an object in the file
+      struct ObjectText
+      {
+        std::string_view text;  // text of the object, from its preceding comment through the closing ';'
+        IddObject iddObject;
+        bool loaded = false;
+      };
+
+      bool lazy = false;
+      std::string text;
+      std::vector<ObjectText> objectTexts;
+      std::map<IddObjectType, std::vector<size_t>> objectsByType;
+      std::unordered_map<Handle, size_t, boost::hash<boost::uuids::uuid>> objectsByHandle;
+      Model model;
+
+      REGISTER_LOGGER("openstudio.model.LazyModel");
+    };
+
+    bool LazyModel_Impl::index(const path& osmPath) {
+      openstudio::filesystem::ifstream inFile(osmPath);
+      if (!inFile) {
+        return false;
+      }
+      text = idfTokenizer::readNormalized(inFile);
+      std::string_view view(text);
+
+      IddFileAndFactoryWrapper iddFile(IddFileType::OpenStudio);
+      std::map<std::string, OptionalIddObject, std::less<>> iddObjects;  // IddObjects by object type, as spelled in text
+      boost::optional<VersionString> version;
+
+      size_t pos = 0;
+      auto getLine = [&view, &pos](std::string_view& line) {
+        if (pos >= view.size()) {
+          return false;
+        }
+        size_t newLine = view.find('\n', pos);
+        size_t end = (newLine == std::string_view::npos) ? view.size() : newLine;
+        line = view.substr(pos, end - pos);
+        pos = (newLine == std::string_view::npos) ? view.size() : newLine + 1;
+        return true;
+      };
+
+      // same split into objects as IdfFile, every line is one of comment, whitespace, or the start of an object
+      size_t commentBegin = std::string_view::npos;
+      std::string_view line;
+      while (getLine(line)) {
+        size_t lineBegin = line.data() - view.data();
+
+        if (idfTokenizer::isCommentOnlyLine(line)) {
+          if (commentBegin == std::string_view::npos) {
+            commentBegin = lineBegin;
+          }
+          continue;
+        }
+        if (idfTokenizer::isWhitespaceOnlyLine(line)) {
+          commentBegin = std::string_view::npos;
+          continue;
+        }
+
+        idfTokenizer::LineMatch lineMatch;
+        if (!idfTokenizer::line(line, lineMatch)) {
+          LOG(Warn, "Unrecognizable object type '" << line << "', not lazy loading " << osmPath << ".");
+          return false;
+        }
+        std::string_view objectType = idfTokenizer::trim(lineMatch.content);
+
+        size_t objectBegin = (commentBegin == std::string_view::npos) ? lineBegin : commentBegin;
+        commentBegin = std::string_view::npos;
+        bool foundEndLine = idfTokenizer::isObjectEnd(line);
+        while (!foundEndLine && getLine(line)) {
+          foundEndLine = idfTokenizer::isObjectEnd(line);
+        }
+        if (!foundEndLine) {
+          break;
+        }
+        std::string_view objectText = view.substr(objectBegin, pos - objectBegin);
+
+        auto it = iddObjects.find(objectType);
+        if (it == iddObjects.end()) {
+          it = iddObjects.emplace(std::string(objectType), iddFile.getObject(std::string(objectType))).first;
+        }
+        if (!it->second) {
+          LOG(Warn, "Cannot find object type '" << objectType << "' in the OpenStudio Idd, not lazy loading " << osmPath << ".");
+          return false;
+        }
+        const IddObject& iddObject = *it->second;
+
+        if (iddObject.type() == IddObjectType::OS_Version) {
+          if (OptionalIdfObject versionObject = IdfObject::load(std::string(objectText), iddObject)) {
+            if (OptionalString versionIdentifier = versionObject->getString(OS_VersionFields::VersionIdentifier)) {
+              version = VersionString(*versionIdentifier);
+            }
+          }
+          continue;
+        }
+
+        Handle handle = toUUID(std::string(handleField(objectText)));
+        if (handle.isNull() || !objectsByHandle.emplace(handle, objectTexts.size()).second) {
+          LOG(Warn, "Missing or duplicate handle in object '" << objectType << "', not lazy loading " << osmPath << ".");
+          return false;
+        }
+        objectsByType[iddObject.type()].push_back(objectTexts.size());
+        objectTexts.push_back(ObjectText{objectText, iddObject});
+      }
+
+      // older files need VersionTranslator
+      if (!version || (*version != VersionString(openStudioVersion()))) {
+        LOG(Info, "Model at " << osmPath << " is not at OpenStudio Version " << openStudioVersion() << ", it is loaded in full.");
+        return false;
+      }
+      return true;
+    }
+
+    void LazyModel_Impl::loadObjects(const std::vector<size_t>& indices) {
+      // the objects and everything they point to, directly or not, that is not loaded yet. objects are only marked
+      // loaded once they are in the model, so one that fails to load is tried again by the next query
+      std::unordered_set<size_t> queued;
+      std::vector<size_t> toLoad;
+      for (size_t i : indices) {
+        if (!objectTexts[i].loaded && queued.insert(i).second) {
+          toLoad.push_back(i);
+        }
+      }
+
+      std::vector<size_t> loadedIndices;
+      std::vector<std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>> objectImplPtrs;
+      std::shared_ptr<Model_Impl> modelImpl = model.getImpl<Model_Impl>();
+      while (!toLoad.empty()) {
+        const size_t i = toLoad.back();
+        toLoad.pop_back();
+        const ObjectText& objectText = objectTexts[i];
+
+        OptionalIdfObject idfObject = IdfObject::load(std::string(objectText.text), objectText.iddObject);
+        if (!idfObject) {
+          LOG(Error, "Unable to construct IdfObject from text: " << '\n' << objectText.text);
+          continue;
+        }
+        for (unsigned index : idfObject->objectListFields()) {
+          OptionalString target = idfObject->getString(index);
+          if (!target || target->empty()) {
+            continue;
+          }
+          auto it = objectsByHandle.find(toUUID(*target));
+          if ((it != objectsByHandle.end()) && !objectTexts[it->second].loaded && queued.insert(it->second).second) {
+            toLoad.push_back(it->second);
+          }
+        }
+        loadedIndices.push_back(i);
+        objectImplPtrs.push_back(modelImpl->createObject(*idfObject, true));
+      }
+
+      // pointers are resolved against the whole model, so targets loaded earlier are found
+      if (objectImplPtrs.empty()) {
+        return;
+      }
+      if (modelImpl->addObjects(objectImplPtrs, false).empty()) {
+        LOG(Error, "Unable to add " << objectImplPtrs.size() << " lazily loaded objects to the model.");
+        return;
+      }
+      for (size_t i : loadedIndices) {
+        objectTexts[i].loaded = true;
+      }
+    }
+
+  }  // namespace detail
+
+  LazyModel::LazyModel(std::shared_ptr<detail::LazyModel_Impl> impl) : m_impl(std::move(impl)) {}
+
+  boost::optional<LazyModel> LazyModel::load(const path& osmPath) {
+    if (!openstudio::filesystem::is_regular_file(osmPath)) {
+      LOG(Warn, "Path is not a valid file: " << osmPath);
+      return boost::none;
+    }
+
+    auto impl = std::make_shared<detail::LazyModel_Impl>();
+    impl->lazy = impl->index(osmPath);
+    if (!impl->lazy) {
+      impl->text.clear();
+      impl->objectTexts.clear();
+      impl->objectsByType.clear();
+      impl->objectsByHandle.clear();
+
+      openstudio::osversion::VersionTranslator vt;
+      boost::optional<Model> model = vt.loadModel(osmPath);
+      if (!model) {
+        LOG(Warn, "Failed to load model at " << osmPath);
+        return boost::none;
+      }
+      impl->model = *model;
+    }
+    return LazyModel(std::move(impl));
+  }
+
+  bool LazyModel::isLazy() const {
+    return m_impl->lazy;
+  }
+
+  unsigned LazyModel::numObjects() const {
+    if (!m_impl->lazy) {
+      return m_impl->model.numObjects();
+    }
+    return m_impl->objectTexts.size();
+  }
+
+  std::vector<WorkspaceObject> LazyModel::getObjectsByType(const IddObjectType& type) const {
+    if (m_impl->lazy) {
+      auto it = m_impl->objectsByType.find(type);
+      if (it == m_impl->objectsByType.end()) {
+        return {};
+      }
+      m_impl->loadObjects(it->second);
+    }
+    return m_impl->model.getObjectsByType(type);
+  }
+
+  boost::optional<WorkspaceObject> LazyModel::getObject(const Handle& handle) const {
+    if (m_impl->lazy) {
+      auto it = m_impl->objectsByHandle.find(handle);
+      if (it == m_impl->objectsByHandle.end()) {
+        return boost::none;
+      }
+      m_impl->loadObjects({it->second});
+    }
+    return m_impl->model.getObject(handle);
+  }
+
+  Model LazyModel::model() const {
+    return m_impl->model;
+  }
+
+}  // namespace model
+}  // namespace openstudio
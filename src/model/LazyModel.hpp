@@ -0,0 +1,88 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef MODEL_LAZYMODEL_HPP
+#define MODEL_LAZYMODEL_HPP
+
+#include "ModelAPI.hpp"
+#include "Model.hpp"
+
+#include "../utilities/core/Logger.hpp"
+#include "../utilities/core/Path.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace openstudio {
+namespace model {
+
+  namespace detail {
+    class LazyModel_Impl;
+  }  // namespace detail
+
+  /** LazyModel is a read-only view of an OSM file for tools that only need a few object types, e.g. the
+   *  building summary or the weather file. load scans the file once and indexes the text of each object
+   *  by type and handle. An object is only parsed, and added to model() together with the objects it
+   *  points to, when it is first requested through getObjectsByType or getObject.
+   *
+   *  Objects pointing to the loaded ones are not loaded with them, so methods that look for sources,
+   *  e.g. Building::spaces, only see what has been loaded so far. Objects are loaded as written, without
+   *  the name conflict fixes Model::load makes. Files from other OpenStudio versions are translated and
+   *  loaded in full by VersionTranslator. */
+  class MODEL_API LazyModel
+  {
+   public:
+    /** Indexes the OSM at osmPath. Returns boost::none if the file cannot be read. */
+    static boost::optional<LazyModel> load(const path& osmPath);
+
+    /** True if objects are loaded on first access, false if the file was loaded in full. */
+    bool isLazy() const;
+
+    /** Number of objects in the file, not counting the version object. */
+    unsigned numObjects() const;
+
+    /** Returns the objects of type, loading them on first access. */
+    std::vector<WorkspaceObject> getObjectsByType(const IddObjectType& type) const;
+
+    /** Returns the object with handle, loading it on first access. */
+    boost::optional<WorkspaceObject> getObject(const Handle& handle) const;
+
+    /** Returns the objects of type T, loading them on first access. */
+    template <typename T>
+    std::vector<T> getConcreteModelObjects() const {
+      std::vector<T> result;
+      for (const WorkspaceObject& object : getObjectsByType(T::iddObjectType())) {
+        if (boost::optional<T> candidate = object.optionalCast<T>()) {
+          result.push_back(std::move(*candidate));
+        }
+      }
+      return result;
+    }
+
+    /** Returns the object of unique type T, if the file has one. */
+    template <typename T>
+    boost::optional<T> getOptionalUniqueModelObject() const {
+      std::vector<T> objects = getConcreteModelObjects<T>();
+      if (objects.empty()) {
+        return boost::none;
+      }
+      return objects.front();
+    }
+
+    /** The model holding the objects loaded so far. It should not be modified. */
+    Model model() const;
+
+   private:
+    explicit LazyModel(std::shared_ptr<detail::LazyModel_Impl> impl);
+
+    std::shared_ptr<detail::LazyModel_Impl> m_impl;
+
+    REGISTER_LOGGER("openstudio.model.LazyModel");
+  };
+
+}  // namespace model
+}  // namespace openstudio
+
+#endif  // MODEL_LAZYMODEL_HPP
@@ -28,6 +28,7 @@
 #include "ConnectorSplitter.hpp"
 #include "ConnectorSplitter_Impl.hpp"
 #include "Model.hpp"
+#include "Model_Impl.hpp"
 
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/ContainersMove.hpp"
@@ -36,7 +37,10 @@
 #include <utilities/idd/IddEnums.hxx>
 
 #include <algorithm>
+#include <cstdint>
 #include <functional>
+#include <map>
+#include <tuple>
 
 namespace openstudio {
 
@@ -223,8 +227,33 @@ namespace model {
       }
     }
 
-    std::vector<ModelObject> Loop_Impl::demandComponents(const HVACComponent& inletComp, const HVACComponent& outletComp,
-                                                         openstudio::IddObjectType type) const {
+    struct Loop_Impl::ComponentPathCache
+    {
+      // relationshipGeneration() plus the change generation of connections the paths were found at
+      std::uint64_t generation = 0;
+      // keyed by inlet handle, outlet handle and demand side
+      std::map<std::tuple<Handle, Handle, bool>, std::vector<ModelObject>> paths;
+    };
+
+    const std::vector<ModelObject>& Loop_Impl::componentPath(const HVACComponent& inletComp, const HVACComponent& outletComp,
+                                                             bool isDemandComponents) const {
+      // both generations only ever grow, so their sum changes whenever either does
+      std::shared_ptr<Model_Impl> modelImpl = model().getImpl<Model_Impl>();
+      const std::uint64_t generation = modelImpl->relationshipGeneration() + modelImpl->changeGeneration(IddObjectType::OS_Connection);
+      if (!m_componentPathCache) {
+        m_componentPathCache = std::make_shared<ComponentPathCache>();
+        m_componentPathCache->generation = generation;
+      } else if (m_componentPathCache->generation != generation) {
+        m_componentPathCache->paths.clear();
+        m_componentPathCache->generation = generation;
+      }
+
+      auto key = std::make_tuple(inletComp.handle(), outletComp.handle(), isDemandComponents);
+      auto it = m_componentPathCache->paths.find(key);
+      if (it != m_componentPathCache->paths.end()) {
+        return it->second;
+      }
+
       std::vector<HVACComponent> visited;
       visited.push_back(inletComp);
       std::vector<HVACComponent> allPaths;
@@ -232,17 +261,23 @@ namespace model {
       if (inletComp == outletComp) {
         allPaths.push_back(inletComp);
       } else {
-        findModelObjects(outletComp, visited, allPaths, true);
+        findModelObjects(outletComp, visited, allPaths, isDemandComponents);
       }
-      std::vector<ModelObject> modelObjects = std::vector<ModelObject>(allPaths.begin(), allPaths.end());
+
+      return m_componentPathCache->paths.emplace(key, std::vector<ModelObject>(allPaths.begin(), allPaths.end())).first->second;
+    }
+
+    std::vector<ModelObject> Loop_Impl::demandComponents(const HVACComponent& inletComp, const HVACComponent& outletComp,
+                                                         openstudio::IddObjectType type) const {
+      const std::vector<ModelObject>& modelObjects = componentPath(inletComp, outletComp, true);
 
       // Filter modelObjects for type
-      if (type != IddObjectType::Catchall) {
-        modelObjects.erase(
-          std::remove_if(modelObjects.begin(), modelObjects.end(), [&](const auto& mo) -> bool { return mo.iddObjectType() != type; }),
-          modelObjects.end());
+      if (type == IddObjectType::Catchall) {
+        return modelObjects;
       }
-      return modelObjects;
+      std::vector<ModelObject> result;
+      std::copy_if(modelObjects.begin(), modelObjects.end(), std::back_inserter(result), [&](const auto& mo) { return mo.iddObjectType() == type; });
+      return result;
     }
 
     template <typename T>
@@ -304,24 +339,15 @@ namespace model {
 
     std::vector<ModelObject> Loop_Impl::supplyComponents(const HVACComponent& inletComp, const HVACComponent& outletComp,
                                                          openstudio::IddObjectType type) const {
-      std::vector<HVACComponent> visited;
-      visited.push_back(inletComp);
-      std::vector<HVACComponent> allPaths;
-
-      if (inletComp == outletComp) {
-        allPaths.push_back(inletComp);
-      } else {
-        findModelObjects(outletComp, visited, allPaths, false);
-      }
-      std::vector<ModelObject> modelObjects = std::vector<ModelObject>(allPaths.begin(), allPaths.end());
+      const std::vector<ModelObject>& modelObjects = componentPath(inletComp, outletComp, false);
 
       // Filter modelObjects for type
-      if (type != IddObjectType::Catchall) {
-        modelObjects.erase(
-          std::remove_if(modelObjects.begin(), modelObjects.end(), [&](const auto& mo) -> bool { return mo.iddObjectType() != type; }),
-          modelObjects.end());
+      if (type == IddObjectType::Catchall) {
+        return modelObjects;
       }
-      return modelObjects;
+      std::vector<ModelObject> result;
+      std::copy_if(modelObjects.begin(), modelObjects.end(), std::back_inserter(result), [&](const auto& mo) { return mo.iddObjectType() == type; });
+      return result;
     }
 
     std::vector<ModelObject> Loop_Impl::components(const HVACComponent& inletComp, const HVACComponent& outletComp,
@@ -109,6 +109,14 @@ namespace model {
      private:
       REGISTER_LOGGER("openstudio.model.Loop");
 
+      struct ComponentPathCache;
+
+      // all components on the paths from inletComp to outletComp, in the order the depth first search finds them
+      // searches are memoised until an object is added or removed, a pointer field changes or a connection changes
+      const std::vector<ModelObject>& componentPath(const HVACComponent& inletComp, const HVACComponent& outletComp, bool isDemandComponents) const;
+
+      mutable std::shared_ptr<ComponentPathCache> m_componentPathCache;
+
       boost::optional<ModelObject> supplyInletNodeAsModelObject() const;
       boost::optional<ModelObject> supplyOutletNodeAsModelObject() const;
       boost::optional<ModelObject> demandInletNodeAsModelObject() const;
@@ -40,7 +40,7 @@ namespace model {
       OS_ASSERT(idfObject.iddObject().type() == ScheduleDay::iddObjectType());
 
       // connect signals
-      this->ScheduleDay_Impl::onChange.connect<ScheduleDay_Impl, &ScheduleDay_Impl::clearCachedVariables>(this);
+      this->ScheduleDay_Impl::onImmediateChange.connect<ScheduleDay_Impl, &ScheduleDay_Impl::clearCachedVariables>(this);
     }
 
     ScheduleDay_Impl::ScheduleDay_Impl(const openstudio::detail::WorkspaceObject_Impl& other, Model_Impl* model, bool keepHandle)
@@ -48,13 +48,13 @@ namespace model {
       OS_ASSERT(other.iddObject().type() == ScheduleDay::iddObjectType());
 
       // connect signals
-      this->ScheduleDay_Impl::onChange.connect<ScheduleDay_Impl, &ScheduleDay_Impl::clearCachedVariables>(this);
+      this->ScheduleDay_Impl::onImmediateChange.connect<ScheduleDay_Impl, &ScheduleDay_Impl::clearCachedVariables>(this);
     }
 
     ScheduleDay_Impl::ScheduleDay_Impl(const ScheduleDay_Impl& other, Model_Impl* model, bool keepHandle)
       : ScheduleBase_Impl(other, model, keepHandle) {
       // connect signals
-      this->ScheduleDay_Impl::onChange.connect<ScheduleDay_Impl, &ScheduleDay_Impl::clearCachedVariables>(this);
+      this->ScheduleDay_Impl::onImmediateChange.connect<ScheduleDay_Impl, &ScheduleDay_Impl::clearCachedVariables>(this);
     }
 
     std::vector<IdfObject> ScheduleDay_Impl::remove() {
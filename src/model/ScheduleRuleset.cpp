@@ -616,46 +616,97 @@ namespace model {
         }
       }
 
-      unsigned numDates = dates.size();
+      // look each date up in the index of its year
+      std::vector<int> result;
+      result.reserve(dates.size());
+      for (const openstudio::Date& date : dates) {
+        result.push_back(activeRuleIndicesForYear(date.year())[date.dayOfYear() - 1]);
+      }
 
-      // check if each rule contains each date
-      std::vector<ScheduleRule> scheduleRules = this->scheduleRules();
-      unsigned numRules = scheduleRules.size();
-      std::vector<std::vector<bool>> test;
-      for (unsigned i = 0; i < numRules; ++i) {
-        test.push_back(scheduleRules[i].containsDates(dates));
+      return result;
+    }
+
+    const std::vector<int>& ScheduleRuleset_Impl::activeRuleIndicesForYear(int year) const {
+      // rules are separate objects pointing to this one, and their dates depend on the year description
+      // both generations only ever grow, so their sum changes whenever either does
+      std::shared_ptr<Model_Impl> modelImpl = model().getImpl<Model_Impl>();
+      const std::uint64_t generation =
+        modelImpl->changeGeneration(IddObjectType::OS_Schedule_Rule) + modelImpl->changeGeneration(IddObjectType::OS_YearDescription);
+      if (m_cachedActiveRuleIndicesGeneration != generation) {
+        m_cachedActiveRuleIndices.clear();
+        m_cachedActiveRuleIndicesGeneration = generation;
+      }
+
+      auto it = m_cachedActiveRuleIndices.find(year);
+      if (it != m_cachedActiveRuleIndices.end()) {
+        return it->second;
+      }
+
+      const unsigned numDates = openstudio::Date::isLeapYear(year) ? 366 : 365;
+      std::vector<openstudio::Date> dates;
+      dates.reserve(numDates);
+      for (unsigned dayOfYear = 1; dayOfYear <= numDates; ++dayOfYear) {
+        dates.push_back(openstudio::Date::fromDayOfYear(dayOfYear, year));
       }
 
-      // now create result
+      // rules are in priority order, the first rule that contains a date is in effect
+      std::vector<ScheduleRule> scheduleRules = this->scheduleRules();
       std::vector<int> result(numDates, -1);
-      for (unsigned j = 0; j < numDates; ++j) {
-        for (unsigned i = 0; i < numRules; ++i) {
-          if (test[i][j]) {
+      for (unsigned i = 0; i < scheduleRules.size(); ++i) {
+        std::vector<bool> test = scheduleRules[i].containsDates(dates);
+        for (unsigned j = 0; j < numDates; ++j) {
+          if ((result[j] == -1) && test[j]) {
             result[j] = i;
-            break;
           }
         }
       }
 
-      return result;
+      return m_cachedActiveRuleIndices.insert_or_assign(year, std::move(result)).first->second;
     }
 
     std::vector<ScheduleDay> ScheduleRuleset_Impl::getDaySchedules(const openstudio::Date& startDate, const openstudio::Date& endDate) const {
       std::vector<ScheduleDay> result;
       ScheduleDay defaultDaySchedule = this->defaultDaySchedule();
-      std::vector<ScheduleRule> scheduleRules = this->scheduleRules();
+      std::vector<ScheduleDay> ruleDaySchedules;
+      for (const ScheduleRule& scheduleRule : this->scheduleRules()) {
+        ruleDaySchedules.push_back(scheduleRule.daySchedule());
+      }
       std::vector<int> activeRuleIndices = this->getActiveRuleIndices(startDate, endDate);
+      result.reserve(activeRuleIndices.size());
       for (int i : activeRuleIndices) {
         if (i == -1) {
           result.push_back(defaultDaySchedule);
         } else {
-          result.push_back(scheduleRules[i].daySchedule());
+          result.push_back(ruleDaySchedules[i]);
         }
       }
 
       return result;
     }
 
+    std::vector<double> ScheduleRuleset_Impl::annualHourlyValues() const {
+      YearDescription yd = this->model().getUniqueModelObject<YearDescription>();
+      std::vector<ScheduleDay> daySchedules = getDaySchedules(yd.makeDate(MonthOfYear::Jan, 1), yd.makeDate(MonthOfYear::Dec, 31));
+
+      // evaluate each distinct day schedule once, then copy its 24 values to every day it is used
+      std::map<Handle, std::vector<double>> hourlyValues;
+      std::vector<double> result;
+      result.reserve(24 * daySchedules.size());
+      for (const ScheduleDay& daySchedule : daySchedules) {
+        auto it = hourlyValues.find(daySchedule.handle());
+        if (it == hourlyValues.end()) {
+          std::vector<double> values(24);
+          for (int hour = 1; hour <= 24; ++hour) {
+            values[hour - 1] = daySchedule.getValue(openstudio::Time(0, hour, 0, 0));
+          }
+          it = hourlyValues.emplace(daySchedule.handle(), std::move(values)).first;
+        }
+        result.insert(result.end(), it->second.begin(), it->second.end());
+      }
+
+      return result;
+    }
+
     bool ScheduleRuleset_Impl::moveToEnd(ScheduleRule& scheduleRule) {
       std::vector<ScheduleRule> scheduleRules = this->scheduleRules();
       return setScheduleRuleIndex(scheduleRule, scheduleRules.size() - 1);
@@ -794,6 +845,10 @@ namespace model {
     return getImpl<detail::ScheduleRuleset_Impl>()->getDaySchedules(startDate, endDate);
   }
 
+  std::vector<double> ScheduleRuleset::annualHourlyValues() const {
+    return getImpl<detail::ScheduleRuleset_Impl>()->annualHourlyValues();
+  }
+
   bool ScheduleRuleset::moveToEnd(ScheduleRule& scheduleRule) {
     return getImpl<detail::ScheduleRuleset_Impl>()->moveToEnd(scheduleRule);
   }
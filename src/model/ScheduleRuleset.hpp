@@ -158,6 +158,11 @@ namespace model {
     /// Returns a vector of day schedules between start date (inclusive) and end date (inclusive).
     std::vector<ScheduleDay> getDaySchedules(const openstudio::Date& startDate, const openstudio::Date& endDate) const;
 
+    /// Returns the value at the end of each hour of the year described by the model's YearDescription, starting on January 1st,
+    /// 24 values per day (8760 or 8784 values). Each day uses the day schedule returned by getDaySchedules and its getValue.
+    /// Design day, holiday and custom day schedules are not used.
+    std::vector<double> annualHourlyValues() const;
+
     //@}
    protected:
     friend class ScheduleRule;
@@ -9,6 +9,9 @@
 #include "ModelAPI.hpp"
 #include "Schedule_Impl.hpp"
 
+#include <cstdint>
+#include <map>
+
 namespace openstudio {
 
 class Date;
@@ -149,6 +152,9 @@ namespace model {
       /// Returns a vector of day schedules between start date (inclusive) and end date (inclusive).
       std::vector<ScheduleDay> getDaySchedules(const openstudio::Date& startDate, const openstudio::Date& endDate) const;
 
+      /// Returns the value at the end of each hour of the model's year, 24 values per day.
+      std::vector<double> annualHourlyValues() const;
+
       // Moves this rule to the last position. Called in ScheduleRule remove.
       bool moveToEnd(ScheduleRule& scheduleRule);
 
@@ -160,6 +166,13 @@ namespace model {
       REGISTER_LOGGER("openstudio.model.ScheduleRuleset");
 
       boost::optional<ScheduleDay> optionalDefaultDaySchedule() const;
+
+      // index into scheduleRules() of the rule in effect on each day of year, -1 if none
+      // computed once per year, cleared whenever a schedule rule or the year description changes
+      const std::vector<int>& activeRuleIndicesForYear(int year) const;
+
+      mutable std::map<int, std::vector<int>> m_cachedActiveRuleIndices;
+      mutable std::uint64_t m_cachedActiveRuleIndicesGeneration = 0;
     };
 
   }  // namespace detail
@@ -129,6 +129,8 @@
 #include <algorithm>
 #include <cmath>
 #include <iterator>
+#include <thread>
+#include <unordered_set>
 
 #include <fmt/core.h>
 
@@ -965,15 +967,13 @@ namespace model {
       if (sf3ds.empty()) {
         return {};
       }
-      std::vector<std::string> sfNames;
+      std::unordered_set<std::string> sfNames;
       sfNames.reserve(sf3ds.size());
-      std::transform(sf3ds.cbegin(), sf3ds.cend(), std::back_inserter(sfNames), [](const auto& sf3d) { return sf3d.name; });
+      std::transform(sf3ds.cbegin(), sf3ds.cend(), std::inserter(sfNames, sfNames.end()), [](const auto& sf3d) { return sf3d.name; });
       std::vector<Surface> surfaces = this->surfaces();
-      surfaces.erase(std::remove_if(surfaces.begin(), surfaces.end(),
-                                    [&sfNames](const auto& surface) {
-                                      return std::find(sfNames.cbegin(), sfNames.cend(), surface.nameString()) == sfNames.cend();
-                                    }),
-                     surfaces.end());
+      surfaces.erase(
+        std::remove_if(surfaces.begin(), surfaces.end(), [&sfNames](const auto& surface) { return sfNames.count(surface.nameString()) == 0; }),
+        surfaces.end());
       return surfaces;
     }
 
@@ -2398,6 +2398,10 @@ namespace model {
     }
 
     void Space_Impl::intersectSurfaces(Space& other) {
+      intersectSurfaces(other, PrecomputedSurfaceIntersections());
+    }
+
+    void Space_Impl::intersectSurfaces(Space& other, const PrecomputedSurfaceIntersections& precomputed) {
       if (this->handle() == other.handle()) {
         return;
       }
@@ -2457,7 +2461,8 @@ namespace model {
             completedIntersections.insert(intersectionKey);
 
             // number of surfaces in each space will only increase in intersect
-            boost::optional<SurfaceIntersection> intersection = surface.computeIntersection(otherSurface);
+            boost::optional<SurfaceIntersection> intersection =
+              surface.getImpl<detail::Surface_Impl>()->computeIntersection(otherSurface, precomputed);
             if (intersection) {
               std::vector<Surface> newSurfaces1 = intersection->newSurfaces1();
               std::vector<Surface> newSurfaces2 = intersection->newSurfaces2();
@@ -3670,6 +3675,10 @@ namespace model {
   /// @endcond
 
   void intersectSurfaces(std::vector<Space>& t_spaces) {
+    intersectSurfaces(t_spaces, 1u);
+  }
+
+  void intersectSurfaces(std::vector<Space>& t_spaces, unsigned numThreads) {
     std::vector<Space> spaces(t_spaces);
     std::sort(spaces.begin(), spaces.end(), [](const Space& a, const Space& b) -> bool { return a.floorArea() < b.floorArea(); });
 
@@ -3678,13 +3687,30 @@ namespace model {
       bounds.push_back(space.transformation() * space.boundingBox());
     }
 
-    for (unsigned i = 0; i < spaces.size(); ++i) {
-      for (unsigned j = i + 1; j < spaces.size(); ++j) {
-        if (!bounds[i].intersects(bounds[j])) {
-          continue;
+    std::vector<std::pair<unsigned, unsigned>> pairs = intersectingBoundingBoxPairs(bounds);
+
+    if (numThreads == 0) {
+      numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    // Intersect the polygons of every pair of facing surfaces as they are now, in parallel. The serial pass below then
+    // makes the same calls in the same order as without precomputation, and only uses a precomputed intersection if
+    // neither surface has been changed by an earlier intersection.
+    detail::PrecomputedSurfaceIntersections precomputed;
+    if (numThreads > 1) {
+      for (const auto& [i, j] : pairs) {
+        std::vector<Surface> otherSurfaces = spaces[j].surfaces();
+        for (const Surface& surface : spaces[i].surfaces()) {
+          for (const Surface& otherSurface : otherSurfaces) {
+            surface.getImpl<detail::Surface_Impl>()->addPrecomputedIntersection(otherSurface, precomputed);
+          }
         }
-        spaces[i].intersectSurfaces(spaces[j]);
       }
+      detail::Surface_Impl::precomputeIntersections(precomputed, numThreads);
+    }
+
+    for (const auto& [i, j] : pairs) {
+      spaces[i].getImpl<detail::Space_Impl>()->intersectSurfaces(spaces[j], precomputed);
     }
   }
 
@@ -3694,13 +3720,8 @@ namespace model {
       bounds.push_back(space.transformation() * space.boundingBox());
     }
 
-    for (unsigned i = 0; i < spaces.size(); ++i) {
-      for (unsigned j = i + 1; j < spaces.size(); ++j) {
-        if (!bounds[i].intersects(bounds[j])) {
-          continue;
-        }
-        spaces[i].matchSurfaces(spaces[j]);
-      }
+    for (const auto& [i, j] : intersectingBoundingBoxPairs(bounds)) {
+      spaces[i].matchSurfaces(spaces[j]);
     }
   }
 
@@ -660,6 +660,11 @@ namespace model {
   /** Intersect surfaces within spaces. */
   MODEL_API void intersectSurfaces(std::vector<Space>& spaces);
 
+  /** Intersect surfaces within spaces, computing the polygon intersections on up to numThreads threads first (0 means one
+   *  thread per hardware thread). The model is only changed on the calling thread, in the same order as
+   *  intersectSurfaces(spaces), so the result is identical. */
+  MODEL_API void intersectSurfaces(std::vector<Space>& spaces, unsigned numThreads);
+
   /** Match surfaces and sub surfaces within spaces. */
   MODEL_API void matchSurfaces(std::vector<Space>& spaces);
 
@@ -57,6 +57,8 @@ namespace model {
 
   namespace detail {
 
+    struct PrecomputedSurfaceIntersections;
+
     /** Space_Impl is a PlanarSurfaceGroup_Impl that is the implementation class for Space.*/
     class MODEL_API Space_Impl : public PlanarSurfaceGroup_Impl
     {
@@ -464,6 +466,10 @@ namespace model {
       /** Intersect surfaces in this space with those in the other. */
       void intersectSurfaces(Space& other);
 
+      /** Intersect surfaces in this space with those in the other, taking polygon intersections from precomputed where
+       *  possible. The result is the same as intersectSurfaces(other). */
+      void intersectSurfaces(Space& other, const PrecomputedSurfaceIntersections& precomputed);
+
       /** Find surfaces within angular range, specified in degrees and in the site coordinate system, an unset optional means no limit.
         Values for degrees from North are between 0 and 360 and for degrees tilt they are between 0 and 180.
         Note that maxDegreesFromNorth may be less than minDegreesFromNorth,
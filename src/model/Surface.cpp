@@ -66,8 +66,10 @@
 
 #include "../utilities/sql/SqlFile.hpp"
 
+#include <atomic>
 #include <iterator>  // std::make_move_iterator
 #include <numeric>   // std::accumulate
+#include <thread>
 
 using boost::to_upper_copy;
 
@@ -76,6 +78,13 @@ namespace model {
 
   namespace detail {
 
+    namespace {
+
+      // tolerance passed to openstudio::intersect by computeIntersection and precomputeIntersections
+      constexpr double intersectionTol = 0.01;  //  1 cm tolerance
+
+    }  // namespace
+
     Surface_Impl::Surface_Impl(const IdfObject& idfObject, Model_Impl* model, bool keepHandle) : PlanarSurface_Impl(idfObject, model, keepHandle) {
       OS_ASSERT(idfObject.iddObject().type() == Surface::iddObjectType());
     }
@@ -991,38 +1000,41 @@ namespace model {
       return intersection.has_value();
     }
 
-    boost::optional<SurfaceIntersection> Surface_Impl::computeIntersection(Surface& otherSurface) {
-      double tol = 0.01;       //  1 cm tolerance
-      double areaTol = 0.001;  // 10 cm2 tolerance
-
-      constexpr bool extraLogging = false;
-
+    boost::optional<Surface_Impl::IntersectionGeometry> Surface_Impl::intersectionGeometry(const Surface& otherSurface, bool logErrors) const {
       boost::optional<Space> space = this->space();
       boost::optional<Space> otherSpace = otherSurface.space();
 
       if (!space || !otherSpace || space->handle() == otherSpace->handle()) {
-        LOG(Error, "Cannot find spaces for each surface in intersection or surfaces in same space.");
+        if (logErrors) {
+          LOG(Error, "Cannot find spaces for each surface in intersection or surfaces in same space.");
+        }
         return boost::none;
       }
 
       if (!this->subSurfaces().empty() || !otherSurface.subSurfaces().empty()) {
-        LOG(Error, "Subsurfaces are not allowed in intersection");
+        if (logErrors) {
+          LOG(Error, "Subsurfaces are not allowed in intersection");
+        }
         return boost::none;
       }
 
       if (this->adjacentSurface() || otherSurface.adjacentSurface()) {
-        LOG(Error, "Adjacent surfaces are not allowed in intersection");
+        if (logErrors) {
+          LOG(Error, "Adjacent surfaces are not allowed in intersection");
+        }
         return boost::none;
       }
 
+      IntersectionGeometry result;
+
       // goes from local system to building coordinates
-      Transformation spaceTransformation = space->transformation();
-      Transformation otherSpaceTransformation = otherSpace->transformation();
+      result.spaceTransformation = space->transformation();
+      result.otherSpaceTransformation = otherSpace->transformation();
 
       // do the intersection in building coordinates
 
-      Plane plane = spaceTransformation * this->plane();
-      Plane otherPlane = otherSpaceTransformation * otherSurface.plane();
+      Plane plane = result.spaceTransformation * this->plane();
+      Plane otherPlane = result.otherSpaceTransformation * otherSurface.plane();
 
       if (!plane.reverseEqual(otherPlane)) {
         //LOG(Info, "Planes are not reverse equal, intersection of '" << this->name().get() << "' with '" << otherSurface.name().get() << "' fails");
@@ -1030,39 +1042,116 @@ namespace model {
       }
 
       // get vertices in building coordinates
-      std::vector<Point3d> buildingVertices = spaceTransformation * this->vertices();
-      std::vector<Point3d> otherBuildingVertices = otherSpaceTransformation * otherSurface.vertices();
+      std::vector<Point3d> buildingVertices = result.spaceTransformation * this->vertices();
+      std::vector<Point3d> otherBuildingVertices = result.otherSpaceTransformation * otherSurface.vertices();
 
       if ((buildingVertices.size() < 3) || (otherBuildingVertices.size() < 3)) {
-        LOG(Error, "Fewer than 3 vertices, intersection of '" << this->name().get() << "' with '" << otherSurface.name().get() << "' fails");
+        if (logErrors) {
+          LOG(Error, "Fewer than 3 vertices, intersection of '" << this->name().get() << "' with '" << otherSurface.name().get() << "' fails");
+        }
         return boost::none;
       }
 
       // goes from face coordinates of building vertices to building coordinates
-      Transformation faceTransformation;
       Transformation faceTransformationInverse;
       try {
-        faceTransformation = Transformation::alignFace(buildingVertices);
-        faceTransformationInverse = faceTransformation.inverse();
+        result.faceTransformation = Transformation::alignFace(buildingVertices);
+        faceTransformationInverse = result.faceTransformation.inverse();
       } catch (const std::exception&) {
-        LOG(Error, "Cannot compute face transform, intersection of '" << this->name().get() << "' with '" << otherSurface.name().get() << "' fails");
+        if (logErrors) {
+          LOG(Error, "Cannot compute face transform, intersection of '" << this->name().get() << "' with '" << otherSurface.name().get()
+                                                                         << "' fails");
+        }
         return boost::none;
       }
 
       // put building vertices into face coordinates
-      std::vector<Point3d> faceVertices = faceTransformationInverse * buildingVertices;
-      std::vector<Point3d> otherFaceVertices = faceTransformationInverse * otherBuildingVertices;
+      result.faceVertices = faceTransformationInverse * buildingVertices;
+      result.otherFaceVertices = faceTransformationInverse * otherBuildingVertices;
 
       // boost polygon wants vertices in clockwise order, faceVertices must be reversed, otherFaceVertices already CCW
-      std::reverse(faceVertices.begin(), faceVertices.end());
+      std::reverse(result.faceVertices.begin(), result.faceVertices.end());
       //std::reverse(otherFaceVertices.begin(), otherFaceVertices.end());
 
+      return result;
+    }
+
+    void Surface_Impl::addPrecomputedIntersection(const Surface& otherSurface, PrecomputedSurfaceIntersections& precomputed) const {
+      boost::optional<IntersectionGeometry> geometry = intersectionGeometry(otherSurface, false);
+      if (geometry) {
+        PrecomputedSurfaceIntersections::Entry& entry = precomputed.entries[std::make_pair(handle(), otherSurface.handle())];
+        entry.faceVertices = std::move(geometry->faceVertices);
+        entry.otherFaceVertices = std::move(geometry->otherFaceVertices);
+        entry.result.reset();
+      }
+    }
+
+    void Surface_Impl::precomputeIntersections(PrecomputedSurfaceIntersections& precomputed, unsigned numThreads) {
+      std::vector<PrecomputedSurfaceIntersections::Entry*> entries;
+      entries.reserve(precomputed.entries.size());
+      for (auto& [handles, entry] : precomputed.entries) {
+        entries.push_back(&entry);
+      }
+
+      // openstudio::intersect only reads its arguments, so entries can be handed out to threads in any order
+      std::atomic<size_t> next{0};
+      auto work = [&entries, &next]() {
+        for (size_t i = next++; i < entries.size(); i = next++) {
+          entries[i]->result = openstudio::intersect(entries[i]->faceVertices, entries[i]->otherFaceVertices, intersectionTol);
+        }
+      };
+
+      numThreads = std::max(1u, std::min<unsigned>(numThreads, entries.size()));
+      std::vector<std::thread> threads;
+      threads.reserve(numThreads - 1);
+      for (unsigned i = 1; i < numThreads; ++i) {
+        threads.emplace_back(work);
+      }
+      work();
+      for (std::thread& thread : threads) {
+        thread.join();
+      }
+    }
+
+    boost::optional<SurfaceIntersection> Surface_Impl::computeIntersection(Surface& otherSurface) {
+      return computeIntersection(otherSurface, PrecomputedSurfaceIntersections());
+    }
+
+    boost::optional<SurfaceIntersection> Surface_Impl::computeIntersection(Surface& otherSurface,
+                                                                           const PrecomputedSurfaceIntersections& precomputed) {
+      double tol = intersectionTol;
+      double areaTol = 0.001;  // 10 cm2 tolerance
+
+      constexpr bool extraLogging = false;
+
+      boost::optional<IntersectionGeometry> geometry = intersectionGeometry(otherSurface, true);
+      if (!geometry) {
+        return boost::none;
+      }
+
+      boost::optional<Space> space = this->space();
+      boost::optional<Space> otherSpace = otherSurface.space();
+      OS_ASSERT(space && otherSpace);
+
+      const Transformation& spaceTransformation = geometry->spaceTransformation;
+      const Transformation& otherSpaceTransformation = geometry->otherSpaceTransformation;
+      const Transformation& faceTransformation = geometry->faceTransformation;
+      const std::vector<Point3d>& faceVertices = geometry->faceVertices;
+      const std::vector<Point3d>& otherFaceVertices = geometry->otherFaceVertices;
+
       //LOG(Info, "Trying intersection of '" << this->name().get() << "' with '" << otherSurface.name().get());
       if constexpr (extraLogging) {
         Point3dVectorVector tmp{faceVertices, otherFaceVertices};
         LOG(Debug, tmp);
       }
-      boost::optional<IntersectionResult> intersection = openstudio::intersect(faceVertices, otherFaceVertices, tol);
+      boost::optional<IntersectionResult> intersection;
+      auto precomputedIt = precomputed.entries.find(std::make_pair(handle(), otherSurface.handle()));
+      if ((precomputedIt != precomputed.entries.end()) && (precomputedIt->second.faceVertices == faceVertices)
+          && (precomputedIt->second.otherFaceVertices == otherFaceVertices)) {
+        intersection = precomputedIt->second.result;
+      } else {
+        intersection = openstudio::intersect(faceVertices, otherFaceVertices, tol);
+      }
       if (!intersection) {
         //LOG(Info, "No intersection");
         return boost::none;
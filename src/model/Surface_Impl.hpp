@@ -9,6 +9,11 @@
 #include "ModelAPI.hpp"
 #include "PlanarSurface_Impl.hpp"
 
+#include "../utilities/geometry/Intersection.hpp"
+#include "../utilities/geometry/Transformation.hpp"
+
+#include <map>
+
 namespace openstudio {
 class Polygon3d;
 namespace model {
@@ -31,6 +36,21 @@ namespace model {
 
   namespace detail {
 
+    /** Polygon intersections computed ahead of time, possibly on several threads, for pairs of surfaces that are about to be
+     *  intersected. Keyed by the handles of the two surfaces, each entry also holds the polygons it was computed from so that
+     *  Surface_Impl::computeIntersection only uses it if neither surface has changed since. */
+    struct PrecomputedSurfaceIntersections
+    {
+      struct Entry
+      {
+        std::vector<Point3d> faceVertices;
+        std::vector<Point3d> otherFaceVertices;
+        boost::optional<IntersectionResult> result;
+      };
+
+      std::map<std::pair<Handle, Handle>, Entry> entries;
+    };
+
     /** Surface_Impl is a PlanarSurface_Impl that is the implementation class for Surface.*/
     class MODEL_API Surface_Impl : public PlanarSurface_Impl
     {
@@ -201,6 +221,18 @@ namespace model {
       bool intersect(Surface& otherSurface);
       boost::optional<SurfaceIntersection> computeIntersection(Surface& otherSurface);
 
+      /** Same as computeIntersection(otherSurface), but takes the polygon intersection from precomputed if it has a
+       *  valid entry for the two surfaces. */
+      boost::optional<SurfaceIntersection> computeIntersection(Surface& otherSurface, const PrecomputedSurfaceIntersections& precomputed);
+
+      /** Adds an entry for otherSurface to precomputed if computeIntersection(otherSurface) would intersect polygons,
+       *  i.e. if the two surfaces are in different spaces and on the same plane, facing each other. The result is left
+       *  for precomputeIntersections to fill in. */
+      void addPrecomputedIntersection(const Surface& otherSurface, PrecomputedSurfaceIntersections& precomputed) const;
+
+      /** Intersects the polygons of every entry in precomputed, on up to numThreads threads. Does not touch the model. */
+      static void precomputeIntersections(PrecomputedSurfaceIntersections& precomputed, unsigned numThreads);
+
       boost::optional<Surface> createAdjacentSurface(const Space& otherSpace);
 
       bool isPartOfEnvelope() const;
@@ -273,6 +305,19 @@ namespace model {
 
       REGISTER_LOGGER("openstudio.model.Surface");
 
+      // Building coordinates of the two spaces, and face coordinates of this surface, used to intersect with another surface
+      struct IntersectionGeometry
+      {
+        Transformation spaceTransformation;
+        Transformation otherSpaceTransformation;
+        Transformation faceTransformation;
+        std::vector<Point3d> faceVertices;
+        std::vector<Point3d> otherFaceVertices;
+      };
+
+      // Returns none if the surfaces cannot be intersected, logging why at Error level if logErrors
+      boost::optional<IntersectionGeometry> intersectionGeometry(const Surface& otherSurface, bool logErrors) const;
+
       std::vector<ModelObject> subSurfacesAsModelObjects() const;
       boost::optional<ModelObject> adjacentSurfaceAsModelObject() const;
 
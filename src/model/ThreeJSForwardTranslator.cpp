@@ -47,6 +47,7 @@
 #include "../utilities/geometry/Transformation.hpp"
 #include "../utilities/geometry/Geometry.hpp"
 #include "../utilities/geometry/ThreeJS.hpp"
+#include "../utilities/geometry/PointSet.hpp"
 
 #include <thread>
 
@@ -138,19 +139,6 @@ namespace model {
     }
   }
 
-  size_t getVertexIndex(const Point3d& point3d, std::vector<Point3d>& allPoints, double tol = 0.001) {
-    size_t n = allPoints.size();
-    for (size_t i = 0; i < n; ++i) {
-      if (std::sqrt(std::pow(point3d.x() - allPoints[i].x(), 2) + std::pow(point3d.y() - allPoints[i].y(), 2)
-                    + std::pow(point3d.z() - allPoints[i].z(), 2))
-          < tol) {
-        return i;
-      }
-    }
-    allPoints.push_back(point3d);
-    return (allPoints.size() - 1);
-  }
-
   std::string getBoundaryMaterialName(const ThreeUserData& userData) {
     std::string result;
     if (userData.outsideBoundaryCondition() == "Outdoors") {
@@ -350,7 +338,7 @@ namespace model {
       finalFaceVertices.push_back(faceVertices);
     }
 
-    Point3dVector allVertices;
+    PointSet allVertices;
     std::vector<size_t> faceIndices;
     for (const auto& finalFaceVerts : finalFaceVertices) {
       Point3dVector finalVerts = buildingTransformation * t * finalFaceVerts;
@@ -374,14 +362,14 @@ namespace model {
       auto it = finalVerts.rbegin();
       auto itend = finalVerts.rend();
       for (; it != itend; ++it) {
-        faceIndices.push_back(getVertexIndex(*it, allVertices));
+        faceIndices.push_back(allVertices.insert(*it));
       }
 
       // convert to 1 based indices
       //face_indices.each_index {|i| face_indices[i] = face_indices[i] + 1}
     }
 
-    ThreeGeometryData geometryData(toThreeVector(allVertices), faceIndices);
+    ThreeGeometryData geometryData(toThreeVector(allVertices.points()), faceIndices);
 
     ThreeGeometry geometry(toThreeUUID(toString(planarSurface.handle())), "Geometry", geometryData);
     geometries.push_back(geometry);
@@ -0,0 +1,63 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../Model.hpp"
+#include "../LazyModel.hpp"
+#include "../Building.hpp"
+#include "../Building_Impl.hpp"
+#include "../Space.hpp"
+
+#include "../../utilities/core/Path.hpp"
+#include "../../utilities/geometry/Point3d.hpp"
+
+#include <vector>
+
+using namespace openstudio;
+using namespace openstudio::model;
+
+// exampleModel plus n spaces, each with a floor, a roof and four walls
+openstudio::path makeOsm(int64_t nSpaces) {
+  Model m = exampleModel();
+  std::vector<Point3d> floorPrint{{0, 10, 0}, {10, 10, 0}, {10, 0, 0}, {0, 0, 0}};
+  for (int64_t i = 0; i < nSpaces; ++i) {
+    boost::optional<Space> space = Space::fromFloorPrint(floorPrint, 3.0, m);
+    space->setXOrigin(20.0 * static_cast<double>(i));
+  }
+  openstudio::path osmPath = openstudio::tempDir() / openstudio::toPath("LazyModel_Benchmark_" + std::to_string(nSpaces) + ".osm");
+  m.save(osmPath, true);
+  return osmPath;
+}
+
+// time to first query, reading the building from the file
+static void BM_ModelLoadBuilding(benchmark::State& state) {
+  openstudio::path osmPath = makeOsm(state.range(0));
+
+  for (auto _ : state) {
+    boost::optional<Model> m = Model::load(osmPath);
+    boost::optional<Building> building = m->getOptionalUniqueModelObject<Building>();
+    benchmark::DoNotOptimize(building);
+  }
+
+  state.SetComplexityN(state.range(0));
+  openstudio::filesystem::remove(osmPath);
+}
+
+static void BM_LazyModelLoadBuilding(benchmark::State& state) {
+  openstudio::path osmPath = makeOsm(state.range(0));
+
+  for (auto _ : state) {
+    boost::optional<LazyModel> m = LazyModel::load(osmPath);
+    boost::optional<Building> building = m->getOptionalUniqueModelObject<Building>();
+    benchmark::DoNotOptimize(building);
+  }
+
+  state.SetComplexityN(state.range(0));
+  openstudio::filesystem::remove(osmPath);
+}
+
+BENCHMARK(BM_ModelLoadBuilding)->Unit(benchmark::kMillisecond)->RangeMultiplier(8)->Range(8, 4096)->Complexity();
+BENCHMARK(BM_LazyModelLoadBuilding)->Unit(benchmark::kMillisecond)->RangeMultiplier(8)->Range(8, 4096)->Complexity();
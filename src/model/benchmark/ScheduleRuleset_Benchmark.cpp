@@ -0,0 +1,66 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../Model.hpp"
+#include "../ScheduleRuleset.hpp"
+#include "../ScheduleRule.hpp"
+#include "../ScheduleDay.hpp"
+#include "../YearDescription.hpp"
+
+#include "../../utilities/time/Date.hpp"
+#include "../../utilities/time/Time.hpp"
+
+#include <vector>
+
+using namespace openstudio;
+using namespace openstudio::model;
+
+// one rule per month, weekdays and weekends, with an hourly profile on each day schedule
+ScheduleRuleset makeScheduleRuleset(Model& m) {
+  model::YearDescription yd = m.getUniqueModelObject<model::YearDescription>();
+  ScheduleRuleset schedule(m, 0.0);
+  for (unsigned month = 1; month <= 12; ++month) {
+    for (bool weekend : {false, true}) {
+      ScheduleRule rule(schedule);
+      rule.setApplyWeekdays(!weekend);
+      rule.setApplyWeekends(weekend);
+      rule.setStartDate(yd.makeDate(month, 1));
+      rule.setEndDate(yd.makeDate(month, month == 2 ? 28 : (month == 4 || month == 6 || month == 9 || month == 11 ? 30 : 31)));
+      ScheduleDay daySchedule = rule.daySchedule();
+      for (int hour = 1; hour <= 24; ++hour) {
+        daySchedule.addValue(Time(0, hour, 0, 0), month + hour / 24.0);
+      }
+    }
+  }
+  return schedule;
+}
+
+static void BM_ScheduleRulesetGetDaySchedules(benchmark::State& state) {
+  Model m;
+  ScheduleRuleset schedule = makeScheduleRuleset(m);
+  model::YearDescription yd = m.getUniqueModelObject<model::YearDescription>();
+  Date startDate = yd.makeDate(MonthOfYear::Jan, 1);
+  Date endDate = yd.makeDate(MonthOfYear::Dec, 31);
+
+  for (auto _ : state) {
+    std::vector<ScheduleDay> daySchedules = schedule.getDaySchedules(startDate, endDate);
+    benchmark::DoNotOptimize(daySchedules);
+  }
+}
+
+static void BM_ScheduleRulesetAnnualHourlyValues(benchmark::State& state) {
+  Model m;
+  ScheduleRuleset schedule = makeScheduleRuleset(m);
+
+  for (auto _ : state) {
+    std::vector<double> values = schedule.annualHourlyValues();
+    benchmark::DoNotOptimize(values);
+  }
+}
+
+BENCHMARK(BM_ScheduleRulesetGetDaySchedules);
+BENCHMARK(BM_ScheduleRulesetAnnualHourlyValues);
@@ -0,0 +1,100 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../Model.hpp"
+
+#include "../Space.hpp"
+#include "../Space_Impl.hpp"
+#include "../../utilities/geometry/Point3d.hpp"
+#include "../../utilities/core/Assert.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace openstudio;
+using namespace openstudio::model;
+
+// Lays out nSpaces 10x10x3 m boxes on a square grid, on as many stories as needed to keep the
+// footprint at most 16x16 spaces, like a campus of mid-rise buildings. If staggered, every other
+// story is shifted by half a space so that floors and ceilings get split when intersecting.
+model::Model makeModelWithNSpacesOnGrid(size_t nSpaces, bool staggered = false) {
+
+  Model m;
+
+  constexpr double spaceSize = 10.0;
+  constexpr double floorHeight = 3.0;
+  constexpr size_t maxSpacesPerSide = 16;
+
+  size_t spacesPerSide = std::min(maxSpacesPerSide, static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(nSpaces)))));
+  size_t spacesPerStory = spacesPerSide * spacesPerSide;
+
+  for (size_t i = 0; i < nSpaces; ++i) {
+    size_t story = i / spacesPerStory;
+    double offset = (staggered && (story % 2 == 1)) ? 0.5 * spaceSize : 0.0;
+    double x = offset + spaceSize * static_cast<double>(i % spacesPerSide);
+    double y = offset + spaceSize * static_cast<double>((i % spacesPerStory) / spacesPerSide);
+    double z = floorHeight * static_cast<double>(story);
+
+    Point3dVector pts{{x, y, z}, {x, y + spaceSize, z}, {x + spaceSize, y + spaceSize, z}, {x + spaceSize, y, z}};
+    auto space_ = Space::fromFloorPrint(pts, floorHeight, m);
+    OS_ASSERT(space_);
+  }
+
+  OS_ASSERT(m.getConcreteModelObjects<Space>().size() == nSpaces);
+
+  return m;
+}
+
+static void BM_MatchSurfaces(benchmark::State& state) {
+
+  for (auto _ : state) {
+
+    state.PauseTiming();
+    Model m = makeModelWithNSpacesOnGrid(state.range(0));
+    std::vector<Space> spaces = m.getConcreteModelObjects<Space>();
+    state.ResumeTiming();
+
+    matchSurfaces(spaces);
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_IntersectSurfaces(benchmark::State& state) {
+
+  for (auto _ : state) {
+
+    state.PauseTiming();
+    Model m = makeModelWithNSpacesOnGrid(state.range(0));
+    std::vector<Space> spaces = m.getConcreteModelObjects<Space>();
+    state.ResumeTiming();
+
+    intersectSurfaces(spaces);
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+// Speedup of the polygon intersections with the number of threads, given by the benchmark argument, on 1024 spaces
+static void BM_IntersectSurfacesThreads(benchmark::State& state) {
+
+  for (auto _ : state) {
+
+    state.PauseTiming();
+    Model m = makeModelWithNSpacesOnGrid(1024, true);
+    std::vector<Space> spaces = m.getConcreteModelObjects<Space>();
+    state.ResumeTiming();
+
+    intersectSurfaces(spaces, static_cast<unsigned>(state.range(0)));
+  }
+}
+
+BENCHMARK(BM_MatchSurfaces)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(16, 2048)->Complexity();
+
+BENCHMARK(BM_IntersectSurfaces)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(16, 1024)->Complexity();
+
+BENCHMARK(BM_IntersectSurfacesThreads)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
@@ -0,0 +1,75 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "ModelFixture.hpp"
+
+#include "../LazyModel.hpp"
+#include "../Model.hpp"
+#include "../Building.hpp"
+#include "../Building_Impl.hpp"
+#include "../Space.hpp"
+#include "../Space_Impl.hpp"
+#include "../Surface.hpp"
+#include "../Surface_Impl.hpp"
+#include "../ThermalZone.hpp"
+#include "../ThermalZone_Impl.hpp"
+
+#include <utilities/idd/IddEnums.hxx>
+
+using namespace openstudio;
+using namespace openstudio::model;
+
+TEST_F(ModelFixture, LazyModel_Load) {
+  Model model = exampleModel();
+  openstudio::path osmPath = openstudio::tempDir() / openstudio::toPath("LazyModel_Load.osm");
+  ASSERT_TRUE(model.save(osmPath, true));
+
+  boost::optional<LazyModel> lazyModel = LazyModel::load(osmPath);
+  ASSERT_TRUE(lazyModel);
+  EXPECT_TRUE(lazyModel->isLazy());
+  EXPECT_EQ(model.objects().size(), lazyModel->numObjects());
+  EXPECT_TRUE(lazyModel->model().objects().empty());
+
+  // the building comes with the objects it points to, and nothing else
+  boost::optional<Building> building = lazyModel->getOptionalUniqueModelObject<Building>();
+  ASSERT_TRUE(building);
+  EXPECT_EQ(model.getUniqueModelObject<Building>().handle(), building->handle());
+  EXPECT_EQ(model.getUniqueModelObject<Building>().nameString(), building->nameString());
+  unsigned numLoaded = lazyModel->model().objects().size();
+  EXPECT_LT(numLoaded, lazyModel->numObjects());
+  for (const WorkspaceObject& object : lazyModel->model().objects()) {
+    ASSERT_TRUE(model.getObject(object.handle()));
+    EXPECT_EQ(model.getObject(object.handle())->iddObject().type(), object.iddObject().type());
+  }
+
+  // loading again does not duplicate objects
+  EXPECT_TRUE(lazyModel->getOptionalUniqueModelObject<Building>());
+  EXPECT_EQ(numLoaded, lazyModel->model().objects().size());
+
+  // pointers are resolved to the loaded targets
+  std::vector<Space> spaces = lazyModel->getConcreteModelObjects<Space>();
+  EXPECT_EQ(model.getConcreteModelObjects<Space>().size(), spaces.size());
+  for (const Space& space : spaces) {
+    boost::optional<Space> original = model.getModelObject<Space>(space.handle());
+    ASSERT_TRUE(original);
+    ASSERT_TRUE(original->thermalZone());
+    ASSERT_TRUE(space.thermalZone());
+    EXPECT_EQ(original->thermalZone()->handle(), space.thermalZone()->handle());
+  }
+
+  Surface surface = model.getConcreteModelObjects<Surface>().front();
+  boost::optional<WorkspaceObject> object = lazyModel->getObject(surface.handle());
+  ASSERT_TRUE(object);
+  ASSERT_TRUE(object->optionalCast<Surface>());
+  ASSERT_TRUE(object->cast<Surface>().space());
+  EXPECT_EQ(surface.space()->handle(), object->cast<Surface>().space()->handle());
+  EXPECT_FALSE(lazyModel->getObject(openstudio::createUUID()));
+
+  openstudio::filesystem::remove(osmPath);
+
+  EXPECT_FALSE(LazyModel::load(openstudio::tempDir() / openstudio::toPath("LazyModel_DoesNotExist.osm")));
+}
@@ -23,6 +23,10 @@
 #include "../FanConstantVolume.hpp"
 #include "../CoilHeatingElectric.hpp"
 #include "../CoilCoolingDXSingleSpeed.hpp"
+#include "../PlantLoop.hpp"
+#include "../PipeAdiabatic.hpp"
+
+#include <algorithm>
 
 using namespace openstudio::model;
 
@@ -92,3 +96,48 @@ TEST_F(ModelFixture, Loop_DeleteUnitaryVAVChangeoverBypassAirLoopHVAC) {
   inletComponents = airLoopHVAC.supplyComponents(supplyInletNode, supplyOutletNode);
   EXPECT_EQ(3, inletComponents.size());
 }
+
+TEST_F(ModelFixture, Loop_ComponentsFollowTopologyChanges) {
+  // supply and demand components are memoised per loop, make sure changes to the connections are seen
+  Model model = Model();
+  PlantLoop plantLoop(model);
+
+  auto contains = [](const std::vector<ModelObject>& components, const ModelObject& component) {
+    return std::find(components.begin(), components.end(), component) != components.end();
+  };
+
+  std::vector<ModelObject> supplyComponents = plantLoop.supplyComponents();
+  EXPECT_EQ(supplyComponents, plantLoop.supplyComponents());
+  const std::vector<ModelObject> demandComponents = plantLoop.demandComponents();
+  EXPECT_EQ(demandComponents, plantLoop.demandComponents());
+
+  PipeAdiabatic branchPipe(model);
+  EXPECT_FALSE(contains(plantLoop.supplyComponents(), branchPipe));
+  EXPECT_TRUE(plantLoop.addSupplyBranchForComponent(branchPipe));
+  EXPECT_TRUE(contains(plantLoop.supplyComponents(), branchPipe));
+  EXPECT_TRUE(plantLoop.supplyComponent(branchPipe.handle()));
+  EXPECT_EQ(1u, plantLoop.supplyComponents(PipeAdiabatic::iddObjectType()).size());
+
+  PipeAdiabatic outletPipe(model);
+  Node supplyOutletNode = plantLoop.supplyOutletNode();
+  EXPECT_TRUE(outletPipe.addToNode(supplyOutletNode));
+  EXPECT_TRUE(contains(plantLoop.supplyComponents(), outletPipe));
+  EXPECT_EQ(2u, plantLoop.supplyComponents(PipeAdiabatic::iddObjectType()).size());
+  ASSERT_TRUE(outletPipe.plantLoop());
+  EXPECT_EQ(plantLoop, outletPipe.plantLoop().get());
+
+  // demand side was not touched
+  EXPECT_EQ(demandComponents, plantLoop.demandComponents());
+
+  PipeAdiabatic demandPipe(model);
+  EXPECT_TRUE(plantLoop.addDemandBranchForComponent(demandPipe));
+  EXPECT_TRUE(contains(plantLoop.demandComponents(), demandPipe));
+  EXPECT_FALSE(contains(plantLoop.supplyComponents(), demandPipe));
+
+  branchPipe.remove();
+  EXPECT_FALSE(contains(plantLoop.supplyComponents(), branchPipe));
+  EXPECT_EQ(1u, plantLoop.supplyComponents(PipeAdiabatic::iddObjectType()).size());
+
+  EXPECT_TRUE(plantLoop.removeDemandBranchWithComponent(demandPipe));
+  EXPECT_FALSE(contains(plantLoop.demandComponents(), demandPipe));
+}
@@ -128,9 +128,17 @@
 #include "../EnvironmentalImpactFactors_Impl.hpp"
 #include "../ExternalInterface.hpp"
 #include "../ExternalInterface_Impl.hpp"
+#include "../PlantLoop.hpp"
+#include "../PipeAdiabatic.hpp"
+#include "../Node.hpp"
+#include "../ScheduleRuleset.hpp"
+#include "../ScheduleRule.hpp"
+#include "../ScheduleDay.hpp"
 
 #include "../../utilities/core/PathHelpers.hpp"
 #include "../../utilities/data/TimeSeries.hpp"
+#include "../../utilities/geometry/Point3d.hpp"
+#include "../../utilities/geometry/Vector3d.hpp"
 #include "../../utilities/idf/IdfFile.hpp"
 #include "../../utilities/idf/Workspace.hpp"
 #include "../../utilities/idf/WorkspaceObject.hpp"
@@ -144,6 +152,8 @@
 
 #include <boost/algorithm/string/case_conv.hpp>
 
+#include <algorithm>
+
 using namespace openstudio::model;
 using namespace openstudio;
 /*
@@ -1187,3 +1197,160 @@ TEST_F(ModelFixture, Model_load) {
   ASSERT_TRUE(workflowJSON.seedFile());
   EXPECT_EQ(workflowJSON.seedFile().get(), openstudio::toPath("../empty361.osm"));
 }
+
+namespace {
+
+// edits a plant loop and a schedule ruleset, querying the memoised loop components and active rule indices after each edit
+std::vector<std::vector<int>> editLoopAndScheduleRules(Model& model) {
+  std::vector<std::vector<int>> result;
+
+  PlantLoop plantLoop(model);
+  ScheduleRuleset schedule(model, 0.0);
+  model::YearDescription yd = model.getUniqueModelObject<model::YearDescription>();
+  Date jan1 = yd.makeDate(MonthOfYear::Jan, 1);
+  Date dec31 = yd.makeDate(MonthOfYear::Dec, 31);
+  PipeAdiabatic outletPipe(model);
+
+  auto query = [&]() {
+    std::vector<int> indices = schedule.getActiveRuleIndices(jan1, dec31);
+    result.push_back({static_cast<int>(plantLoop.supplyComponents().size()),
+                      static_cast<int>(plantLoop.supplyComponents(PipeAdiabatic::iddObjectType()).size()),
+                      static_cast<int>(plantLoop.demandComponents().size()), outletPipe.plantLoop() ? 1 : 0,
+                      static_cast<int>(std::count(indices.begin(), indices.end(), 0)),
+                      static_cast<int>(std::count(indices.begin(), indices.end(), 1))});
+  };
+  query();
+
+  PipeAdiabatic supplyPipe(model);
+  EXPECT_TRUE(plantLoop.addSupplyBranchForComponent(supplyPipe));
+  query();
+
+  Node supplyOutletNode = plantLoop.supplyOutletNode();
+  EXPECT_TRUE(outletPipe.addToNode(supplyOutletNode));
+  query();
+
+  PipeAdiabatic demandPipe(model);
+  EXPECT_TRUE(plantLoop.addDemandBranchForComponent(demandPipe));
+  query();
+
+  ScheduleRule summerRule(schedule);
+  summerRule.setApplyAllDays(true);
+  EXPECT_TRUE(summerRule.setStartDate(yd.makeDate(MonthOfYear::Jun, 1)));
+  EXPECT_TRUE(summerRule.setEndDate(yd.makeDate(MonthOfYear::Aug, 31)));
+  query();
+
+  ScheduleRule juneRule(schedule);
+  juneRule.setApplyAllDays(true);
+  EXPECT_TRUE(juneRule.setStartDate(yd.makeDate(MonthOfYear::Jun, 15)));
+  EXPECT_TRUE(juneRule.setEndDate(yd.makeDate(MonthOfYear::Jun, 30)));
+  EXPECT_TRUE(schedule.setScheduleRuleIndex(juneRule, 0));
+  query();
+
+  supplyPipe.remove();
+  query();
+
+  EXPECT_TRUE(plantLoop.removeDemandBranchWithComponent(demandPipe));
+  query();
+
+  juneRule.remove();
+  query();
+
+  EXPECT_TRUE(summerRule.setEndDate(yd.makeDate(MonthOfYear::Jun, 30)));
+  query();
+
+  return result;
+}
+
+}  // namespace
+
+TEST_F(ModelFixture, Model_BatchEdit_MemoisedQueries) {
+  // loop components and active schedule rules are memoised, they must follow edits made during a batch edit,
+  // which holds back the change signals until it ends
+  Model eagerModel;
+  std::vector<std::vector<int>> eagerResult = editLoopAndScheduleRules(eagerModel);
+
+  Model batchModel;
+  std::vector<std::vector<int>> batchResult;
+  {
+    Workspace::BatchEdit batchEdit(batchModel);
+    batchResult = editLoopAndScheduleRules(batchModel);
+  }
+  EXPECT_EQ(eagerResult, batchResult);
+
+  // supply components, supply pipes, demand components, outlet pipe on the loop, days of the first rule, days of the second rule
+  ASSERT_EQ(10u, batchResult.size());
+  std::vector<int> supplyPipes;
+  std::vector<int> outletPipeOnLoop;
+  std::vector<int> firstRuleDays;
+  std::vector<int> secondRuleDays;
+  for (const std::vector<int>& row : batchResult) {
+    supplyPipes.push_back(row[1]);
+    outletPipeOnLoop.push_back(row[3]);
+    firstRuleDays.push_back(row[4]);
+    secondRuleDays.push_back(row[5]);
+  }
+  EXPECT_EQ(std::vector<int>({0, 1, 2, 2, 2, 2, 1, 1, 1, 1}), supplyPipes);
+  EXPECT_EQ(std::vector<int>({0, 0, 1, 1, 1, 1, 1, 1, 1, 1}), outletPipeOnLoop);
+  EXPECT_EQ(std::vector<int>({0, 0, 0, 0, 92, 16, 16, 16, 92, 30}), firstRuleDays);
+  EXPECT_EQ(std::vector<int>({0, 0, 0, 0, 0, 76, 76, 76, 0, 0}), secondRuleDays);
+  EXPECT_LT(batchResult[0][0], batchResult[1][0]);
+  EXPECT_LT(batchResult[1][0], batchResult[2][0]);
+  EXPECT_LT(batchResult[2][2], batchResult[3][2]);
+  EXPECT_GT(batchResult[5][0], batchResult[6][0]);
+  EXPECT_GT(batchResult[6][2], batchResult[7][2]);
+}
+
+TEST_F(ModelFixture, Model_BatchEdit_ObjectCaches) {
+  // surfaces and schedule days cache data read from their own fields, reads made during a batch edit must see the
+  // changes made before them even though the change signals are held back
+  Model model;
+  Space space(model);
+  std::vector<Point3d> floorVertices{{0, 0, 0}, {0, 10, 0}, {10, 10, 0}, {10, 0, 0}};
+  Surface surface(floorVertices, model);
+  EXPECT_TRUE(surface.setSpace(space));
+
+  ScheduleDay scheduleDay(model);
+  EXPECT_TRUE(scheduleDay.addValue(Time(0, 24, 0, 0), 1.0));
+
+  // fill the caches
+  EXPECT_EQ(floorVertices, surface.vertices());
+  EXPECT_DOUBLE_EQ(-1.0, surface.outwardNormal().z());
+  EXPECT_DOUBLE_EQ(100.0, surface.grossArea());
+  EXPECT_FALSE(surface.triangulation().empty());
+  EXPECT_EQ(std::vector<double>{1.0}, scheduleDay.values());
+  EXPECT_EQ(1u, scheduleDay.times().size());
+
+  {
+    Workspace::BatchEdit batchEdit(model);
+
+    // turn the floor over and shrink it
+    std::vector<Point3d> roofVertices{{0, 0, 3}, {5, 0, 3}, {5, 5, 3}, {0, 5, 3}};
+    EXPECT_TRUE(surface.setVertices(roofVertices));
+    EXPECT_EQ(roofVertices, surface.vertices());
+    EXPECT_DOUBLE_EQ(1.0, surface.outwardNormal().z());
+    EXPECT_DOUBLE_EQ(25.0, surface.grossArea());
+    EXPECT_DOUBLE_EQ(3.0, -surface.plane().d() / surface.plane().c());
+    for (const std::vector<Point3d>& triangle : surface.triangulation()) {
+      for (const Point3d& point : triangle) {
+        EXPECT_DOUBLE_EQ(3.0, point.z());
+        EXPECT_LE(point.x(), 5.0);
+      }
+    }
+
+    EXPECT_TRUE(scheduleDay.addValue(Time(0, 12, 0, 0), 0.5));
+    EXPECT_EQ(std::vector<double>({0.5, 1.0}), scheduleDay.values());
+    ASSERT_EQ(2u, scheduleDay.times().size());
+    EXPECT_EQ(Time(0, 12, 0, 0), scheduleDay.times()[0]);
+    EXPECT_DOUBLE_EQ(0.5, scheduleDay.getValue(Time(0, 6, 0, 0)));
+
+    scheduleDay.clearValues();
+    EXPECT_TRUE(scheduleDay.values().empty());
+    EXPECT_TRUE(scheduleDay.addValue(Time(0, 24, 0, 0), 2.0));
+    EXPECT_EQ(std::vector<double>{2.0}, scheduleDay.values());
+  }
+
+  // and after it
+  EXPECT_DOUBLE_EQ(25.0, surface.grossArea());
+  EXPECT_DOUBLE_EQ(1.0, surface.outwardNormal().z());
+  EXPECT_EQ(std::vector<double>{2.0}, scheduleDay.values());
+}
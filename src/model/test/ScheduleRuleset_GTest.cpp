@@ -23,6 +23,8 @@
 #include "../../utilities/time/Date.hpp"
 #include "../../utilities/time/Time.hpp"
 
+#include <algorithm>
+
 using namespace openstudio::model;
 using namespace openstudio;
 
@@ -910,6 +912,76 @@ TEST_F(ModelFixture, ScheduleRuleset_resetSpecialDays) {
   EXPECT_EQ(6u, model.getConcreteModelObjects<ScheduleDay>().size());
 }
 
+TEST_F(ModelFixture, ScheduleRuleset_ActiveRuleIndicesFollowRuleChanges) {
+  Model model;
+  model::YearDescription yd = model.getUniqueModelObject<model::YearDescription>();
+  EXPECT_TRUE(yd.setCalendarYear(2024));
+
+  ScheduleRuleset schedule(model, 0.0);
+  Date jan1 = yd.makeDate(MonthOfYear::Jan, 1);
+  Date dec31 = yd.makeDate(MonthOfYear::Dec, 31);
+  std::vector<int> indices = schedule.getActiveRuleIndices(jan1, dec31);
+  ASSERT_EQ(366u, indices.size());
+  EXPECT_EQ(366, std::count(indices.begin(), indices.end(), -1));
+
+  // summer rule
+  ScheduleRule summerRule(schedule);
+  summerRule.setApplyAllDays(true);
+  EXPECT_TRUE(summerRule.setStartDate(yd.makeDate(MonthOfYear::Jun, 1)));
+  EXPECT_TRUE(summerRule.setEndDate(yd.makeDate(MonthOfYear::Aug, 31)));
+  summerRule.daySchedule().addValue(Time(0, 24, 0, 0), 1.0);
+  indices = schedule.getActiveRuleIndices(jan1, dec31);
+  ASSERT_EQ(366u, indices.size());
+  EXPECT_EQ(92, std::count(indices.begin(), indices.end(), 0));
+  EXPECT_EQ(-1, indices[yd.makeDate(MonthOfYear::May, 31).dayOfYear() - 1]);
+  EXPECT_EQ(0, indices[yd.makeDate(MonthOfYear::Jun, 1).dayOfYear() - 1]);
+
+  // changing the rule dates is picked up
+  EXPECT_TRUE(summerRule.setEndDate(yd.makeDate(MonthOfYear::Jun, 30)));
+  indices = schedule.getActiveRuleIndices(jan1, dec31);
+  EXPECT_EQ(30, std::count(indices.begin(), indices.end(), 0));
+
+  // a higher priority rule is picked up
+  ScheduleRule juneRule(schedule);
+  juneRule.setApplyAllDays(true);
+  EXPECT_TRUE(juneRule.setStartDate(yd.makeDate(MonthOfYear::Jun, 15)));
+  EXPECT_TRUE(juneRule.setEndDate(yd.makeDate(MonthOfYear::Jun, 30)));
+  juneRule.daySchedule().addValue(Time(0, 12, 0, 0), 2.0);
+  juneRule.daySchedule().addValue(Time(0, 24, 0, 0), 3.0);
+  EXPECT_TRUE(schedule.setScheduleRuleIndex(juneRule, 0));
+  indices = schedule.getActiveRuleIndices(jan1, dec31);
+  EXPECT_EQ(16, std::count(indices.begin(), indices.end(), 0));
+  EXPECT_EQ(14, std::count(indices.begin(), indices.end(), 1));
+
+  // wrapping around the end of the year
+  indices = schedule.getActiveRuleIndices(yd.makeDate(MonthOfYear::Dec, 31), yd.makeDate(MonthOfYear::Jan, 1));
+  EXPECT_EQ(2u, indices.size());
+
+  // annual values match the day schedules
+  std::vector<double> values = schedule.annualHourlyValues();
+  ASSERT_EQ(8784u, values.size());
+  std::vector<ScheduleDay> daySchedules = schedule.getDaySchedules(jan1, dec31);
+  ASSERT_EQ(366u, daySchedules.size());
+  for (unsigned day = 0; day < 366; ++day) {
+    for (int hour = 1; hour <= 24; ++hour) {
+      EXPECT_EQ(daySchedules[day].getValue(Time(0, hour, 0, 0)), values[24 * day + hour - 1]);
+    }
+  }
+  unsigned june20 = yd.makeDate(MonthOfYear::Jun, 20).dayOfYear() - 1;
+  EXPECT_EQ(2.0, values[24 * june20 + 11]);
+  EXPECT_EQ(3.0, values[24 * june20 + 12]);
+  unsigned june10 = yd.makeDate(MonthOfYear::Jun, 10).dayOfYear() - 1;
+  EXPECT_EQ(1.0, values[24 * june10]);
+
+  // removing a rule is picked up
+  juneRule.remove();
+  indices = schedule.getActiveRuleIndices(jan1, dec31);
+  EXPECT_EQ(30, std::count(indices.begin(), indices.end(), 0));
+  EXPECT_EQ(0, std::count(indices.begin(), indices.end(), 1));
+  values = schedule.annualHourlyValues();
+  EXPECT_EQ(1.0, values[24 * june20 + 11]);
+}
+
 /*
 January
 
@@ -2978,6 +2978,62 @@ TEST_F(ModelFixture, Space_setVolumeAndCeilingHeightAndFloorArea) {
   EXPECT_DOUBLE_EQ(244.0, space.exteriorArea());  // ground does not count
 }
 
+TEST_F(ModelFixture, Space_IntersectSurfaces_Parallel) {
+  // two stories of 10 m x 10 m spaces, the upper one shifted by 5 m in both directions so that every floor and ceiling gets split,
+  // plus a few adjacent spaces of different sizes so that spaces are not all intersected in creation order
+  auto makeModel = []() {
+    Model model;
+    for (unsigned story = 0; story < 2; ++story) {
+      double offset = 5.0 * story;
+      for (unsigned i = 0; i < 3; ++i) {
+        for (unsigned j = 0; j < 3; ++j) {
+          double x = offset + 10.0 * i;
+          double y = offset + 10.0 * j;
+          double width = (i + j == 2) ? 12.0 : 10.0;
+          Point3dVector floorPrint{{x, y + width, 3.0 * story}, {x + width, y + width, 3.0 * story}, {x + width, y, 3.0 * story}, {x, y, 3.0 * story}};
+          boost::optional<Space> space = Space::fromFloorPrint(floorPrint, 3.0, model);
+          EXPECT_TRUE(space);
+        }
+      }
+    }
+    return model;
+  };
+
+  // handles, and so the order of objects in the model, differ between the two models, compare by space name and geometry only
+  auto sortedSpaces = [](const Model& model) {
+    std::vector<Space> spaces = model.getConcreteModelObjects<Space>();
+    std::sort(spaces.begin(), spaces.end(), [](const Space& a, const Space& b) { return a.nameString() < b.nameString(); });
+    return spaces;
+  };
+  auto surfaceVertices = [&sortedSpaces](const Model& model) {
+    std::map<std::string, std::vector<std::vector<Point3d>>> result;
+    for (const Space& space : sortedSpaces(model)) {
+      std::vector<std::vector<Point3d>>& spaceVertices = result[space.nameString()];
+      for (const Surface& surface : space.surfaces()) {
+        spaceVertices.push_back(surface.vertices());
+      }
+      std::sort(spaceVertices.begin(), spaceVertices.end(), [](const std::vector<Point3d>& a, const std::vector<Point3d>& b) {
+        return std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end(), [](const Point3d& p, const Point3d& q) {
+          return std::make_tuple(p.x(), p.y(), p.z()) < std::make_tuple(q.x(), q.y(), q.z());
+        });
+      });
+    }
+    return result;
+  };
+
+  Model serialModel = makeModel();
+  std::vector<Space> serialSpaces = sortedSpaces(serialModel);
+  intersectSurfaces(serialSpaces);
+
+  Model parallelModel = makeModel();
+  std::vector<Space> parallelSpaces = sortedSpaces(parallelModel);
+  intersectSurfaces(parallelSpaces, 4u);
+
+  EXPECT_GT(serialModel.getConcreteModelObjects<Surface>().size(), 18u * 6u);
+  EXPECT_EQ(serialModel.getConcreteModelObjects<Surface>().size(), parallelModel.getConcreteModelObjects<Surface>().size());
+  EXPECT_EQ(surfaceVertices(serialModel), surfaceVertices(parallelModel));
+}
+
 /*****************************************************************************************************************************************************
 *                                                           D I S A B L E D    T E S T S                                                            *
 *****************************************************************************************************************************************************/
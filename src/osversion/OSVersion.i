@@ -36,6 +36,13 @@
 %ignore std::vector<openstudio::osversion::RefactoredObjectData>::resize(size_type);
 %template(RefactoredObjectDataVector) std::vector<openstudio::osversion::RefactoredObjectData>;
 
+%ignore std::vector<openstudio::osversion::FileUpdateResult>::vector(size_type);
+%ignore std::vector<openstudio::osversion::FileUpdateResult>::resize(size_type);
+%template(FileUpdateResultVector) std::vector<openstudio::osversion::FileUpdateResult>;
+
+// std::function is not wrapped
+%ignore openstudio::osversion::VersionTranslator::updateFiles(const std::vector<openstudio::path>&, unsigned, bool, const std::function<void(size_t)>&);
+
 %include <osversion/VersionTranslator.hpp>
 
 #endif // OSVERSION_I
@@ -49,10 +49,12 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cmath>
 #include <iterator>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <string_view>
@@ -78,7 +80,80 @@ namespace osversion {
     return m_newObject;
   }
 
-  VersionTranslator::VersionTranslator() : m_originalVersion("0.0.0"), m_allowNewerVersions(true) {
+  FileUpdateResult::FileUpdateResult(const openstudio::path& path, const VersionString& originalVersion, bool success,
+                                     std::vector<LogMessage> warnings, std::vector<LogMessage> errors)
+    : m_path(path), m_originalVersion(originalVersion), m_success(success), m_warnings(std::move(warnings)), m_errors(std::move(errors)) {}
+
+  openstudio::path FileUpdateResult::path() const {
+    return m_path;
+  }
+
+  VersionString FileUpdateResult::originalVersion() const {
+    return m_originalVersion;
+  }
+
+  bool FileUpdateResult::success() const {
+    return m_success;
+  }
+
+  std::vector<LogMessage> FileUpdateResult::warnings() const {
+    return m_warnings;
+  }
+
+  std::vector<LogMessage> FileUpdateResult::errors() const {
+    return m_errors;
+  }
+
+  namespace {
+
+    // translates one file with its own translator, so that the messages collected are only about this file
+    FileUpdateResult updateFile(const openstudio::path& p, bool keepOriginal) {
+      const std::string logChannel("openstudio.osversion.VersionTranslator");
+      VersionTranslator translator;
+      std::vector<LogMessage> errors;
+      bool success = false;
+      // keep the extension, save enforces it
+      const openstudio::path tempPath = p.parent_path() / toPath(toString(p.stem()) + ".update" + toString(p.extension()));
+      try {
+        boost::optional<model::Model> model;
+        if (getFileExtension(p) == componentFileExtension()) {
+          if (boost::optional<model::Component> component = translator.loadComponent(p)) {
+            model = *component;
+          }
+        } else {
+          model = translator.loadModel(p);
+        }
+
+        if (model) {
+          if (keepOriginal) {
+            openstudio::filesystem::copy_file(p, toPath(toString(p) + ".orig"), openstudio::filesystem::copy_options::overwrite_existing);
+          }
+          if (model->save(tempPath, true)) {
+            openstudio::filesystem::rename(tempPath, p);
+            success = true;
+          } else {
+            errors.emplace_back(Error, logChannel, "Could not write the updated file to '" + toString(tempPath) + "'.");
+            boost::system::error_code ec;
+            openstudio::filesystem::remove(tempPath, ec);
+          }
+        }
+      } catch (const std::exception& e) {
+        errors.emplace_back(Error, logChannel, e.what());
+        boost::system::error_code ec;
+        openstudio::filesystem::remove(tempPath, ec);
+      }
+
+      std::vector<LogMessage> translatorErrors = translator.errors();
+      errors.insert(errors.begin(), translatorErrors.begin(), translatorErrors.end());
+      if (!success && errors.empty()) {
+        errors.emplace_back(Error, logChannel, "Could not read '" + toString(p) + "'.");
+      }
+      return {p, translator.originalVersion(), success, translator.warnings(), std::move(errors)};
+    }
+
+  }  // namespace
+
+  VersionTranslator::VersionTranslator() : m_originalVersion("0.0.0"), m_allowNewerVersions(true), m_skipUnchangedVersions(true) {
     m_logSink.setLogLevel(Warn);
     m_logSink.setChannelRegex(boost::regex("openstudio\\.osversion\\.VersionTranslator"));
     m_logSink.setThreadId(std::this_thread::get_id());
@@ -147,6 +222,37 @@ namespace osversion {
     m_updateMethods[VersionString("3.9.0")] = &VersionTranslator::update_3_8_0_to_3_9_0;
     // m_updateMethods[VersionString("3.9.0")] = &VersionTranslator::defaultUpdate;
 
+    // Object types touched by the update methods that print every other object unchanged and add nothing else. Files
+    // with none of these objects skip the method. Only list a method here after checking that this holds for all of
+    // it, methods that are not listed always run.
+    m_updateObjectTypes[VersionString("0.7.2")] = {"OS:WeatherFile", "OS:Construction:WindowDataFile", "OS:Luminaire:Definition"};
+    m_updateObjectTypes[VersionString("0.7.3")] = {"OS:PlantLoop"};
+    m_updateObjectTypes[VersionString("0.10.0")] = {"OS:RadianceParameters"};
+    m_updateObjectTypes[VersionString("1.0.2")] = {"OS:Boiler:HotWater"};
+    m_updateObjectTypes[VersionString("1.0.3")] = {"OS:RadianceParameters"};
+    m_updateObjectTypes[VersionString("1.3.5")] = {"OS:Refrigeration:WalkIn"};
+    m_updateObjectTypes[VersionString("1.5.4")] = {"OS:TimeDependentValuation"};
+    m_updateObjectTypes[VersionString("1.7.2")] = {"OS:EvaporativeCooler:Direct:ResearchSpecial", "OS:EvaporativeCooler:Indirect:ResearchSpecial"};
+    m_updateObjectTypes[VersionString("1.8.5")] = {"OS:SetpointManager:Scheduled", "OS:PlantLoop"};
+    m_updateObjectTypes[VersionString("1.9.0")] = {"OS:SpaceInfiltration:EffectiveLeakageArea"};
+    m_updateObjectTypes[VersionString("1.9.5")] = {"OS:Controller:WaterCoil"};
+    m_updateObjectTypes[VersionString("1.10.0")] = {"OS:AirTerminal:SingleDuct:VAV:Reheat", "OS:AirTerminal:SingleDuct:VAV:NoReheat"};
+    m_updateObjectTypes[VersionString("1.10.6")] = {"OS:PlantLoop"};
+    m_updateObjectTypes[VersionString("1.11.4")] = {"OS:Coil:Heating:Water:Baseboard"};
+    m_updateObjectTypes[VersionString("1.11.5")] = {"OS:Coil:Heating:DX:SingleSpeed"};
+    m_updateObjectTypes[VersionString("1.12.1")] = {"OS:Meter"};
+    m_updateObjectTypes[VersionString("1.12.4")] = {"OS:AirTerminal:SingleDuct:VAV:Reheat"};
+    m_updateObjectTypes[VersionString("2.1.1")] = {"OS:WaterHeater:Stratified", "OS:HeatPump:WaterToWater:EquationFit:Heating",
+                                                   "OS:HeatPump:WaterToWater:EquationFit:Cooling"};
+    m_updateObjectTypes[VersionString("2.1.2")] = {"OS:PlantLoop", "OS:ZoneHVAC:FourPipeFanCoil"};
+    m_updateObjectTypes[VersionString("2.5.0")] = {"OS:AirflowNetworkZone"};
+    m_updateObjectTypes[VersionString("2.6.2")] = {"OS:EvaporativeCooler:Direct:ResearchSpecial", "OS:ZoneHVAC:EquipmentList"};
+    m_updateObjectTypes[VersionString("2.7.1")] = {"OS:Sizing:System"};
+    m_updateObjectTypes[VersionString("3.2.1")] = {"OS:WaterHeater:Mixed", "OS:WaterHeater:Stratified"};
+    m_updateObjectTypes[VersionString("3.5.1")] = {"OS:UnitarySystemPerformance:Multispeed"};
+    m_updateObjectTypes[VersionString("3.6.0")] = {"OS:GroundHeatExchanger:HorizontalTrench"};
+    m_updateObjectTypes[VersionString("3.9.0")] = {"OS:Controller:OutdoorAir"};
+
     // List of previous versions that may be updated to this one.
     //   - To increment the translator, add an entry for the version just released (branched for
     //     release).
@@ -237,6 +343,47 @@ namespace osversion {
     return boost::none;
   }
 
+  std::vector<FileUpdateResult> VersionTranslator::updateFiles(const std::vector<openstudio::path>& paths, unsigned numThreads, bool keepOriginal) {
+    return updateFiles(paths, numThreads, keepOriginal, {});
+  }
+
+  std::vector<FileUpdateResult> VersionTranslator::updateFiles(const std::vector<openstudio::path>& paths, unsigned numThreads, bool keepOriginal,
+                                                               const std::function<void(size_t)>& fileStarted) {
+    if (numThreads == 0) {
+      numThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    numThreads = static_cast<unsigned>(std::min<size_t>(numThreads, paths.size()));
+
+    std::vector<boost::optional<FileUpdateResult>> results(paths.size());
+    std::atomic<size_t> next(0);
+    std::mutex fileStartedMutex;
+    auto work = [&paths, &results, &next, &fileStarted, &fileStartedMutex, keepOriginal]() {
+      for (size_t i = next++; i < paths.size(); i = next++) {
+        if (fileStarted) {
+          std::lock_guard<std::mutex> lock(fileStartedMutex);
+          fileStarted(i);
+        }
+        results[i] = updateFile(paths[i], keepOriginal);
+      }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned i = 1; i < numThreads; ++i) {
+      threads.emplace_back(work);
+    }
+    work();
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+
+    std::vector<FileUpdateResult> result;
+    result.reserve(results.size());
+    for (boost::optional<FileUpdateResult>& fileResult : results) {
+      result.push_back(std::move(*fileResult));
+    }
+    return result;
+  }
+
   VersionString VersionTranslator::originalVersion() const {
     return m_originalVersion;
   }
@@ -277,6 +424,14 @@ namespace osversion {
     m_allowNewerVersions = allowNewerVersions;
   }
 
+  bool VersionTranslator::skipUnchangedVersions() const {
+    return m_skipUnchangedVersions;
+  }
+
+  void VersionTranslator::setSkipUnchangedVersions(bool skipUnchangedVersions) {
+    m_skipUnchangedVersions = skipUnchangedVersions;
+  }
+
   boost::optional<model::Model> VersionTranslator::updateVersion(std::istream& is, bool isComponent, ProgressBar* progressBar) {
     m_originalVersion = VersionString("0.0.0");
     m_map.clear();
@@ -481,6 +636,13 @@ namespace osversion {
     auto start = m_map.find(startVersion);
     if (start != m_map.end()) {
 
+      std::set<std::string> objectTypes;
+      if (m_skipUnchangedVersions) {
+        for (const IdfObject& object : start->second.objects()) {
+          objectTypes.insert(object.iddObject().name());
+        }
+      }
+
       std::string translatedIdf;
       VersionString lastVersion("0.0.0");
       boost::optional<IddFileAndFactoryWrapper> oIddFile;
@@ -489,8 +651,19 @@ namespace osversion {
         OS_ASSERT(lastVersion < it->first);
         lastVersion = it->first;
         if (startVersion < it->first) {
-          oIddFile = getIddFile(it->first);
-          translatedIdf = it->second(this, start->second, *oIddFile);
+          // go straight to the version before the next method that changes something, objects are printed as is until then
+          auto skipEnd = it;
+          while (m_skipUnchangedVersions && (skipEnd != itEnd) && !updateChangesObjects(skipEnd->first, objectTypes)) {
+            lastVersion = skipEnd->first;
+            ++skipEnd;
+          }
+          oIddFile = getIddFile(lastVersion);
+          if (skipEnd == it) {
+            translatedIdf = it->second(this, start->second, *oIddFile);
+          } else {
+            LOG(Debug, "No object changes from " << startVersion.str() << " to " << lastVersion.str() << ", skipping the update methods in between.");
+            translatedIdf = defaultUpdate(start->second, *oIddFile);
+          }
           break;
         }
       }
@@ -518,11 +691,21 @@ namespace osversion {
       if (m_isComponent) {
         updateComponentData(idfFile);
       }
+      // only the file being translated is kept, earlier versions are not needed anymore
+      m_map.erase(start);
       m_map[oIdfFile->version()] = idfFile;
       LOG(Debug, "Translation to " << lastVersion.str() << " model has " << oIdfFile->numObjects() << " objects.");
     }
   }
 
+  bool VersionTranslator::updateChangesObjects(const VersionString& version, const std::set<std::string>& objectTypes) const {
+    auto it = m_updateObjectTypes.find(version);
+    if (it == m_updateObjectTypes.end()) {
+      return true;
+    }
+    return std::any_of(it->second.begin(), it->second.end(), [&objectTypes](const std::string& type) { return objectTypes.count(type) > 0; });
+  }
+
   void VersionTranslator::updateComponentData(IdfFile& idfFile) {
     if (OptionalIddObject oIddObject = idfFile.iddFile().getObject("OS:ComponentData")) {
       auto compDatas = idfFile.getObjectsByType(*oIddObject);
@@ -23,6 +23,7 @@
 
 #include <boost/functional.hpp>
 
+#include <functional>
 #include <map>
 #include <istream>
 #include <string>
@@ -51,6 +52,33 @@ namespace osversion {
     IdfObject m_newObject;
   };
 
+  /** Outcome of updating one file with VersionTranslator::updateFiles */
+  class OSVERSION_API FileUpdateResult
+  {
+   public:
+    FileUpdateResult(const openstudio::path& path, const VersionString& originalVersion, bool success, std::vector<LogMessage> warnings,
+                     std::vector<LogMessage> errors);
+
+    openstudio::path path() const;
+
+    /** Version of the file before the update, 0.0.0 if it could not be read. */
+    VersionString originalVersion() const;
+
+    /** True if the file was updated and written back. */
+    bool success() const;
+
+    std::vector<LogMessage> warnings() const;
+
+    std::vector<LogMessage> errors() const;
+
+   private:
+    openstudio::path m_path;
+    VersionString m_originalVersion;
+    bool m_success;
+    std::vector<LogMessage> m_warnings;
+    std::vector<LogMessage> m_errors;
+  };
+
   /** This class updates OpenStudio Models and Components to the latest version of OpenStudio. It
  *  must be maintained to keep everything working. The developer who is wrapping up the current
  *  release and starting the next one should:
@@ -112,6 +140,18 @@ namespace osversion {
     /** \overload */
     boost::optional<model::Component> loadComponent(std::istream& is, ProgressBar* progressBar = nullptr);
 
+    /** Updates the osm and osc files at paths in place, translating up to numThreads files at once. If numThreads is 0,
+   *  one file per hardware thread is translated at once. Each file is translated by its own VersionTranslator, they
+   *  all share the IddFiles of the IddFactory. The updated file is written next to the original and then renamed over
+   *  it, so a file is either fully updated or left as is. If keepOriginal is true, the original file is first copied
+   *  to the same path with .orig appended. Results are returned in the order of paths. */
+    static std::vector<FileUpdateResult> updateFiles(const std::vector<openstudio::path>& paths, unsigned numThreads = 0,
+                                                     bool keepOriginal = false);
+
+    /** \overload fileStarted is called with the index in paths of each file as its update starts, one call at a time. */
+    static std::vector<FileUpdateResult> updateFiles(const std::vector<openstudio::path>& paths, unsigned numThreads, bool keepOriginal,
+                                                     const std::function<void(size_t)>& fileStarted);
+
     //@}
     /** @name Queries
    *
@@ -151,6 +191,14 @@ namespace osversion {
     /** Set whether or not loading newer versions is allowed. */
     void setAllowNewerVersions(bool allowNewerVersions);
 
+    /** Returns true if consecutive update steps that would not change any object in the file are merged
+   *  into a single step. Defaults to true. */
+    bool skipUnchangedVersions() const;
+
+    /** Set whether or not update steps that would not change any object in the file are merged. Turning
+   *  this off runs every update step in turn, which is only useful for comparison and debugging. */
+    void setSkipUnchangedVersions(bool skipUnchangedVersions);
+
     //@}
    private:
     REGISTER_LOGGER("openstudio.osversion.VersionTranslator");
@@ -159,8 +207,13 @@ namespace osversion {
     std::map<VersionString, OSVersionUpdater> m_updateMethods;
     std::vector<VersionString> m_startVersions;
 
+    // Object types changed by the update method to a version. Methods listed here print every other object
+    // as is, so they can be skipped for files that have none of these objects.
+    std::map<VersionString, std::set<std::string>> m_updateObjectTypes;
+
     VersionString m_originalVersion;
     bool m_allowNewerVersions;
+    bool m_skipUnchangedVersions;
     std::map<VersionString, IdfFile> m_map;
     StringStreamLogSink m_logSink;
     std::vector<IdfObject> m_deprecated, m_untranslated, m_new;
@@ -179,6 +232,9 @@ namespace osversion {
 
     void update(const VersionString& startVersion);
 
+    /** Returns false if the update method to version is known to print every object of a file with objectTypes as is. */
+    bool updateChangesObjects(const VersionString& version, const std::set<std::string>& objectTypes) const;
+
     /** Deletes handles from m_untranslated and m_deprecated, and adds handles from m_new */
     void updateComponentData(IdfFile& idfFile);
 
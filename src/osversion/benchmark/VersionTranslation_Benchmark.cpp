@@ -8,27 +8,97 @@
 #include "../VersionTranslator.hpp"
 #include "../../model/Model.hpp"
 #include "../../utilities/core/Filesystem.hpp"
+#include "../../utilities/core/PathHelpers.hpp"
 
 #include <resources.hxx>
 
 #include <OpenStudio.hxx>
 
+#include <string>
+#include <vector>
+
+#if !defined(_WIN32)
+#  include <sys/resource.h>
+#endif
+
 using namespace openstudio;
 
+// peak resident set size of the process so far in bytes, only meaningful when running a single case with --benchmark_filter
+static double peakRSS() {
+#if defined(_WIN32)
+  return 0.0;
+#else
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+#  if defined(__APPLE__)
+  return static_cast<double>(usage.ru_maxrss);
+#  else
+  return static_cast<double>(usage.ru_maxrss) * 1024.0;
+#  endif
+#endif
+}
+
 static void BM_VT(benchmark::State& state, const std::string& testCase) {
 
   path modelPath = resourcesPath() / toPath(testCase);
+  const bool skipUnchangedVersions = (state.range(0) != 0);
 
   for (auto _ : state) {
     osversion::VersionTranslator translator;
+    translator.setSkipUnchangedVersions(skipUnchangedVersions);
     model::OptionalModel result = translator.loadModel(modelPath);
   }
+
+  state.counters["PeakRSS"] = benchmark::Counter(peakRSS(), benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+}
+
+BENCHMARK_CAPTURE(BM_VT, example_1_13_4, std::string("osversion/1_13_4/example.osm"))->ArgName("skip")->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_VT, example_1_14_0, std::string("osversion/1_14_0/example.osm"))->ArgName("skip")->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_VT, Windows_Complete, std::string("model/7-7_Windows_Complete.osm"))->ArgName("skip")->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_VT, Model12, std::string("model/15023_Model12.osm"))->ArgName("skip")->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_VT, floorplan_school, std::string("model/floorplan_school.osm"))->ArgName("skip")->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_VT, CONTAMTemplate, std::string("contam/CONTAMTemplate.osm"))->ArgName("skip")->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_VT, seb, std::string("Examples/compact_osw/files/seb.osm"))
+  ->ArgName("skip")
+  ->Arg(0)
+  ->Arg(1)
+  ->Unit(benchmark::kMillisecond);
+
+// files per second when updating a batch of copies of the same model, against the number of threads
+static void BM_VTUpdateFiles(benchmark::State& state, const std::string& testCase) {
+
+  path modelPath = resourcesPath() / toPath(testCase);
+  path outDir = tempDir() / toPath("BM_VTUpdateFiles");
+  const auto numThreads = static_cast<unsigned>(state.range(0));
+  constexpr int numFiles = 32;
+
+  std::vector<path> paths;
+  for (int i = 0; i < numFiles; ++i) {
+    paths.push_back(outDir / toPath("model_" + std::to_string(i) + ".osm"));
+  }
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    if (openstudio::filesystem::exists(outDir)) {
+      removeDirectory(outDir);
+    }
+    openstudio::filesystem::create_directories(outDir);
+    for (const path& p : paths) {
+      openstudio::filesystem::copy_file(modelPath, p);
+    }
+    state.ResumeTiming();
+
+    std::vector<osversion::FileUpdateResult> results = osversion::VersionTranslator::updateFiles(paths, numThreads);
+    benchmark::DoNotOptimize(results);
+  }
+
+  state.counters["files"] = benchmark::Counter(numFiles, benchmark::Counter::kIsIterationInvariantRate);
+  removeDirectory(outDir);
 }
 
-BENCHMARK_CAPTURE(BM_VT, example_1_13_4, std::string("osversion/1_13_4/example.osm"))->Unit(benchmark::kMillisecond);
-BENCHMARK_CAPTURE(BM_VT, example_1_14_0, std::string("osversion/1_14_0/example.osm"))->Unit(benchmark::kMillisecond);
-BENCHMARK_CAPTURE(BM_VT, Windows_Complete, std::string("model/7-7_Windows_Complete.osm"))->Unit(benchmark::kMillisecond);
-BENCHMARK_CAPTURE(BM_VT, Model12, std::string("model/15023_Model12.osm"))->Unit(benchmark::kMillisecond);
-BENCHMARK_CAPTURE(BM_VT, floorplan_school, std::string("model/floorplan_school.osm"))->Unit(benchmark::kMillisecond);
-BENCHMARK_CAPTURE(BM_VT, CONTAMTemplate, std::string("contam/CONTAMTemplate.osm"))->Unit(benchmark::kMillisecond);
-BENCHMARK_CAPTURE(BM_VT, seb, std::string("Examples/compact_osw/files/seb.osm"))->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_VTUpdateFiles, example_1_13_4, std::string("osversion/1_13_4/example.osm"))
+  ->ArgName("threads")
+  ->RangeMultiplier(2)
+  ->Range(1, 8)
+  ->UseRealTime()
+  ->Unit(benchmark::kMillisecond);
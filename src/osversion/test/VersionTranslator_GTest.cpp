@@ -23,6 +23,7 @@
 #include "../../model/Version_Impl.hpp"
 
 #include "../../utilities/core/StringHelpers.hpp"
+#include "../../utilities/core/PathHelpers.hpp"
 
 #include "../../utilities/idf/IdfObject.hpp"
 #include "../../utilities/idf/WorkspaceObject.hpp"
@@ -372,6 +373,96 @@ TEST_F(OSVersionFixture, VersionTranslator_FutureVersion_ExampleModel2) {
   m2 = translator.loadModel(ss);
   EXPECT_FALSE(m2);
 }
+
+TEST_F(OSVersionFixture, VersionTranslator_SkipUnchangedVersions) {
+  openstudio::path modelPath = resourcesPath() / toPath("osversion/1_13_4/example.osm");
+
+  osversion::VersionTranslator translator;
+  EXPECT_TRUE(translator.skipUnchangedVersions());
+  model::OptionalModel skipped = translator.loadModel(modelPath);
+  ASSERT_TRUE(skipped);
+  EXPECT_TRUE(translator.errors().empty());
+  const size_t nNew = translator.newObjects().size();
+  const size_t nRefactored = translator.refactoredObjects().size();
+
+  translator.setSkipUnchangedVersions(false);
+  EXPECT_FALSE(translator.skipUnchangedVersions());
+  model::OptionalModel stepped = translator.loadModel(modelPath);
+  ASSERT_TRUE(stepped);
+  EXPECT_TRUE(translator.errors().empty());
+  EXPECT_EQ(nNew, translator.newObjects().size());
+  EXPECT_EQ(nRefactored, translator.refactoredObjects().size());
+
+  // going through every version or skipping the ones that change nothing gives the same model, objects created by the
+  // update methods get new handles in each run so they are only counted
+  ASSERT_EQ(stepped->numObjects(), skipped->numObjects());
+  for (const WorkspaceObject& object : stepped->objects()) {
+    EXPECT_EQ(stepped->getObjectsByType(object.iddObject()).size(), skipped->getObjectsByType(object.iddObject()).size()) << object;
+    boost::optional<WorkspaceObject> other = skipped->getObject(object.handle());
+    if (!other || (object.iddObject().type() == IddObjectType::OS_Version)) {
+      continue;
+    }
+    ASSERT_EQ(object.numFields(), other->numFields()) << object;
+    for (unsigned i = 1; i < object.numFields(); ++i) {
+      boost::optional<WorkspaceObject> target = object.getTarget(i);
+      if (target) {
+        boost::optional<WorkspaceObject> otherTarget = other->getTarget(i);
+        ASSERT_TRUE(otherTarget) << object;
+        EXPECT_EQ(target->iddObject().type(), otherTarget->iddObject().type()) << object;
+        EXPECT_EQ(target->nameString(), otherTarget->nameString()) << object;
+      } else {
+        EXPECT_EQ(object.getString(i), other->getString(i)) << object;
+      }
+    }
+  }
+}
+
+TEST_F(OSVersionFixture, VersionTranslator_UpdateFiles) {
+  openstudio::path modelPath = resourcesPath() / toPath("osversion/1_13_4/example.osm");
+
+  openstudio::path outDir = openstudio::tempDir() / toPath("VersionTranslator_UpdateFiles");
+  if (exists(outDir)) {
+    removeDirectory(outDir);
+  }
+  openstudio::filesystem::create_directories(outDir);
+
+  std::vector<openstudio::path> paths;
+  for (int i = 0; i < 6; ++i) {
+    paths.push_back(outDir / toPath("example_" + std::to_string(i) + ".osm"));
+    openstudio::filesystem::copy_file(modelPath, paths.back());
+  }
+  openstudio::path badPath = outDir / toPath("bad.osm");
+  {
+    openstudio::filesystem::ofstream file(badPath);
+    file << "not a model";
+  }
+  paths.insert(paths.begin() + 3, badPath);
+  paths.push_back(outDir / toPath("missing.osm"));
+
+  std::vector<FileUpdateResult> results = osversion::VersionTranslator::updateFiles(paths, 3, true);
+  ASSERT_EQ(paths.size(), results.size());
+  for (size_t i = 0; i < paths.size(); ++i) {
+    EXPECT_EQ(paths[i], results[i].path());
+    if ((paths[i] == badPath) || (i == paths.size() - 1)) {
+      EXPECT_FALSE(results[i].success());
+      EXPECT_FALSE(results[i].errors().empty());
+      continue;
+    }
+    EXPECT_TRUE(results[i].success());
+    EXPECT_TRUE(results[i].errors().empty());
+    EXPECT_EQ(VersionString("1.13.4"), results[i].originalVersion());
+
+    // updated in place, original kept next to it and no temporary file left behind
+    EXPECT_TRUE(exists(toPath(toString(paths[i]) + ".orig")));
+    EXPECT_FALSE(exists(outDir / toPath(toString(paths[i].stem()) + ".update.osm")));
+    boost::optional<model::Model> model = model::Model::load(paths[i]);
+    ASSERT_TRUE(model);
+    EXPECT_EQ(VersionString(openStudioVersion()), model->version());
+  }
+
+  // the bad file is left as is
+  EXPECT_FALSE(exists(toPath(toString(badPath) + ".orig")));
+}
 /*
 TEST_F(OSVersionFixture,VersionTranslator_0_7_4_NameRefsTranslated) {
   // Translator adds handle fields, but leaves initial name references as-is.
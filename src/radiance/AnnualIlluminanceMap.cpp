@@ -6,23 +6,156 @@
 #include "AnnualIlluminanceMap.hpp"
 #include "HeaderInfo.hpp"
 
-#include <iostream>
-#include <fstream>
+#include "../utilities/core/Filesystem.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
 #include <vector>
 
 #include <boost/lexical_cast.hpp>
-#include <boost/regex.hpp>
-
-#include <boost/algorithm/string.hpp>
-#include <boost/tokenizer.hpp>
 
 using namespace std;
-using namespace boost;
 using namespace openstudio;
 
 namespace openstudio {
 namespace radiance {
 
+  namespace {
+
+    // conversion from footcandles to lux
+    constexpr double footcandlesToLux = 10.76;
+
+    // binary cache written by saveCache: magic, format version, byte order mark, number of x points, number of y points,
+    // number of date times, x points, y points, then per date time its month, day and seconds in the day followed by the
+    // illuminance map as floats in Matrix storage order
+    constexpr char cacheMagic[8] = {'O', 'S', 'A', 'N', 'N', 'I', 'L', 'L'};
+    constexpr uint32_t cacheFormatVersion = 1;
+    constexpr uint32_t cacheByteOrderMark = 0x01020304;
+
+    // powers of ten that are exact in a double, a mantissa below 2^53 multiplied or divided by one is correctly rounded
+    constexpr double exactPowersOfTen[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                           1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    constexpr uint64_t maxExactMantissa = uint64_t(1) << 53;
+
+    bool isBlank(char c) {
+      return (c == ' ') || (c == '\t') || (c == '\r');
+    }
+
+    bool isDigit(char c) {
+      return (c >= '0') && (c <= '9');
+    }
+
+    void skipBlanks(std::string_view line, size_t& pos) {
+      while ((pos < line.size()) && isBlank(line[pos])) {
+        ++pos;
+      }
+    }
+
+    // scans the number starting at pos after any blanks, returns false if there is none
+    // values are plain decimals, which are converted in one pass over the digits without calling into the C library,
+    // anything that would not be correctly rounded that way falls back to lexical_cast
+    bool scanNumber(std::string_view line, size_t& pos, double& value) {
+      skipBlanks(line, pos);
+      const size_t begin = pos;
+
+      bool negative = false;
+      if ((pos < line.size()) && ((line[pos] == '-') || (line[pos] == '+'))) {
+        negative = (line[pos] == '-');
+        ++pos;
+      }
+
+      uint64_t mantissa = 0;
+      int exponent = 0;
+      int numSignificantDigits = 0;
+      bool hasDigits = false;
+      bool exact = true;
+      auto addDigit = [&](char c) {
+        if (numSignificantDigits < 19) {
+          mantissa = 10 * mantissa + static_cast<uint64_t>(c - '0');
+          if (mantissa != 0) {
+            ++numSignificantDigits;
+          }
+        } else {
+          exact = false;
+        }
+        hasDigits = true;
+      };
+
+      while ((pos < line.size()) && isDigit(line[pos])) {
+        addDigit(line[pos]);
+        ++pos;
+      }
+      if ((pos < line.size()) && (line[pos] == '.')) {
+        ++pos;
+        while ((pos < line.size()) && isDigit(line[pos])) {
+          addDigit(line[pos]);
+          --exponent;
+          ++pos;
+        }
+      }
+      if (!hasDigits) {
+        pos = begin;
+        return false;
+      }
+
+      if ((pos < line.size()) && ((line[pos] == 'e') || (line[pos] == 'E'))) {
+        size_t exponentPos = pos + 1;
+        bool negativeExponent = false;
+        if ((exponentPos < line.size()) && ((line[exponentPos] == '-') || (line[exponentPos] == '+'))) {
+          negativeExponent = (line[exponentPos] == '-');
+          ++exponentPos;
+        }
+        if ((exponentPos < line.size()) && isDigit(line[exponentPos])) {
+          int explicitExponent = 0;
+          while ((exponentPos < line.size()) && isDigit(line[exponentPos])) {
+            if (explicitExponent < 10000) {
+              explicitExponent = 10 * explicitExponent + (line[exponentPos] - '0');
+            }
+            ++exponentPos;
+          }
+          exponent += negativeExponent ? -explicitExponent : explicitExponent;
+          pos = exponentPos;
+        }
+      }
+
+      if (!exact || (mantissa > maxExactMantissa) || (exponent < -22) || (exponent > 22)) {
+        try {
+          value = boost::lexical_cast<double>(std::string(line.substr(begin, pos - begin)));
+        } catch (const boost::bad_lexical_cast&) {
+          pos = begin;
+          return false;
+        }
+        return true;
+      }
+
+      value = static_cast<double>(mantissa);
+      if (exponent < 0) {
+        value /= exactPowersOfTen[-exponent];
+      } else {
+        value *= exactPowersOfTen[exponent];
+      }
+      if (negative) {
+        value = -value;
+      }
+      return true;
+    }
+
+    // scans the unsigned integer starting at pos after any blanks, returns false if there is none
+    bool scanUnsigned(std::string_view line, size_t& pos, unsigned& value) {
+      skipBlanks(line, pos);
+      const auto [ptr, ec] = std::from_chars(line.data() + pos, line.data() + line.size(), value);
+      if (ec != std::errc()) {
+        return false;
+      }
+      pos = ptr - line.data();
+      return true;
+    }
+
+  }  // namespace
+
   /// default constructor
   AnnualIlluminanceMap::AnnualIlluminanceMap() = default;
 
@@ -38,8 +171,26 @@ namespace radiance {
       return;
     }
 
-    // open file
-    openstudio::filesystem::ifstream file(path);
+    // read the whole file at once, annual results for large grids are hundreds of MB of text
+    openstudio::filesystem::ifstream file(path, std::ios_base::binary);
+    std::string contents(openstudio::filesystem::file_size(path), '\0');
+    if (!file.read(contents.data(), contents.size())) {
+      LOG(Fatal, "Cannot read file: '" << toString(path) << "'");
+      return;
+    }
+    file.close();
+
+    if (contents.compare(0, sizeof(cacheMagic), cacheMagic, sizeof(cacheMagic)) == 0) {
+      if (!parseCache(contents)) {
+        LOG(Fatal, "Invalid illuminance map cache: '" << toString(path) << "'");
+      }
+    } else {
+      parseText(contents);
+    }
+  }
+
+  void AnnualIlluminanceMap::parseText(const std::string& contents) {
+    const std::string_view text(contents);
 
     // keep track of line number
     unsigned lineNum = 0;
@@ -48,24 +199,17 @@ namespace radiance {
     unsigned M = 0;
     unsigned N = 0;
 
-    // temp string to read file
-    string line;
-
     // lines 1 and 2 are the header lines
-    string line1;
-    string line2;
-
-    // this will contain matches to regular expressions
-    smatch matches;
+    std::string_view line1;
 
-    // matches a single number followed by either tabs or spaces
-    const regex singleNumber("([-+]?[0-9]*\\.?[0-9]+)[\\s\\t]*");
-
-    // conversion from footcandles to lux
-    const double footcandlesToLux(10.76);
-
-    // read the rest of the file line by line
-    while (getline(file, line)) {
+    size_t lineBegin = 0;
+    while (lineBegin < text.size()) {
+      size_t lineEnd = text.find('\n', lineBegin);
+      if (lineEnd == std::string_view::npos) {
+        lineEnd = text.size();
+      }
+      const std::string_view line = text.substr(lineBegin, lineEnd - lineBegin);
+      lineBegin = lineEnd + 1;
       ++lineNum;
 
       if (lineNum == 1) {
@@ -75,11 +219,8 @@ namespace radiance {
 
       } else if (lineNum == 2) {
 
-        // save line 2
-        line2 = line;
-
         // create the header info
-        HeaderInfo headerInfo(line1, line2);
+        HeaderInfo headerInfo{std::string(line1), std::string(line)};
 
         // we can now initialize x and y vectors
         m_xVector = headerInfo.xVector();
@@ -93,51 +234,175 @@ namespace radiance {
         // each line contains the month, day, time (in hours),
         // Solar Azimuth(degrees from south), Solar Altitude(degrees), Global Horizontal Illuminance (fc)
         // followed by M*N illuminance points
+        size_t pos = 0;
+        skipBlanks(line, pos);
+        if (pos == line.size()) {
+          continue;
+        }
+
+        unsigned month = 0;
+        unsigned day = 0;
+        double hours = 0.0;
+        double ignored = 0.0;
 
-        // break the line up by spaces
-        vector<string> lineVector;
-        tokenizer<char_separator<char>, std::string::const_iterator, std::string> tk(line, char_separator<char>(" "));
-        for (tokenizer<char_separator<char>, std::string::const_iterator, std::string>::iterator it(tk.begin()); it != tk.end(); ++it) {
-          lineVector.push_back(*it);
+        // ignore solar angles and global horizontal for now
+        if (!(scanUnsigned(line, pos, month) && scanUnsigned(line, pos, day) && scanNumber(line, pos, hours) && scanNumber(line, pos, ignored)
+              && scanNumber(line, pos, ignored) && scanNumber(line, pos, ignored))) {
+          LOG(Fatal, "Cannot read date, time and solar data on line " << lineNum << ".");
+          return;
         }
 
-        // total number minus 6 standard header items
-        unsigned numValues = lineVector.size() - 6;
+        // make the date time
+        DateTime dateTime(Date(monthOfYear(month), day), Time(hours / 24.0));
+
+        // matrix we are going to read in
+        Matrix illuminanceMap(M, N);
+
+        // read in the values
+        unsigned numValues = 0;
+        unsigned i = 0;
+        unsigned j = 0;
+        double value = 0.0;
+        while (scanNumber(line, pos, value)) {
+          if (j < N) {
+            illuminanceMap(i, j) = footcandlesToLux * value;
+            if (++i == M) {
+              i = 0;
+              ++j;
+            }
+          }
+          ++numValues;
+        }
+        skipBlanks(line, pos);
 
-        if (numValues != M * N) {
+        if (pos != line.size()) {
+          LOG(Fatal, "Cannot read illuminance value on line " << lineNum << ".");
+          return;
+        } else if (numValues != M * N) {
           LOG(Fatal, "Incorrect number of illuminance values read " << numValues << ", expecting " << M * N << ".");
           return;
-        } else {
+        }
+
+        m_dateTimes.push_back(dateTime);
+        m_dateTimeIlluminanceMap[dateTime] = std::move(illuminanceMap);
+      }
+    }
+  }
 
-          MonthOfYear thisMonth = monthOfYear(lexical_cast<unsigned>(lineVector[0]));
-          auto day = lexical_cast<unsigned>(lineVector[1]);
-          double fracDays = lexical_cast<double>(lineVector[2]) / 24.0;
+  bool AnnualIlluminanceMap::parseCache(const std::string& contents) {
+    size_t pos = sizeof(cacheMagic);
+    auto read = [&contents, &pos](void* value, size_t size) {
+      if (contents.size() - pos < size) {
+        return false;
+      }
+      std::memcpy(value, contents.data() + pos, size);
+      pos += size;
+      return true;
+    };
+
+    uint32_t formatVersion = 0;
+    uint32_t byteOrderMark = 0;
+    uint64_t M = 0;
+    uint64_t N = 0;
+    uint64_t numDateTimes = 0;
+    if (!(read(&formatVersion, sizeof(formatVersion)) && read(&byteOrderMark, sizeof(byteOrderMark)) && read(&M, sizeof(M))
+          && read(&N, sizeof(N)) && read(&numDateTimes, sizeof(numDateTimes)))) {
+      return false;
+    }
+    if ((formatVersion != cacheFormatVersion) || (byteOrderMark != cacheByteOrderMark)) {
+      LOG(Error, "Illuminance map cache was written with format " << formatVersion << " or on a machine with a different byte order.");
+      return false;
+    }
 
-          // ignore solar angles and global horizontal for now
+    // check sizes before allocating anything
+    const uint64_t remaining = contents.size() - pos;
+    if ((M > remaining) || (N > remaining) || ((N != 0) && (M > remaining / N)) || ((M + N) * sizeof(double) > remaining)) {
+      return false;
+    }
+    const uint64_t dateTimeSize = 3 * sizeof(uint32_t) + M * N * sizeof(float);
+    if ((remaining - (M + N) * sizeof(double)) / dateTimeSize < numDateTimes) {
+      return false;
+    }
 
-          // make the date time
-          DateTime dateTime(Date(thisMonth, day), Time(fracDays));
+    m_xVector = Vector(M);
+    m_yVector = Vector(N);
+    for (double& x : m_xVector) {
+      read(&x, sizeof(x));
+    }
+    for (double& y : m_yVector) {
+      read(&y, sizeof(y));
+    }
 
-          // matrix we are going to read in
-          Matrix illuminanceMap(M, N);
+    std::vector<float> values(M * N);
+    for (uint64_t n = 0; n < numDateTimes; ++n) {
+      uint32_t month = 0;
+      uint32_t day = 0;
+      uint32_t seconds = 0;
+      read(&month, sizeof(month));
+      read(&day, sizeof(day));
+      read(&seconds, sizeof(seconds));
+      read(values.data(), values.size() * sizeof(float));
 
-          // read in the values
-          unsigned index = 6;
-          for (unsigned j = 0; j < N; ++j) {
-            for (unsigned i = 0; i < M; ++i) {
-              illuminanceMap(i, j) = footcandlesToLux * lexical_cast<double>(lineVector[index]);
-              ++index;
-            }
-          }
+      DateTime dateTime(Date(monthOfYear(month), day), Time(0, 0, 0, seconds));
 
-          m_dateTimes.push_back(dateTime);
-          m_dateTimeIlluminanceMap[dateTime] = illuminanceMap;
-        }
+      Matrix illuminanceMap(M, N);
+      std::copy(values.begin(), values.end(), illuminanceMap.data().begin());
+
+      m_dateTimes.push_back(dateTime);
+      m_dateTimeIlluminanceMap[dateTime] = std::move(illuminanceMap);
+    }
+
+    return true;
+  }
+
+  bool AnnualIlluminanceMap::saveCache(const openstudio::path& path) const {
+    openstudio::filesystem::ofstream file(path, std::ios_base::binary | std::ios_base::trunc);
+    if (!file) {
+      LOG(Error, "Cannot write illuminance map cache to '" << toString(path) << "'");
+      return false;
+    }
+    auto write = [&file](const void* value, size_t size) { file.write(static_cast<const char*>(value), size); };
+
+    const uint64_t M = m_xVector.size();
+    const uint64_t N = m_yVector.size();
+    const uint64_t numDateTimes = m_dateTimes.size();
+    file.write(cacheMagic, sizeof(cacheMagic));
+    write(&cacheFormatVersion, sizeof(cacheFormatVersion));
+    write(&cacheByteOrderMark, sizeof(cacheByteOrderMark));
+    write(&M, sizeof(M));
+    write(&N, sizeof(N));
+    write(&numDateTimes, sizeof(numDateTimes));
+    for (const double& x : m_xVector) {
+      write(&x, sizeof(x));
+    }
+    for (const double& y : m_yVector) {
+      write(&y, sizeof(y));
+    }
+
+    std::vector<float> values(M * N);
+    for (const DateTime& dateTime : m_dateTimes) {
+      auto it = m_dateTimeIlluminanceMap.find(dateTime);
+      if ((it == m_dateTimeIlluminanceMap.end()) || (it->second.data().size() != values.size())) {
+        LOG(Error, "No illuminance map of size " << M << " by " << N << " at " << dateTime << ".");
+        return false;
       }
+      std::transform(it->second.data().begin(), it->second.data().end(), values.begin(), [](double value) { return static_cast<float>(value); });
+
+      const uint32_t month = openstudio::month(dateTime.date().monthOfYear());
+      const uint32_t day = dateTime.date().dayOfMonth();
+      const uint32_t seconds = dateTime.time().totalSeconds();
+      write(&month, sizeof(month));
+      write(&day, sizeof(day));
+      write(&seconds, sizeof(seconds));
+      write(values.data(), values.size() * sizeof(float));
     }
 
-    // close file
     file.close();
+    if (!file) {
+      LOG(Error, "Cannot write illuminance map cache to '" << toString(path) << "'");
+      return false;
+    }
+    return true;
   }
 
   /// get the illuminance map in lux corresponding to date and time
@@ -20,6 +20,10 @@ namespace radiance {
   /** AnnualIlluminanceMap represents illuminance map for an entire year.
   *   We assume that the output files is from SPOT, with length in meters and illuminance
   *   values in footcandles.  All illuminance values are converted to lux.
+  *
+  *   Parsed maps can be written with saveCache to a compact binary file, which the path constructor
+  *   reads back without parsing text.  The cache stores illuminance values in single precision and
+  *   in native byte order, it is meant to be reused on the same machine.
   */
   class RADIANCE_API AnnualIlluminanceMap
   {
@@ -56,11 +60,18 @@ namespace radiance {
     /// get the illuminance map in lux corresponding to date and time
     openstudio::Matrix illuminanceMap(const openstudio::DateTime& dateTime) const;
 
+    /// write the illuminance maps to a binary cache file, returns false if the file could not be written
+    bool saveCache(const openstudio::path& path) const;
+
    private:
     REGISTER_LOGGER("radiance.AnnualIlluminanceMap");
 
     void init(const openstudio::path& path);
 
+    void parseText(const std::string& contents);
+
+    bool parseCache(const std::string& contents);
+
     openstudio::DateTimeVector m_dateTimes;
     openstudio::Vector m_xVector;
     openstudio::Vector m_yVector;
@@ -7,6 +7,8 @@
 
 #include "../AnnualIlluminanceMap.hpp"
 
+#include "../../utilities/core/Filesystem.hpp"
+
 #include <resources.hxx>
 
 using namespace std;
@@ -49,3 +51,74 @@ AnnualIlluminanceMap RadAnnualIlluminanceMapFixture::outFile;
 ///////////////////////////////////////////////////////////////////////////////
 
 TEST_F(RadAnnualIlluminanceMapFixture, AnnualIlluminanceMap) {}
+
+TEST_F(RadAnnualIlluminanceMapFixture, AnnualIlluminanceMap_Cache) {
+  // 3 by 2 grid, values in footcandles
+  openstudio::path textPath = openstudio::tempDir() / toPath("AnnualIlluminanceMap_Cache.ill");
+  {
+    openstudio::filesystem::ofstream file(textPath, std::ios_base::binary | std::ios_base::trunc);
+    file << "0 0 0 2 0 0 0 1 0\n";
+    file << "1 1 0\n";
+    file << "1 1 8.5 10.0 20.0 100.0 12.5 -0 1e2 0.000123456789 3.14159265358979323846 7\n";
+    file << "6\t21 12 0.0 70.0 900.0\t1 2 3 4 5 6\r\n";
+  }
+
+  AnnualIlluminanceMap textMap(textPath);
+  ASSERT_EQ(3u, textMap.xVector().size());
+  ASSERT_EQ(2u, textMap.yVector().size());
+  ASSERT_EQ(2u, textMap.dateTimes().size());
+
+  openstudio::DateTime first(openstudio::Date(openstudio::MonthOfYear::Jan, 1), openstudio::Time(8.5 / 24.0));
+  openstudio::DateTime second(openstudio::Date(openstudio::MonthOfYear::Jun, 21), openstudio::Time(0.5));
+  EXPECT_EQ(first, textMap.dateTimes()[0]);
+  EXPECT_EQ(second, textMap.dateTimes()[1]);
+
+  // values run along x first
+  openstudio::Matrix firstMap = textMap.illuminanceMap(first);
+  ASSERT_EQ(3u, firstMap.size1());
+  ASSERT_EQ(2u, firstMap.size2());
+  EXPECT_DOUBLE_EQ(10.76 * 12.5, firstMap(0, 0));
+  EXPECT_DOUBLE_EQ(0.0, firstMap(1, 0));
+  EXPECT_DOUBLE_EQ(10.76 * 100.0, firstMap(2, 0));
+  EXPECT_DOUBLE_EQ(10.76 * 0.000123456789, firstMap(0, 1));
+  EXPECT_DOUBLE_EQ(10.76 * 3.14159265358979323846, firstMap(1, 1));
+  EXPECT_DOUBLE_EQ(10.76 * 7.0, firstMap(2, 1));
+  EXPECT_DOUBLE_EQ(10.76 * 6.0, textMap.illuminanceMap(second)(2, 1));
+
+  // the cache gives back the same maps in single precision
+  openstudio::path cachePath = openstudio::tempDir() / toPath("AnnualIlluminanceMap_Cache.bin");
+  ASSERT_TRUE(textMap.saveCache(cachePath));
+
+  AnnualIlluminanceMap cacheMap(cachePath);
+  ASSERT_EQ(textMap.dateTimes().size(), cacheMap.dateTimes().size());
+  EXPECT_EQ(textMap.xVector().size(), cacheMap.xVector().size());
+  EXPECT_EQ(textMap.yVector().size(), cacheMap.yVector().size());
+  for (unsigned i = 0; i < 3; ++i) {
+    EXPECT_DOUBLE_EQ(textMap.xVector()(i), cacheMap.xVector()(i));
+  }
+  for (unsigned n = 0; n < textMap.dateTimes().size(); ++n) {
+    openstudio::DateTime dateTime = textMap.dateTimes()[n];
+    EXPECT_EQ(dateTime, cacheMap.dateTimes()[n]);
+    openstudio::Matrix expected = textMap.illuminanceMap(dateTime);
+    openstudio::Matrix actual = cacheMap.illuminanceMap(dateTime);
+    ASSERT_EQ(expected.size1(), actual.size1());
+    ASSERT_EQ(expected.size2(), actual.size2());
+    for (unsigned i = 0; i < expected.size1(); ++i) {
+      for (unsigned j = 0; j < expected.size2(); ++j) {
+        EXPECT_FLOAT_EQ(static_cast<float>(expected(i, j)), static_cast<float>(actual(i, j)));
+      }
+    }
+  }
+
+  // a line with a missing value is rejected
+  {
+    openstudio::filesystem::ofstream file(textPath, std::ios_base::binary | std::ios_base::trunc);
+    file << "0 0 0 2 0 0 0 1 0\n";
+    file << "1 1 0\n";
+    file << "1 1 8.5 10.0 20.0 100.0 1 2 3 4 5\n";
+  }
+  EXPECT_TRUE(AnnualIlluminanceMap(textPath).dateTimes().empty());
+
+  openstudio::filesystem::remove(textPath);
+  openstudio::filesystem::remove(cachePath);
+}
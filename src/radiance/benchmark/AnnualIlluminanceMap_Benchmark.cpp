@@ -0,0 +1,71 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../AnnualIlluminanceMap.hpp"
+
+#include "../../utilities/core/Filesystem.hpp"
+#include "../../utilities/core/Path.hpp"
+
+#include <fstream>
+
+using namespace openstudio;
+using namespace openstudio::radiance;
+
+// synthetic annual results for a grid 16 points wide, one line per hour of the year
+openstudio::path makeIllFile(int64_t nPoints) {
+  const int64_t nx = 16;
+  const int64_t ny = nPoints / nx;
+  openstudio::path illPath = openstudio::tempDir() / openstudio::toPath("AnnualIlluminanceMap_Benchmark_" + std::to_string(nPoints) + ".ill");
+  std::ofstream ofs(openstudio::toString(illPath), std::ios_base::binary | std::ios_base::trunc);
+  ofs << "0 0 0 " << (nx - 1) << " 0 0 0 " << (ny - 1) << " 0\n";
+  ofs << "1 1 0\n";
+  const int daysInMonth[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  int64_t hourOfYear = 0;
+  for (int month = 1; month <= 12; ++month) {
+    for (int day = 1; day <= daysInMonth[month - 1]; ++day) {
+      for (int hour = 0; hour < 24; ++hour, ++hourOfYear) {
+        ofs << month << " " << day << " " << (hour + 0.5) << " 12.5 35.25 " << (hour * 41.3);
+        for (int64_t n = 0; n < nx * ny; ++n) {
+          ofs << " " << (((hourOfYear * 7919 + n * 104729) % 100000) * 0.01);
+        }
+        ofs << "\n";
+      }
+    }
+  }
+  return illPath;
+}
+
+static void BM_AnnualIlluminanceMapText(benchmark::State& state) {
+  openstudio::path illPath = makeIllFile(state.range(0));
+
+  for (auto _ : state) {
+    AnnualIlluminanceMap annualIlluminanceMap(illPath);
+    benchmark::DoNotOptimize(annualIlluminanceMap);
+  }
+
+  state.SetComplexityN(state.range(0));
+  openstudio::filesystem::remove(illPath);
+}
+
+static void BM_AnnualIlluminanceMapCache(benchmark::State& state) {
+  openstudio::path illPath = makeIllFile(state.range(0));
+  openstudio::path cachePath = openstudio::tempDir() / openstudio::toPath("AnnualIlluminanceMap_Benchmark_" + std::to_string(state.range(0)) + ".bin");
+  AnnualIlluminanceMap(illPath).saveCache(cachePath);
+
+  for (auto _ : state) {
+    AnnualIlluminanceMap annualIlluminanceMap(cachePath);
+    benchmark::DoNotOptimize(annualIlluminanceMap);
+  }
+
+  state.SetComplexityN(state.range(0));
+  openstudio::filesystem::remove(illPath);
+  openstudio::filesystem::remove(cachePath);
+}
+
+// 5120 points, 16 by 320, is about the size of a daylighting grid of 5,000 points
+BENCHMARK(BM_AnnualIlluminanceMapText)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(16, 1024)->Arg(5120)->Complexity();
+BENCHMARK(BM_AnnualIlluminanceMapCache)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(16, 1024)->Arg(5120)->Complexity();
@@ -17,7 +17,7 @@ BCLFileReference::BCLFileReference(const openstudio::path& measureRootDir, const
     m_path(openstudio::filesystem::system_complete(measureRootDir / relativePath)) {
   // DLM: why would you not want to set the members?
   if (setMembers) {
-    m_checksum = openstudio::checksum(m_path);
+    m_checksum = openstudio::cachedChecksum(m_path);
 
     std::string fileType = this->fileType();
     if (fileType == "osm") {
@@ -191,7 +191,7 @@ std::string BCLFileReference::toJSONString() const {
 }
 
 bool BCLFileReference::checkForUpdate() {
-  std::string newChecksum = openstudio::checksum(this->path());
+  std::string newChecksum = openstudio::cachedChecksum(this->path());
   if (m_checksum != newChecksum) {
     m_checksum = newChecksum;
     return true;
@@ -5,6 +5,8 @@
 
 #include "Checksum.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <sstream>
 
 #include <boost/crc.hpp>
@@ -36,19 +38,22 @@ std::string checksum(std::string s) {
 /// return 8 character hex checksum of istream
 std::string checksum(std::istream& is) {
   boost::crc_32_type crc;
+  std::vector<char> buffer(1 << 16);
   do {
-    const std::streamsize n = 1024;
-    char buffer[n];
-    is.read(buffer, n);
-    std::streamsize readSize = is.gcount();
-    //crc.process_bytes(buffer, readSize);
-
-    auto stringSize = static_cast<size_t>(readSize);
-    std::string str(buffer, stringSize);
-    str.erase(std::remove_if(str.begin(), str.end(), openstudio::detail::checksumIgnore), str.end());
-    stringSize = str.size();
-
-    crc.process_bytes(str.c_str(), stringSize);
+    is.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    const char* begin = buffer.data();
+    const char* end = begin + is.gcount();
+
+    // process the runs between ignored carriage returns in place
+    while (begin < end) {
+      const auto* cr = static_cast<const char*>(std::memchr(begin, '\r', end - begin));
+      if (cr == nullptr) {
+        crc.process_block(begin, end);
+        break;
+      }
+      crc.process_block(begin, cr);
+      begin = cr + 1;
+    }
   } while (is);
 
   return fmt::format("{:0>8X}", crc.checksum());
@@ -11,6 +11,7 @@
 
 #include <string>
 #include <ostream>
+#include <vector>
 
 namespace openstudio {
 
@@ -23,6 +24,15 @@ UTILITIES_API std::string checksum(std::istream& is);
 /// return 8 character hex checksum of file contents
 UTILITIES_API std::string checksum(const path& p);
 
+/// return 8 character hex checksum of file contents, remembered for the lifetime of the process by path, size and modification time.
+/// The cache is in memory only, it helps long running processes such as the measure manager server but every
+/// openstudio measure -u invocation starts with an empty cache.
+UTILITIES_API std::string cachedChecksum(const path& p);
+
+/// return cachedChecksum of each file, files not already cached are checksummed in parallel, numThreads = 0 uses all cores.
+/// Pass the files of many measures at once rather than calling this per measure, most measures only have a handful of files.
+UTILITIES_API std::vector<std::string> cachedChecksums(const std::vector<path>& paths, unsigned numThreads = 0);
+
 /// returns the CRC-16 checksum of the first len bytes of data.  Replaces Qt implementation qChecksum.
 UTILITIES_API int crc16(const char* ptr, int count);
 
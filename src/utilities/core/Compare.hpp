@@ -39,8 +39,13 @@ class WorkspaceObject;
  *   Used in istringEqual. */
 struct UTILITIES_API IcharCompare
 {
+  /** Case folding of istringEqual, for keys that must agree with it. */
+  static char fold(char c) {
+    return static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+  }
+
   bool operator()(char cA, char cB) const {
-    return toupper(cA) == toupper(cB);
+    return fold(cA) == fold(cB);
   };
 };
 
@@ -49,6 +54,15 @@ inline UTILITIES_API bool istringEqual(const std::string& x, const std::string&
   return x.size() == y.size() && std::equal(x.begin(), x.end(), y.begin(), IcharCompare());
 };
 
+/** Key for hashed or sorted indices of names, equal for strings that are istringEqual. */
+inline UTILITIES_API std::string istringKey(const std::string& x) {
+  std::string result(x);
+  for (char& c : result) {
+    c = IcharCompare::fold(c);
+  }
+  return result;
+}
+
 /** Small functor object for case insensitive std::string equality. */
 struct UTILITIES_API IstringEqual
 {
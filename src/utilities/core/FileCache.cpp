@@ -0,0 +1,84 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include "FileCache.hpp"
+#include "Checksum.hpp"
+#include "Filesystem.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace openstudio {
+
+boost::optional<FileCacheKey> fileCacheKey(const path& p) {
+  constexpr std::time_t minAge = 2;
+
+  boost::system::error_code ec;
+  if (!openstudio::filesystem::is_regular_file(p, ec) || ec) {
+    return boost::none;
+  }
+  uintmax_t fileSize = openstudio::filesystem::file_size(p, ec);
+  if (ec) {
+    return boost::none;
+  }
+  std::time_t lastWriteTime = openstudio::filesystem::last_write_time(p, ec);
+  if (ec || (lastWriteTime + minAge > std::time(nullptr))) {
+    return boost::none;
+  }
+  return std::make_tuple(toString(boost::filesystem::absolute(p)), fileSize, lastWriteTime);
+}
+
+// the cached checksums live here rather than in Checksum.cpp, which GenerateIddFactory compiles without the rest of utilities
+std::string cachedChecksum(const path& p) {
+  // a few hundred measures with a few dozen files each, entries are small
+  static FileCache<std::string> cache(100000);
+
+  boost::optional<FileCacheKey> key = fileCacheKey(p);
+  if (key) {
+    if (boost::optional<std::string> cached = cache.find(*key)) {
+      return *cached;
+    }
+  }
+
+  std::string result = checksum(p);
+
+  if (key) {
+    cache.insert(std::move(*key), result);
+  }
+  return result;
+}
+
+std::vector<std::string> cachedChecksums(const std::vector<path>& paths, unsigned numThreads) {
+  std::vector<std::string> result(paths.size());
+  if (numThreads == 0) {
+    numThreads = std::max(std::thread::hardware_concurrency(), 1u);
+  }
+  numThreads = static_cast<unsigned>(std::min<size_t>(numThreads, paths.size()));
+
+  // cachedChecksum does not throw, each thread takes the next file until there are none left
+  std::atomic<size_t> next(0);
+  auto work = [&paths, &result, &next]() {
+    for (size_t i = next++; i < paths.size(); i = next++) {
+      result[i] = cachedChecksum(paths[i]);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  if (numThreads > 1) {
+    threads.reserve(numThreads - 1);
+    for (unsigned t = 1; t < numThreads; ++t) {
+      threads.emplace_back(work);
+    }
+  }
+  work();
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  return result;
+}
+
+}  // namespace openstudio
@@ -0,0 +1,65 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_CORE_FILECACHE_HPP
+#define UTILITIES_CORE_FILECACHE_HPP
+
+#include "Path.hpp"
+#include "../UtilitiesAPI.hpp"
+
+#include <boost/optional.hpp>
+
+#include <cstdint>
+#include <ctime>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+
+namespace openstudio {
+
+/// identifies the contents of a file by absolute path, size and modification time
+using FileCacheKey = std::tuple<std::string, uintmax_t, std::time_t>;
+
+/// return the cache key of a regular file, none if the file cannot be read or was modified within the last two seconds.
+/// Modification times only have a one second resolution, a file changed again within the same second with the same size
+/// would look unchanged, so such files must not be cached.
+UTILITIES_API boost::optional<FileCacheKey> fileCacheKey(const path& p);
+
+/// Process wide cache of values derived from the contents of files, e.g. by several measures of the same workflow.
+/// All members are thread-safe. The cache is emptied rather than growing beyond maxSize entries.
+template <class T>
+class FileCache
+{
+ public:
+  explicit FileCache(size_t maxSize) : m_maxSize(maxSize) {}
+
+  boost::optional<T> find(const FileCacheKey& key) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_values.find(key);
+    if (it == m_values.end()) {
+      return boost::none;
+    }
+    return it->second;
+  }
+
+  /// returns the value cached for key, which is not value if another thread inserted one in the meantime
+  T insert(FileCacheKey key, T value) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_values.size() >= m_maxSize) {
+      m_values.clear();
+    }
+    return m_values.emplace(std::move(key), std::move(value)).first->second;
+  }
+
+ private:
+  mutable std::mutex m_mutex;
+  std::map<FileCacheKey, T> m_values;
+  size_t m_maxSize;
+};
+
+}  // namespace openstudio
+
+#endif  // UTILITIES_CORE_FILECACHE_HPP
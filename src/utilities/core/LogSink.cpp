@@ -14,6 +14,9 @@
 #include <boost/phoenix/bind.hpp>
 #include <boost/log/support/date_time.hpp>
 
+#include <atomic>
+#include <map>
+
 namespace sinks = boost::log::sinks;
 namespace keywords = boost::log::keywords;
 namespace expr = boost::log::expressions;
@@ -34,6 +37,110 @@ namespace detail {
     return std::string{logLevelStrs[static_cast<size_t>(logLevel) - static_cast<size_t>(LogLevel::Trace)]};
   }
 
+  namespace {
+
+    // level and channel regex of every sink, mirrors the boost filters so the LOG macros can skip formatting messages no sink wants
+    struct SinkFilters
+    {
+      struct Filter
+      {
+        LogLevel logLevel = Trace;
+        boost::optional<boost::regex> channelRegex;
+        bool enabled = false;
+      };
+
+      std::shared_mutex mutex;
+      std::map<const LogSinkBackend*, Filter> filters;
+
+      // lowest level accepted by any enabled sink, and by any enabled sink without a channel regex
+      std::atomic<int> minimumLogLevel{Fatal + 1};
+      std::atomic<int> minimumUnfilteredLogLevel{Fatal + 1};
+
+      // lowest level accepted for a channel, only needed for levels between the two minimums
+      std::map<std::string, int, std::less<>> channelLogLevels;
+
+      void update(const std::unique_lock<std::shared_mutex>& /*l*/) {
+        int minimum = Fatal + 1;
+        int minimumUnfiltered = Fatal + 1;
+        for (const auto& [sink, filter] : filters) {
+          if (filter.enabled) {
+            minimum = std::min(minimum, static_cast<int>(filter.logLevel));
+            if (!filter.channelRegex) {
+              minimumUnfiltered = std::min(minimumUnfiltered, static_cast<int>(filter.logLevel));
+            }
+          }
+        }
+        minimumLogLevel = minimum;
+        minimumUnfilteredLogLevel = minimumUnfiltered;
+        channelLogLevels.clear();
+      }
+    };
+
+    // never destroyed, sinks may be enabled, disabled or destroyed during static destruction
+    SinkFilters& sinkFilters() {
+      static auto* sinkFilters = new SinkFilters();
+      return *sinkFilters;
+    }
+
+  }  // namespace
+
+  bool isLogEnabled(LogLevel level, const LogChannel& channel) {
+    // the logger sets up the standard out sink
+    [[maybe_unused]] static Logger& logger = Logger::instance();
+
+    SinkFilters& f = sinkFilters();
+    if (level < f.minimumLogLevel.load(std::memory_order_relaxed)) {
+      return false;
+    }
+    if (level >= f.minimumUnfilteredLogLevel.load(std::memory_order_relaxed)) {
+      return true;
+    }
+
+    {
+      std::shared_lock l{f.mutex};
+      auto it = f.channelLogLevels.find(channel);
+      if (it != f.channelLogLevels.end()) {
+        return level >= it->second;
+      }
+    }
+
+    std::unique_lock l{f.mutex};
+    int channelLogLevel = Fatal + 1;
+    for (const auto& [sink, filter] : f.filters) {
+      if (filter.enabled && (!filter.channelRegex || boost::regex_match(channel, *filter.channelRegex))) {
+        channelLogLevel = std::min(channelLogLevel, static_cast<int>(filter.logLevel));
+      }
+    }
+    f.channelLogLevels[channel] = channelLogLevel;
+    return level >= channelLogLevel;
+  }
+
+  void updateSinkFilter(const LogSinkBackend* sink, LogLevel logLevel, const boost::optional<boost::regex>& channelRegex) {
+    SinkFilters& f = sinkFilters();
+    std::unique_lock l{f.mutex};
+    SinkFilters::Filter& filter = f.filters[sink];
+    filter.logLevel = logLevel;
+    filter.channelRegex = channelRegex;
+    f.update(l);
+  }
+
+  void setSinkFilterEnabled(const LogSinkBackend* sink, bool enabled) {
+    SinkFilters& f = sinkFilters();
+    std::unique_lock l{f.mutex};
+    f.filters[sink].enabled = enabled;
+    f.update(l);
+  }
+
+  void removeSinkFilter(const LogSinkBackend* sink) {
+    SinkFilters& f = sinkFilters();
+    std::unique_lock l{f.mutex};
+    auto it = f.filters.find(sink);
+    if ((it != f.filters.end()) && !it->second.enabled) {
+      f.filters.erase(it);
+      f.update(l);
+    }
+  }
+
   LogSink_Impl::LogSink_Impl()
     : m_sink{boost::shared_ptr<LogSinkBackend>(new LogSinkBackend())},
       // set formatting, seems like you have to call this after the stream is added
@@ -42,6 +149,10 @@ namespace detail {
       // this seems to suggest this should work: http://www.edm2.com/0405/enumeration.html
       m_formatter{expr::stream << "[" << expr::attr<LogChannel>("Channel") << "] <" << expr::attr<LogLevel>("Severity") << "> " << expr::smessage} {}
 
+  LogSink_Impl::~LogSink_Impl() {
+    removeSinkFilter(m_sink.get());
+  }
+
   void LogSink_Impl::setFormatter(const boost::log::formatter& fmter) {
     std::unique_lock l{m_mutex};
     m_formatter = fmter;
@@ -209,6 +320,8 @@ namespace detail {
     } else {
       m_sink->set_filter(expr::attr<LogLevel>("Severity") >= filterLogLevel && expr::matches(expr::attr<LogChannel>("Channel"), filterChannelRegex));
     }
+
+    updateSinkFilter(m_sink.get(), filterLogLevel, m_channelRegex);
   }
 
 }  // namespace detail
@@ -24,7 +24,7 @@ namespace detail {
   {
    public:
     /// destructor
-    virtual ~LogSink_Impl() = default;
+    virtual ~LogSink_Impl();
 
     /// is the sink enabled
     bool isEnabled() const;
@@ -100,6 +100,15 @@ namespace detail {
     boost::log::formatter m_formatter;
   };
 
+  /// record a sink's level and channel regex for isLogEnabled, done whenever its boost filter is updated
+  void updateSinkFilter(const LogSinkBackend* sink, LogLevel logLevel, const boost::optional<boost::regex>& channelRegex);
+
+  /// record whether a sink is registered in the logging core, done by Logger::addSink and Logger::removeSink
+  void setSinkFilterEnabled(const LogSinkBackend* sink, bool enabled);
+
+  /// forget a sink's filter when its LogSink_Impl goes away, kept if the sink is still registered in the logging core
+  void removeSinkFilter(const LogSinkBackend* sink);
+
 }  // namespace detail
 
 }  // namespace openstudio
@@ -4,6 +4,7 @@
 ***********************************************************************************************************************/
 
 #include "Logger.hpp"
+#include "LogSink_Impl.hpp"
 
 #include <boost/log/common.hpp>
 #include <boost/log/attributes/function.hpp>
@@ -17,6 +18,9 @@ namespace openstudio {
 
 /// convenience function for SWIG, prefer macros in C++
 void logFree(LogLevel level, const std::string& channel, const std::string& message) {
+  if (!detail::isLogEnabled(level, channel)) {
+    return;
+  }
   BOOST_LOG_SEV(openstudio::Logger::instance().loggerFromChannel(channel), level) << message;
 }
 
@@ -98,6 +102,8 @@ void Logger::addSink(boost::shared_ptr<LogSinkBackend> sink) {
 
     // Register the sink in the logging core
     boost::log::core::get()->add_sink(sink);
+
+    detail::setSinkFilterEnabled(sink.get(), true);
   }
 }
 
@@ -116,6 +122,8 @@ void Logger::removeSink(boost::shared_ptr<LogSinkBackend> sink) {
 
     // Register the sink in the logging core
     boost::log::core::get()->remove_sink(sink);
+
+    detail::setSinkFilterEnabled(sink.get(), false);
   }
 }
 
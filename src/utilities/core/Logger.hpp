@@ -33,12 +33,16 @@
 /// log a message from within a registered class and throw an exception
 #define LOG_AND_THROW(__message__) LOG_FREE_AND_THROW(logChannel(), __message__);
 
-/// log a message from outside a registered class
-#define LOG_FREE(__level__, __channel__, __message__)        \
-  {                                                          \
-    std::stringstream _ss1;                                  \
-    _ss1 << __message__;                                     \
-    openstudio::logFree(__level__, __channel__, _ss1.str()); \
+/// log a message from outside a registered class, the message is only formatted if an enabled sink accepts the level and channel
+#define LOG_FREE(__level__, __channel__, __message__)                 \
+  {                                                                   \
+    const LogLevel _logLevel1 = __level__;                            \
+    const openstudio::LogChannel& _logChannel1 = __channel__;         \
+    if (openstudio::detail::isLogEnabled(_logLevel1, _logChannel1)) { \
+      std::stringstream _ss1;                                         \
+      _ss1 << __message__;                                            \
+      openstudio::logFree(_logLevel1, _logChannel1, _ss1.str());      \
+    }                                                                 \
   }
 
 /// log a message from outside a registered class and throw an exception
@@ -58,6 +62,12 @@ namespace detail {
   class LogSink_Impl;
 }  // namespace detail
 
+namespace detail {
+  /// true if any enabled sink accepts messages of this level and channel, checked by the LOG macros before formatting
+  /// the answer is cached and kept current as sinks are enabled, disabled or change their level or channel regex
+  UTILITIES_API bool isLogEnabled(LogLevel level, const LogChannel& channel);
+}  // namespace detail
+
 /// convenience function for SWIG, prefer macros in C++
 UTILITIES_API void logFree(LogLevel level, const std::string& channel, const std::string& message);
 
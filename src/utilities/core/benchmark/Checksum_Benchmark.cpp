@@ -5,9 +5,15 @@
 
 #include <benchmark/benchmark.h>
 
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
 #include <sstream>
 #include <string>
 #include <string_view>
+#include <thread>
+#include <vector>
 #include <boost/crc.hpp>
 #include <fmt/format.h>
 
@@ -95,6 +101,54 @@ std::string checksum_direct(std::string s) {
   crc.process_bytes(s.data(), s.length());
   return fmt::format("{:0>8X}", crc.checksum());
 }
+/// return 8 character hex checksum of istream, without a string per chunk
+std::string checksum_stream(std::istream& is) {
+  boost::crc_32_type crc;
+  std::vector<char> buffer(1 << 16);
+  do {
+    is.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    const char* begin = buffer.data();
+    const char* end = begin + is.gcount();
+    while (begin < end) {
+      const auto* cr = static_cast<const char*>(std::memchr(begin, '\r', end - begin));
+      if (cr == nullptr) {
+        crc.process_block(begin, end);
+        break;
+      }
+      crc.process_block(begin, cr);
+      begin = cr + 1;
+    }
+  } while (is);
+
+  return fmt::format("{:0>8X}", crc.checksum());
+}
+
+/// return 8 character hex checksum of string
+std::string checksum_stream(const std::string& s) {
+  std::stringstream ss(s);
+  return checksum_stream(ss);
+}
+
+/// checksum several files, each thread takes the next file until there are none left
+std::vector<std::string> checksum_files(const std::vector<std::filesystem::path>& paths, unsigned numThreads) {
+  std::vector<std::string> result(paths.size());
+  std::atomic<size_t> next(0);
+  auto work = [&paths, &result, &next]() {
+    for (size_t i = next++; i < paths.size(); i = next++) {
+      std::ifstream ifs(paths[i], std::ios_base::binary);
+      result[i] = checksum_stream(ifs);
+    }
+  };
+  std::vector<std::thread> threads;
+  for (unsigned t = 1; t < numThreads; ++t) {
+    threads.emplace_back(work);
+  }
+  work();
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  return result;
+}
 }  // namespace openstudio_new
 
 std::string makeTestStr(size_t len) {
@@ -151,6 +205,43 @@ static void BM_CheckSumNewDirect(benchmark::State& state) {
   state.SetComplexityN(state.range(0));
 }
 
+static void BM_CheckSumNewStream(benchmark::State& state) {
+
+  auto testStr = makeTestStr(state.range(0));
+  auto checkSumOld = openstudio_old::checksum(testStr);
+  auto checkSumNew = openstudio_new::checksum_stream(testStr);
+  assert(checkSumNew == checkSumOld);
+
+  for (auto _ : state) {
+    auto s = openstudio_new::checksum_stream(testStr);
+    benchmark::DoNotOptimize(s);
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+// a measure directory worth of resource files, 64 files of 1 MB each, checksummed with range(0) threads
+static void BM_CheckSumFiles(benchmark::State& state) {
+  const std::filesystem::path dir = std::filesystem::temp_directory_path() / "Checksum_Benchmark";
+  std::filesystem::create_directories(dir);
+  std::vector<std::filesystem::path> paths;
+  const std::string contents = makeTestStr(1 << 20);
+  for (int i = 0; i < 64; ++i) {
+    paths.push_back(dir / ("file" + std::to_string(i) + ".txt"));
+    std::ofstream ofs(paths.back(), std::ios_base::binary | std::ios_base::trunc);
+    ofs << contents;
+  }
+
+  for (auto _ : state) {
+    auto checksums = openstudio_new::checksum_files(paths, static_cast<unsigned>(state.range(0)));
+    benchmark::DoNotOptimize(checksums);
+  }
+
+  std::filesystem::remove_all(dir);
+}
+
 BENCHMARK(BM_CheckSumOld)->RangeMultiplier(4)->Range(8, 8 << 16)->Complexity();
 BENCHMARK(BM_CheckSumNew)->RangeMultiplier(4)->Range(8, 8 << 16)->Complexity();
 BENCHMARK(BM_CheckSumNewDirect)->RangeMultiplier(4)->Range(8, 8 << 16)->Complexity();
+BENCHMARK(BM_CheckSumNewStream)->RangeMultiplier(4)->Range(8, 8 << 16)->Complexity();
+BENCHMARK(BM_CheckSumFiles)->Unit(benchmark::kMillisecond)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
@@ -0,0 +1,75 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../Logger.hpp"
+#include "../StringStreamLogSink.hpp"
+
+using namespace openstudio;
+
+class LoggedClass
+{
+ public:
+  void logDebug(int i, double value) {
+    LOG(Debug, "Iteration " << i << " computed value " << value << " for object '" << m_name << "'");
+  }
+
+ private:
+  std::string m_name = "Some Object Name";
+  REGISTER_LOGGER("openstudio.benchmark.LoggedClass");
+};
+
+// the usual production setup, Debug messages in a hot loop with every sink at Warn
+static void BM_LogDisabled(benchmark::State& state) {
+  Logger::instance().standardOutLogger().setLogLevel(Warn);
+  Logger::instance().standardOutLogger().enable();
+  LoggedClass loggedClass;
+
+  int i = 0;
+  for (auto _ : state) {
+    loggedClass.logDebug(++i, 0.5 * i);
+  }
+  state.SetItemsProcessed(state.iterations());
+  Logger::instance().standardOutLogger().disable();
+}
+
+// a sink at Debug that only wants another channel
+static void BM_LogDisabledChannel(benchmark::State& state) {
+  Logger::instance().standardOutLogger().disable();
+  StringStreamLogSink sink;
+  sink.setLogLevel(Debug);
+  sink.setChannelRegex("openstudio\\.model\\..*");
+  LoggedClass loggedClass;
+
+  int i = 0;
+  for (auto _ : state) {
+    loggedClass.logDebug(++i, 0.5 * i);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// every message formatted and written
+static void BM_LogEnabled(benchmark::State& state) {
+  Logger::instance().standardOutLogger().disable();
+  StringStreamLogSink sink;
+  sink.setLogLevel(Debug);
+  LoggedClass loggedClass;
+
+  int i = 0;
+  for (auto _ : state) {
+    loggedClass.logDebug(++i, 0.5 * i);
+    if ((i % 10000) == 0) {
+      state.PauseTiming();
+      sink.resetStringStream();
+      state.ResumeTiming();
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_LogDisabled);
+BENCHMARK(BM_LogDisabledChannel);
+BENCHMARK(BM_LogEnabled);
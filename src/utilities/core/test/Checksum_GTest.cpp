@@ -73,6 +73,59 @@ TEST(Checksum, Paths) {
   EXPECT_EQ("00000000", openstudio::checksum(p));
 }
 
+TEST(Checksum, LargeStreams) {
+  // longer than the read buffer, with carriage returns on both sides of the buffer boundaries
+  std::string unix;
+  std::string windows;
+  for (unsigned i = 0; i < 20000; ++i) {
+    std::string line = "line " + std::to_string(i) + " of a long file";
+    unix += line + "\n";
+    windows += line + "\r\n";
+  }
+  std::stringstream unixStream(unix);
+  std::stringstream windowsStream(windows);
+  std::string expected = openstudio::checksum(unix);
+  EXPECT_EQ(expected, openstudio::checksum(unixStream));
+  EXPECT_EQ(expected, openstudio::checksum(windowsStream));
+  EXPECT_EQ(expected, openstudio::checksum(windows));
+}
+
+TEST(Checksum, CachedPaths) {
+  std::vector<openstudio::path> paths{
+    resourcesPath() / openstudio::toPath("utilities/Checksum/Checksum.txt"),
+    resourcesPath() / openstudio::toPath("utilities/Checksum/Checksum2.txt"),
+    resourcesPath() / openstudio::toPath("utilities/Checksum/"),
+    resourcesPath() / openstudio::toPath("utilities/Checksum/NotAFile.txt"),
+  };
+  for (unsigned numThreads : {1u, 4u}) {
+    std::vector<std::string> checksums = openstudio::cachedChecksums(paths, numThreads);
+    ASSERT_EQ(paths.size(), checksums.size());
+    EXPECT_EQ("1AD514BA", checksums[0]);
+    EXPECT_EQ("17B88D3A", checksums[1]);
+    EXPECT_EQ("00000000", checksums[2]);
+    EXPECT_EQ("00000000", checksums[3]);
+  }
+  EXPECT_EQ("1AD514BA", openstudio::cachedChecksum(paths[0]));
+
+  // a file that changes is checksummed again, backdated so the first checksum is cached
+  openstudio::path p = openstudio::filesystem::temp_directory_path() / openstudio::toPath("Checksum_CachedPaths.txt");
+  {
+    openstudio::filesystem::ofstream file(p, std::ios_base::binary | std::ios_base::trunc);
+    file << "Hi there";
+  }
+  openstudio::filesystem::last_write_time(p, std::time(nullptr) - 60);
+  EXPECT_EQ("1AD514BA", openstudio::cachedChecksum(p));
+  EXPECT_EQ("1AD514BA", openstudio::cachedChecksum(p));
+  {
+    // same size, the modification time tells the contents apart
+    openstudio::filesystem::ofstream file(p, std::ios_base::binary | std::ios_base::trunc);
+    file << "HI there";
+  }
+  EXPECT_EQ("D5682D26", openstudio::cachedChecksum(p));
+  EXPECT_EQ("D5682D26", openstudio::cachedChecksum(p));
+  openstudio::filesystem::remove(p);
+}
+
 TEST(Checksum, UUIDs) {
   openstudio::StringVector checksums;
   for (unsigned i = 0, n = 1000; i < n; ++i) {
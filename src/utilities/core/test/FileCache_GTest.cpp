@@ -0,0 +1,54 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "../FileCache.hpp"
+#include "../Filesystem.hpp"
+
+#include <resources.hxx>
+
+TEST(FileCache, Keys) {
+  // directories and missing files are not cached
+  EXPECT_FALSE(openstudio::fileCacheKey(resourcesPath() / openstudio::toPath("utilities/Checksum/")));
+  EXPECT_FALSE(openstudio::fileCacheKey(resourcesPath() / openstudio::toPath("utilities/Checksum/NotAFile.txt")));
+
+  openstudio::path p = openstudio::filesystem::temp_directory_path() / openstudio::toPath("FileCache_Keys.txt");
+  {
+    openstudio::filesystem::ofstream file(p, std::ios_base::binary | std::ios_base::trunc);
+    file << "Hi there";
+  }
+  // a file just written could be written again within the same second
+  EXPECT_FALSE(openstudio::fileCacheKey(p));
+
+  std::time_t lastWriteTime = std::time(nullptr) - 60;
+  openstudio::filesystem::last_write_time(p, lastWriteTime);
+  boost::optional<openstudio::FileCacheKey> key = openstudio::fileCacheKey(p);
+  ASSERT_TRUE(key);
+  EXPECT_EQ(8u, std::get<1>(*key));
+  EXPECT_EQ(lastWriteTime, std::get<2>(*key));
+  openstudio::filesystem::remove(p);
+}
+
+TEST(FileCache, Values) {
+  openstudio::FileCache<int> cache(2);
+  openstudio::FileCacheKey a("a", 1, 1);
+  openstudio::FileCacheKey b("b", 1, 1);
+  openstudio::FileCacheKey c("c", 1, 1);
+
+  EXPECT_FALSE(cache.find(a));
+  EXPECT_EQ(1, cache.insert(a, 1));
+  // the first value inserted is kept
+  EXPECT_EQ(1, cache.insert(a, 2));
+  ASSERT_TRUE(cache.find(a));
+  EXPECT_EQ(1, *cache.find(a));
+
+  EXPECT_EQ(2, cache.insert(b, 2));
+  // full, emptied before inserting
+  EXPECT_EQ(3, cache.insert(c, 3));
+  EXPECT_FALSE(cache.find(a));
+  EXPECT_FALSE(cache.find(b));
+  EXPECT_TRUE(cache.find(c));
+}
@@ -316,4 +316,59 @@ TEST(LoggerTest, file_logger_disable) {
 
   EXPECT_NO_THROW(openstudio::filesystem::remove(path));
 }
+
+TEST(LoggerTest, lazy_formatting) {
+  openstudio::Logger::instance().standardOutLogger().disable();
+
+  // counts how many times a message is formatted
+  int numFormatted = 0;
+  auto formatted = [&numFormatted]() {
+    ++numFormatted;
+    return "formatted";
+  };
+
+  {
+    StringStreamLogSink sink;
+    sink.setLogLevel(Warn);
+
+    LOG_FREE(Debug, "lazy.channel", formatted());
+    EXPECT_EQ(0, numFormatted);
+    EXPECT_FALSE(openstudio::detail::isLogEnabled(Debug, "lazy.channel"));
+    EXPECT_TRUE(openstudio::detail::isLogEnabled(Warn, "lazy.channel"));
+
+    LOG_FREE(Error, "lazy.channel", formatted());
+    EXPECT_EQ(1, numFormatted);
+    ASSERT_EQ(1u, sink.logMessages().size());
+
+    // changing the level of an enabled sink is picked up
+    sink.resetStringStream();
+    sink.setLogLevel(Debug);
+    LOG_FREE(Debug, "lazy.channel", formatted());
+    EXPECT_EQ(2, numFormatted);
+    ASSERT_EQ(1u, sink.logMessages().size());
+    EXPECT_EQ(Debug, sink.logMessages()[0].logLevel());
+
+    // so is a channel regex
+    sink.resetStringStream();
+    sink.setChannelRegex(boost::regex("other\\..*"));
+    LOG_FREE(Debug, "lazy.channel", formatted());
+    EXPECT_EQ(2, numFormatted);
+    EXPECT_TRUE(openstudio::detail::isLogEnabled(Debug, "other.channel"));
+    LOG_FREE(Debug, "other.channel", formatted());
+    EXPECT_EQ(3, numFormatted);
+    EXPECT_EQ(1u, sink.logMessages().size());
+
+    // and disabling the sink
+    sink.disable();
+    EXPECT_FALSE(openstudio::detail::isLogEnabled(Fatal, "other.channel"));
+    LOG_FREE(Fatal, "other.channel", formatted());
+    EXPECT_EQ(3, numFormatted);
+  }
+
+  // the standard out logger is back to Warn
+  openstudio::Logger::instance().standardOutLogger().enable();
+  EXPECT_FALSE(openstudio::detail::isLogEnabled(Info, "lazy.channel"));
+  EXPECT_TRUE(openstudio::detail::isLogEnabled(Warn, "lazy.channel"));
+  openstudio::Logger::instance().standardOutLogger().disable();
+}
 }  // namespace
@@ -2095,3 +2095,127 @@ TEST_F(DataFixture, TimeSeries_value_DateTime_NoYear) {
     }
   }
 }
+
+TEST_F(DataFixture, TimeSeries_SameGridArithmetic) {
+  // Arithmetic on series reported at the same times is done element wise and keeps the grid of the operands
+  Date startDate(MonthOfYear(MonthOfYear::Jan), 1);
+  DateTime firstReportDateTime(startDate, Time(0, 1, 0, 0));
+  std::vector<long> secondsFromStart = {3600, 7200, 14400, 18000, 86400};
+  Vector values1 = createVector(std::vector<double>{1.0, 2.0, 3.0, 4.0, 5.0});
+  Vector values2 = createVector(std::vector<double>{0.5, -1.0, 2.5, 0.0, 10.0});
+
+  // detailed series, the second one is constructed separately so it does not share the time axis of the first
+  TimeSeries ts1(firstReportDateTime, secondsFromStart, values1, "W");
+  TimeSeries ts2(firstReportDateTime, secondsFromStart, values2, "W");
+  EXPECT_FALSE(ts1.intervalLength());
+
+  TimeSeries sumSeries = ts1 + ts2;
+  TimeSeries diffSeries = ts1 - ts2;
+  TimeSeries multSeries = ts1 * 2.0;
+  for (const TimeSeries& ts : {sumSeries, diffSeries, multSeries}) {
+    EXPECT_EQ(ts1.firstReportDateTime(), ts.firstReportDateTime());
+    EXPECT_EQ(ts1.startDateTime(), ts.startDateTime());
+    EXPECT_EQ(ts1.secondsFromFirstReport(), ts.secondsFromFirstReport());
+    EXPECT_FALSE(ts.intervalLength());
+    ASSERT_EQ(5u, ts.values().size());
+  }
+  for (unsigned i = 0; i < 5; ++i) {
+    EXPECT_EQ(values1[i] + values2[i], sumSeries.values(i));
+    EXPECT_EQ(values1[i] - values2[i], diffSeries.values(i));
+    EXPECT_EQ(2.0 * values1[i], multSeries.values(i));
+  }
+  EXPECT_DOUBLE_EQ(ts1.integrate() + ts2.integrate(), sumSeries.integrate());
+  EXPECT_DOUBLE_EQ(2.0 * ts1.integrate(), multSeries.integrate());
+  EXPECT_DOUBLE_EQ(2.0 * ts1.averageValue(), multSeries.averageValue());
+
+  // lookups between reports still hold the next value
+  EXPECT_EQ(values1[2] + values2[2], sumSeries.value(Time(0, 2, 30, 0)));
+  EXPECT_EQ(values1[4] + values2[4], sumSeries.value(Time(0, 23, 0, 0)));
+
+  // summing many series on the same grid is the same as adding them one at a time
+  TimeSeriesVector series = {ts1, ts2, multSeries, diffSeries};
+  TimeSeries total = openstudio::sum(series);
+  TimeSeries expected = ((ts1 + ts2) + multSeries) + diffSeries;
+  EXPECT_EQ(expected.secondsFromFirstReport(), total.secondsFromFirstReport());
+  for (unsigned i = 0; i < 5; ++i) {
+    EXPECT_EQ(expected.values(i), total.values(i));
+  }
+
+  // interval series keep their interval
+  Time interval(0, 1, 0, 0);
+  TimeSeries interval1(firstReportDateTime, interval, values1, "W");
+  TimeSeries interval2(firstReportDateTime, interval, values2, "W");
+  TimeSeries intervalSum = interval1 + interval2;
+  ASSERT_TRUE(intervalSum.intervalLength());
+  EXPECT_EQ(interval, intervalSum.intervalLength().get());
+  EXPECT_DOUBLE_EQ(interval1.integrate() + interval2.integrate(), intervalSum.integrate());
+
+  // series on different grids are still merged on the union of their report times
+  TimeSeries shifted(DateTime(startDate, Time(0, 2, 0, 0)), interval, values2, "W");
+  TimeSeries mixed = interval1 + shifted;
+  EXPECT_EQ(6u, mixed.values().size());
+  EXPECT_FALSE(mixed.intervalLength());
+  series = {interval1, interval2, shifted};
+  EXPECT_EQ(6u, openstudio::sum(series).values().size());
+
+  // different units still give an empty series
+  TimeSeries otherUnits(firstReportDateTime, secondsFromStart, values2, "J");
+  EXPECT_TRUE((ts1 + otherUnits).values().empty());
+  series = {ts1, otherUnits};
+  EXPECT_TRUE(openstudio::sum(series).values().empty());
+}
+
+TEST_F(DataFixture, TimeSeries_Clone) {
+  Date startDate(Date(MonthOfYear(MonthOfYear::Jan), 1));
+  Time interval(0, 1, 0, 0);
+  Vector values = createVector(std::vector<double>{1.0, 2.0, 3.0});
+  TimeSeries ts(startDate, interval, values, "W");
+
+  // a clone reports the same data
+  TimeSeries cloned = ts.clone();
+  EXPECT_EQ(ts.secondsFromFirstReport(), cloned.secondsFromFirstReport());
+  for (unsigned i = 0; i < 3; ++i) {
+    EXPECT_EQ(ts.values(i), cloned.values(i));
+  }
+
+  // but setters on the clone do not affect the original, unlike a copy
+  cloned.setOutOfRangeValue(-1.0);
+  EXPECT_EQ(0.0, ts.outOfRangeValue());
+  EXPECT_EQ(0.0, ts.values(10));
+  EXPECT_EQ(-1.0, cloned.values(10));
+
+  TimeSeries copied = ts;
+  copied.setOutOfRangeValue(-2.0);
+  EXPECT_EQ(-2.0, ts.outOfRangeValue());
+}
+
+TEST_F(DataFixture, TimeSeries_SharedReportingTimes) {
+  DateTime firstReportDateTime(Date(MonthOfYear(MonthOfYear::Jan), 1), Time(0, 1, 0, 0));
+  std::vector<long> secondsFromStart = {3600, 7200, 14400};
+  TimeSeries ts(firstReportDateTime, secondsFromStart, createVector(std::vector<double>{1.0, 2.0, 3.0}), "W");
+
+  // the new series reports at the same times with its own values and units, which are moved in
+  Vector values = createVector(std::vector<double>{4.0, 5.0, 6.0});
+  TimeSeries other(ts, std::move(values), "J");
+  EXPECT_TRUE(values.empty());
+  EXPECT_EQ(ts.firstReportDateTime(), other.firstReportDateTime());
+  EXPECT_EQ(ts.secondsFromFirstReport(), other.secondsFromFirstReport());
+  EXPECT_FALSE(other.intervalLength());
+  EXPECT_EQ("W", ts.units());
+  EXPECT_EQ("J", other.units());
+  ASSERT_EQ(3u, other.values().size());
+  EXPECT_EQ(1.0, ts.values(0));
+  EXPECT_EQ(4.0, other.values(0));
+  EXPECT_EQ(6.0, other.values(2));
+  EXPECT_EQ(5.0, other.value(Time(0, 0, 30, 0)));
+
+  // interval series keep their interval
+  TimeSeries interval(firstReportDateTime, Time(0, 1, 0, 0), createVector(std::vector<double>{1.0, 2.0}), "W");
+  TimeSeries otherInterval(interval, createVector(std::vector<double>{3.0, 4.0}), "W");
+  ASSERT_TRUE(otherInterval.intervalLength());
+  EXPECT_EQ(Time(0, 1, 0, 0), otherInterval.intervalLength().get());
+  EXPECT_DOUBLE_EQ(interval.integrate() + otherInterval.integrate(), (interval + otherInterval).integrate());
+
+  // values must match the reporting times
+  EXPECT_THROW(TimeSeries(ts, createVector(std::vector<double>{1.0}), "W"), std::exception);
+}
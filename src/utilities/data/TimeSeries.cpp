@@ -6,6 +6,9 @@
 #include "TimeSeries.hpp"
 #include "../core/Assert.hpp"
 
+#include <algorithm>
+#include <functional>
+
 using namespace std;
 using namespace boost;
 
@@ -13,16 +16,50 @@ namespace openstudio {
 
 namespace detail {
 
-  TimeSeries_Impl::TimeSeries_Impl() : m_outOfRangeValue(0.0), m_wrapAround(false) {}
+  namespace {
+
+    // element wise kernels work on the contiguous storage of the vectors so that the compiler can vectorize them
+    template <typename BinaryOperation>
+    Vector elementWise(const Vector& lhs, const Vector& rhs, BinaryOperation op) {
+      OS_ASSERT(lhs.size() == rhs.size());
+      Vector result(lhs.size());
+      std::transform(lhs.data().begin(), lhs.data().end(), rhs.data().begin(), result.data().begin(), op);
+      return result;
+    }
+
+  }  // namespace
+
+  TimeSeries_Impl::TimeSeries_Impl() : m_outOfRangeValue(0.0), m_wrapAround(false) {
+    static const std::shared_ptr<const TimeAxis> emptyAxis = std::make_shared<TimeAxis>();
+    static const std::shared_ptr<const Vector> emptyValues = std::make_shared<Vector>();
+    m_axis = emptyAxis;
+    m_values = emptyValues;
+  }
+
+  TimeSeries_Impl::TimeSeries_Impl(const TimeSeries_Impl& reportingTimes, Vector&& values, const std::string& units)
+    : m_firstReportDateTime(reportingTimes.m_firstReportDateTime),
+      m_startDateTime(reportingTimes.m_startDateTime),
+      m_axis(reportingTimes.m_axis),
+      m_units(units),
+      m_intervalLength(reportingTimes.m_intervalLength),
+      m_outOfRangeValue(0.0),
+      m_wrapAround(reportingTimes.m_wrapAround) {
+    if (values.size() != m_axis->secondsFromFirstReport.size()) {
+      LOG_AND_THROW("Length of values (" << values.size() << ") must match length of times (" << m_axis->secondsFromFirstReport.size() << ")");
+    }
+    // ublas vectors have no move constructor, swapping hands over the storage
+    auto sharedValues = std::make_shared<Vector>();
+    sharedValues->swap(values);
+    m_values = sharedValues;
+  }
 
   TimeSeries_Impl::TimeSeries_Impl(const Date& startDate, const Time& intervalLength, const Vector& values, const std::string& units)
-    : m_secondsFromFirstReport(values.size()),
-      m_secondsFromStart(values.size()),
-      m_values(values),
+    : m_values(std::make_shared<Vector>(values)),
       m_units(units),
       m_intervalLength(intervalLength),
       m_outOfRangeValue(0.0),
       m_wrapAround(false) {
+    auto axis = std::make_shared<TimeAxis>(values.size());
     if (values.empty()) {
       LOG(Warn, "Creating empty timeseries");
     }
@@ -37,14 +74,13 @@ namespace detail {
     m_startDateTime = DateTime(startDate, Time(0));
 
     for (unsigned i = 0; i < values.size(); ++i) {
-      m_secondsFromFirstReport[i] = i * secondsPerInterval;
-      m_secondsFromStart[i] = (i + 1) * secondsPerInterval;
+      axis->secondsFromFirstReport[i] = i * secondsPerInterval;
+      axis->secondsFromStart[i] = (i + 1) * secondsPerInterval;
     }
-    m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
 
     long durationSeconds = 0;
-    if (!m_secondsFromFirstReport.empty()) {
-      durationSeconds = m_secondsFromFirstReport.back();
+    if (!axis->secondsFromFirstReport.empty()) {
+      durationSeconds = axis->secondsFromFirstReport.back();
     }
 
     // check for wrap around
@@ -56,16 +92,16 @@ namespace detail {
         m_wrapAround = true;
       }
     }
+    m_axis = axis;
   }
 
   TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const Time& intervalLength, const Vector& values, const std::string& units)
-    : m_secondsFromFirstReport(values.size()),
-      m_secondsFromStart(values.size()),
-      m_values(values),
+    : m_values(std::make_shared<Vector>(values)),
       m_units(units),
       m_intervalLength(intervalLength),
       m_outOfRangeValue(0.0),
       m_wrapAround(false) {
+    auto axis = std::make_shared<TimeAxis>(values.size());
     if (values.empty()) {
       LOG(Warn, "Creating empty timeseries");
     }
@@ -79,14 +115,13 @@ namespace detail {
     m_startDateTime = m_firstReportDateTime - intervalLength;
 
     for (unsigned i = 0; i < values.size(); ++i) {
-      m_secondsFromFirstReport[i] = i * secondsPerInterval;
-      m_secondsFromStart[i] = (i + 1) * secondsPerInterval;
+      axis->secondsFromFirstReport[i] = i * secondsPerInterval;
+      axis->secondsFromStart[i] = (i + 1) * secondsPerInterval;
     }
-    m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
 
     long durationSeconds = 0;
-    if (!m_secondsFromFirstReport.empty()) {
-      durationSeconds = m_secondsFromFirstReport.back();
+    if (!axis->secondsFromFirstReport.empty()) {
+      durationSeconds = axis->secondsFromFirstReport.back();
     }
 
     // check for wrap around
@@ -98,15 +133,15 @@ namespace detail {
         m_wrapAround = true;
       }
     }
+    m_axis = axis;
   }
 
   TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const Vector& timeInDays, const Vector& values, const std::string& units)
-    : m_secondsFromFirstReport(values.size()),
-      m_secondsFromStart(values.size()),
-      m_values(values),
+    : m_values(std::make_shared<Vector>(values)),
       m_units(units),
       m_outOfRangeValue(0.0),
       m_wrapAround(false) {
+    auto axis = std::make_shared<TimeAxis>(values.size());
     if (timeInDays.size() != values.size()) {
       LOG_AND_THROW("Length of values (" << values.size() << ") must match length of times (" << timeInDays.size() << ")");
     }
@@ -120,8 +155,6 @@ namespace detail {
       // DLM: firstReportDateTime may or may not have baseYear defined
       m_firstReportDateTime = firstReportDateTime;
 
-      std::copy(values.begin(), values.end(), m_values.begin());
-
       if (timeInDays[0] == 0) {  // This is the old, BROKEN way
         int firstIntervalSeconds = firstReportDateTime.time().totalSeconds();
         if (firstIntervalSeconds == 0) {
@@ -132,10 +165,10 @@ namespace detail {
         m_startDateTime = DateTime(m_firstReportDateTime.date());
 
         for (unsigned i = 0; i < values.size(); ++i) {
-          m_secondsFromFirstReport[i] = Time(timeInDays[i]).totalSeconds();
-          m_secondsFromStart[i] = m_secondsFromFirstReport[i] + firstIntervalSeconds;
+          axis->secondsFromFirstReport[i] = Time(timeInDays[i]).totalSeconds();
+          axis->secondsFromStart[i] = axis->secondsFromFirstReport[i] + firstIntervalSeconds;
           if (i > 0) {
-            if (m_secondsFromFirstReport[i] < m_secondsFromFirstReport[i - 1]) {
+            if (axis->secondsFromFirstReport[i] < axis->secondsFromFirstReport[i - 1]) {
               LOG_AND_THROW("Days from first report must be monotonically increasing");
             }
           }
@@ -143,21 +176,19 @@ namespace detail {
       } else {  // This is the new way
         m_startDateTime = m_firstReportDateTime - Time(timeInDays[0]);
         for (unsigned i = 0; i < values.size(); ++i) {
-          m_secondsFromStart[i] = Time(timeInDays[i]).totalSeconds();
-          m_secondsFromFirstReport[i] = m_secondsFromStart[i] - m_secondsFromStart[0];
+          axis->secondsFromStart[i] = Time(timeInDays[i]).totalSeconds();
+          axis->secondsFromFirstReport[i] = axis->secondsFromStart[i] - axis->secondsFromStart[0];
           if (i > 0) {
-            if (m_secondsFromFirstReport[i] < m_secondsFromFirstReport[i - 1]) {
+            if (axis->secondsFromFirstReport[i] < axis->secondsFromFirstReport[i - 1]) {
               LOG_AND_THROW("Days from first report must be monotonically increasing");
             }
           }
         }
       }
 
-      m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
-
       long durationSeconds = 0;
-      if (!m_secondsFromFirstReport.empty()) {
-        durationSeconds = m_secondsFromFirstReport.back();
+      if (!axis->secondsFromFirstReport.empty()) {
+        durationSeconds = axis->secondsFromFirstReport.back();
       }
 
       // check for wrap around
@@ -170,16 +201,16 @@ namespace detail {
         }
       }
     }
+    m_axis = axis;
   }
 
   TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const std::vector<double>& timeInDays, const std::vector<double>& values,
                                    const std::string& units)
-    : m_secondsFromFirstReport(timeInDays.size()),
-      m_secondsFromStart(values.size()),
-      m_values(values.size()),
+    : m_values(std::make_shared<Vector>(createVector(values))),
       m_units(units),
       m_outOfRangeValue(0.0),
       m_wrapAround(false) {
+    auto axis = std::make_shared<TimeAxis>(values.size());
 
     if (timeInDays.size() != values.size()) {
       LOG_AND_THROW("Length of values (" << values.size() << ") must match length of times (" << timeInDays.size() << ")");
@@ -194,8 +225,6 @@ namespace detail {
       // DLM: firstReportDateTime may or may not have baseYear defined
       m_firstReportDateTime = firstReportDateTime;
 
-      std::copy(values.begin(), values.end(), m_values.begin());
-
       if (timeInDays[0] == 0) {  // This is the old, BROKEN way
         int firstIntervalSeconds = firstReportDateTime.time().totalSeconds();
         if (firstIntervalSeconds == 0) {
@@ -206,10 +235,10 @@ namespace detail {
         m_startDateTime = DateTime(m_firstReportDateTime.date());
 
         for (unsigned i = 0; i < values.size(); ++i) {
-          m_secondsFromFirstReport[i] = Time(timeInDays[i]).totalSeconds();
-          m_secondsFromStart[i] = m_secondsFromFirstReport[i] + firstIntervalSeconds;
+          axis->secondsFromFirstReport[i] = Time(timeInDays[i]).totalSeconds();
+          axis->secondsFromStart[i] = axis->secondsFromFirstReport[i] + firstIntervalSeconds;
           if (i > 0) {
-            if (m_secondsFromFirstReport[i] < m_secondsFromFirstReport[i - 1]) {
+            if (axis->secondsFromFirstReport[i] < axis->secondsFromFirstReport[i - 1]) {
               LOG_AND_THROW("Days from first report must be monotonically increasing");
             }
           }
@@ -217,21 +246,19 @@ namespace detail {
       } else {  // This is the new way
         m_startDateTime = m_firstReportDateTime - Time(timeInDays[0]);
         for (unsigned i = 0; i < values.size(); ++i) {
-          m_secondsFromStart[i] = Time(timeInDays[i]).totalSeconds();
-          m_secondsFromFirstReport[i] = m_secondsFromStart[i] - m_secondsFromStart[0];
+          axis->secondsFromStart[i] = Time(timeInDays[i]).totalSeconds();
+          axis->secondsFromFirstReport[i] = axis->secondsFromStart[i] - axis->secondsFromStart[0];
           if (i > 0) {
-            if (m_secondsFromFirstReport[i] < m_secondsFromFirstReport[i - 1]) {
+            if (axis->secondsFromFirstReport[i] < axis->secondsFromFirstReport[i - 1]) {
               LOG_AND_THROW("Days from first report must be monotonically increasing");
             }
           }
         }
       }
 
-      m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
-
       long durationSeconds = 0;
-      if (!m_secondsFromFirstReport.empty()) {
-        durationSeconds = m_secondsFromFirstReport.back();
+      if (!axis->secondsFromFirstReport.empty()) {
+        durationSeconds = axis->secondsFromFirstReport.back();
       }
 
       // check for wrap around
@@ -244,15 +271,15 @@ namespace detail {
         }
       }
     }
+    m_axis = axis;
   }
 
   TimeSeries_Impl::TimeSeries_Impl(const DateTimeVector& inDateTimes, const Vector& values, const std::string& units)
-    : m_secondsFromFirstReport(values.size()),
-      m_secondsFromStart(values.size()),
-      m_values(values),
+    : m_values(std::make_shared<Vector>(values)),
       m_units(units),
       m_outOfRangeValue(0.0),
       m_wrapAround(false) {
+    auto axis = std::make_shared<TimeAxis>(values.size());
     // DLM: this seems to be a pretty fragile constructor with a lot going on
 
     if (values.empty() || inDateTimes.empty()) {
@@ -289,8 +316,8 @@ namespace detail {
 
       // Compute the seconds from first report
       if (m_wrapAround) {
-        m_secondsFromFirstReport[0] = 0;
-        m_secondsFromStart[0] = 0;
+        axis->secondsFromFirstReport[0] = 0;
+        axis->secondsFromStart[0] = 0;
         int delta = 0;
         DateTime firstReportDateTimeWithYear =
           DateTime(Date(m_firstReportDateTime.date().monthOfYear(), m_firstReportDateTime.date().dayOfMonth(), m_firstReportDateTime.date().year()),
@@ -305,20 +332,20 @@ namespace detail {
               DateTime(Date(dateTimes[i].date().monthOfYear(), dateTimes[i].date().dayOfMonth(), m_firstReportDateTime.date().year() + delta),
                        dateTimes[i].time());
           }
-          m_secondsFromFirstReport[i] = (wrappedDateTime - firstReportDateTimeWithYear).totalSeconds();
-          m_secondsFromStart[i] = (wrappedDateTime - firstReportDateTimeWithYear).totalSeconds();
+          axis->secondsFromFirstReport[i] = (wrappedDateTime - firstReportDateTimeWithYear).totalSeconds();
+          axis->secondsFromStart[i] = (wrappedDateTime - firstReportDateTimeWithYear).totalSeconds();
         }
       } else {
-        m_secondsFromFirstReport[0] = 0;
-        m_secondsFromStart[0] = 0;
+        axis->secondsFromFirstReport[0] = 0;
+        axis->secondsFromStart[0] = 0;
         for (unsigned i = 1; i < dateTimes.size(); i++) {
-          m_secondsFromFirstReport[i] = (dateTimes[i] - m_firstReportDateTime).totalSeconds();
-          m_secondsFromStart[i] = (dateTimes[i] - m_firstReportDateTime).totalSeconds();
+          axis->secondsFromFirstReport[i] = (dateTimes[i] - m_firstReportDateTime).totalSeconds();
+          axis->secondsFromStart[i] = (dateTimes[i] - m_firstReportDateTime).totalSeconds();
         }
       }
 
       for (unsigned i = 1; i < dateTimes.size(); i++) {
-        if (m_secondsFromStart[i] < m_secondsFromStart[i - 1]) {
+        if (axis->secondsFromStart[i] < axis->secondsFromStart[i - 1]) {
           LOG_AND_THROW("Dates from first report must be monotonically increasing");
         }
       }
@@ -327,12 +354,12 @@ namespace detail {
       if (!extraTime) {
         int delta;
         bool foundInterval = false;
-        if (m_secondsFromStart.size() > 1) {
+        if (axis->secondsFromStart.size() > 1) {
           // check if all data is reported at a constant interval
-          delta = m_secondsFromStart[1] - m_secondsFromStart[0];
+          delta = axis->secondsFromStart[1] - axis->secondsFromStart[0];
           foundInterval = true;
-          for (unsigned i = 2; i < m_secondsFromStart.size(); i++) {
-            if (delta != m_secondsFromStart[i] - m_secondsFromStart[i - 1]) {
+          for (unsigned i = 2; i < axis->secondsFromStart.size(); i++) {
+            if (delta != axis->secondsFromStart[i] - axis->secondsFromStart[i - 1]) {
               foundInterval = false;
             }
             break;
@@ -356,23 +383,22 @@ namespace detail {
       int firstIntervalSeconds = (m_firstReportDateTime - m_startDateTime).totalSeconds();
 
       // Compute the seconds from start
-      m_secondsFromStart[0] = firstIntervalSeconds;
+      axis->secondsFromStart[0] = firstIntervalSeconds;
       for (unsigned i = 1; i < dateTimes.size(); i++) {
-        m_secondsFromStart[i] = m_secondsFromStart[i] + firstIntervalSeconds;
+        axis->secondsFromStart[i] = axis->secondsFromStart[i] + firstIntervalSeconds;
       }
 
-      m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
     }
+    m_axis = axis;
   }
 
   TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const std::vector<long>& timeInSeconds, const Vector& values,
                                    const std::string& units)
-    : m_secondsFromFirstReport(values.size()),
-      m_secondsFromStart(values.size()),
-      m_values(values),
+    : m_values(std::make_shared<Vector>(values)),
       m_units(units),
       m_outOfRangeValue(0.0),
       m_wrapAround(false) {
+    auto axis = std::make_shared<TimeAxis>(values.size());
     if (timeInSeconds.size() != values.size()) {
       LOG_AND_THROW("Length of values (" << values.size() << ") must match length of times (" << timeInSeconds.size() << ")");
     }
@@ -397,30 +423,28 @@ namespace detail {
         m_startDateTime = DateTime(firstReportDateTime.date());
         m_firstReportDateTime = firstReportDateTime;
         int firstIntervalSeconds = m_firstReportDateTime.time().totalSeconds();
-        m_secondsFromStart = timeInSeconds;
-        for (unsigned i = 0; i < m_secondsFromStart.size(); i++) {
-          m_secondsFromStart[i] += firstIntervalSeconds;
+        axis->secondsFromStart = timeInSeconds;
+        for (unsigned i = 0; i < axis->secondsFromStart.size(); i++) {
+          axis->secondsFromStart[i] += firstIntervalSeconds;
         }
-        m_secondsFromFirstReport = timeInSeconds;
+        axis->secondsFromFirstReport = timeInSeconds;
 
       } else {  // This is the new behavior
         m_startDateTime = firstReportDateTime - Time(0, 0, 0, timeInSeconds[0]);
         m_firstReportDateTime = firstReportDateTime;
-        m_secondsFromStart = timeInSeconds;
+        axis->secondsFromStart = timeInSeconds;
 
         // Get rid of this later
-        m_secondsFromFirstReport[0] = 0;
+        axis->secondsFromFirstReport[0] = 0;
         for (unsigned i = 1; i < values.size(); ++i) {
-          m_secondsFromFirstReport[i] = timeInSeconds[i] - timeInSeconds[0];
+          axis->secondsFromFirstReport[i] = timeInSeconds[i] - timeInSeconds[0];
         }
       }
     }
 
-    m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
-
     long durationSeconds = 0;
-    if (!m_secondsFromFirstReport.empty()) {
-      durationSeconds = m_secondsFromFirstReport.back();
+    if (!axis->secondsFromFirstReport.empty()) {
+      durationSeconds = axis->secondsFromFirstReport.back();
     }
 
     // check for wrap around
@@ -432,6 +456,7 @@ namespace detail {
         m_wrapAround = true;
       }
     }
+    m_axis = axis;
   }
 
   /// interval length if any
@@ -440,18 +465,18 @@ namespace detail {
   }
 
   DateTimeVector TimeSeries_Impl::dateTimes() const {
-    DateTimeVector dateTimeObjs(m_secondsFromFirstReport.size());
-    for (unsigned i = 0; i < m_secondsFromFirstReport.size(); i++) {
-      dateTimeObjs[i] = m_firstReportDateTime + openstudio::Time(0, 0, 0, m_secondsFromFirstReport[i]);
+    DateTimeVector dateTimeObjs(m_axis->secondsFromFirstReport.size());
+    for (unsigned i = 0; i < m_axis->secondsFromFirstReport.size(); i++) {
+      dateTimeObjs[i] = m_firstReportDateTime + openstudio::Time(0, 0, 0, m_axis->secondsFromFirstReport[i]);
     }
     return dateTimeObjs;
   }
 
   /// time in days from end of the first reporting interval
   Vector TimeSeries_Impl::daysFromFirstReport() const {
-    Vector daysFromFirstReport(m_secondsFromFirstReport.size());
-    for (unsigned i = 0; i < m_secondsFromFirstReport.size(); i++) {
-      daysFromFirstReport[i] = Time(0, 0, 0, m_secondsFromFirstReport[i]).totalDays();
+    Vector daysFromFirstReport(m_axis->secondsFromFirstReport.size());
+    for (unsigned i = 0; i < m_axis->secondsFromFirstReport.size(); i++) {
+      daysFromFirstReport[i] = Time(0, 0, 0, m_axis->secondsFromFirstReport[i]).totalDays();
     }
     return daysFromFirstReport;
   }
@@ -459,37 +484,37 @@ namespace detail {
   /// time in days from end of the first reporting interval at index i
   double TimeSeries_Impl::daysFromFirstReport(unsigned int i) const {
     double value = m_outOfRangeValue;
-    if (i < m_secondsFromFirstReport.size()) {
-      value = Time(0, 0, 0, m_secondsFromFirstReport[i]).totalDays();
+    if (i < m_axis->secondsFromFirstReport.size()) {
+      value = Time(0, 0, 0, m_axis->secondsFromFirstReport[i]).totalDays();
     }
     return value;
   }
 
   /// time in seconds from end of the first reporting interval
   std::vector<long> TimeSeries_Impl::secondsFromFirstReport() const {
-    return m_secondsFromFirstReport;
+    return m_axis->secondsFromFirstReport;
   }
 
   /// time in seconds from end of the first reporting interval at index i
   long TimeSeries_Impl::secondsFromFirstReport(unsigned int i) const {
     //double value = m_outOfRangeValue; // JWD: Shouldn't the out of range value be for values only?
     long value = 0;
-    if (i < m_secondsFromFirstReport.size()) {
-      value = m_secondsFromFirstReport[i];
+    if (i < m_axis->secondsFromFirstReport.size()) {
+      value = m_axis->secondsFromFirstReport[i];
     }
     return value;
   }
 
   /// values
   Vector TimeSeries_Impl::values() const {
-    return m_values;
+    return *m_values;
   }
 
   /// values at index i
   double TimeSeries_Impl::values(unsigned int i) const {
     double value = m_outOfRangeValue;
-    if (i < m_values.size()) {
-      value = m_values[i];
+    if (i < m_values->size()) {
+      value = (*m_values)[i];
     }
     return value;
   }
@@ -513,12 +538,12 @@ namespace detail {
   double TimeSeries_Impl::valueAtSecondsFromFirstReport(long secondsFromFirstReport) const {
     double result = m_outOfRangeValue;
 
-    if (m_secondsFromFirstReport.empty()) {
+    if (m_axis->secondsFromFirstReport.empty()) {
       LOG(Debug, "Cannot compute value because timeseries is empty");
       return result;
     }
 
-    long duration = m_secondsFromFirstReport.back();
+    long duration = m_axis->secondsFromFirstReport.back();
 
     if (m_intervalLength) {
 
@@ -545,12 +570,12 @@ namespace detail {
         }
 
         // issue with daily, hourly flood plots when index == m_values.size()
-        if (index >= m_values.size()) {
+        if (index >= m_values->size()) {
           LOG(Warn,
-              "Timeseries index " << index << " is greater than or equal to values size " << m_values.size() << " and has been set to size - 1.");
+              "Timeseries index " << index << " is greater than or equal to values size " << m_values->size() << " and has been set to size - 1.");
           index = index - 1;
         }
-        result = m_values(index);
+        result = (*m_values)(index);
       }
 
     } else {
@@ -564,8 +589,13 @@ namespace detail {
         LOG(Debug,
             "Cannot compute value " << secondsFromFirstReport << " seconds after first reporting time when duration is " << duration << " seconds");
       } else {
-        // normal interpolation
-        result = interp(m_secondsFromFirstReportAsVector, m_values, secondsFromFirstReport, HoldNextInterp, NoneExtrap);
+        // hold the next reported value, same as interp with HoldNextInterp but without a floating point copy of the times
+        const std::vector<long>& times = m_axis->secondsFromFirstReport;
+        size_t index = times.size() - 1;
+        if (secondsFromFirstReport != duration) {
+          index = std::lower_bound(times.begin(), times.end(), secondsFromFirstReport) - times.begin();
+        }
+        result = (*m_values)(index);
       }
     }
 
@@ -669,14 +699,14 @@ namespace detail {
     double startSecondsFromFirstReport = (startDateTimeWithYear - firstReportDateTimeWithYear).totalSeconds();
     double endSecondsFromFirstReport = (endDateTimeWithYear - firstReportDateTimeWithYear).totalSeconds();
 
-    unsigned numValues = m_values.size();
-    OS_ASSERT(numValues == m_secondsFromFirstReport.size());
+    unsigned numValues = m_values->size();
+    OS_ASSERT(numValues == m_axis->secondsFromFirstReport.size());
 
     Vector result(numValues);
     unsigned resultSize = 0;
     for (unsigned i = 0; i < numValues; ++i) {
-      if ((m_secondsFromFirstReport[i] >= startSecondsFromFirstReport) && (m_secondsFromFirstReport[i] <= endSecondsFromFirstReport)) {
-        result[resultSize] = m_values[i];
+      if ((m_axis->secondsFromFirstReport[i] >= startSecondsFromFirstReport) && (m_axis->secondsFromFirstReport[i] <= endSecondsFromFirstReport)) {
+        result[resultSize] = (*m_values)[i];
         ++resultSize;
       }
     }
@@ -705,7 +735,10 @@ namespace detail {
     std::shared_ptr<TimeSeries_Impl> result(new TimeSeries_Impl());
 
     // if same units
-    if (m_units == other.units()) {
+    if ((m_units == other.units()) && sameGrid(other)) {
+      result = std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(*this, elementWise(*m_values, *other.m_values, std::plus<double>()), m_units));
+
+    } else if (m_units == other.units()) {
 
       // make unique, ordered set of all date times
       std::set<DateTime> dateTimesSet;
@@ -743,7 +776,10 @@ namespace detail {
     std::shared_ptr<TimeSeries_Impl> result(new TimeSeries_Impl());
 
     // if same units
-    if (m_units == other.units()) {
+    if ((m_units == other.units()) && sameGrid(other)) {
+      result = std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(*this, elementWise(*m_values, *other.m_values, std::minus<double>()), m_units));
+
+    } else if (m_units == other.units()) {
 
       // make unique, ordered set of all date times
       std::set<DateTime> dateTimesSet;
@@ -777,38 +813,73 @@ namespace detail {
   }
 
   std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::operator*(double d) const {
-    if (m_intervalLength) {
-      return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(m_firstReportDateTime, m_intervalLength.get(), m_values * d, m_units));
-    }
-    return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(m_firstReportDateTime, m_secondsFromFirstReport, m_values * d, m_units));
+    Vector values(m_values->size());
+    std::transform(m_values->data().begin(), m_values->data().end(), values.data().begin(), [d](double value) { return value * d; });
+    return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(*this, std::move(values), m_units));
   }
 
   double TimeSeries_Impl::integrate() const {
+    // values are summed in order so that the result does not depend on how the loop is compiled
+    const double* values = m_values->data().begin();
+    const size_t size = m_values->size();
     double result = 0;
     if (m_intervalLength) {
       int secs = m_intervalLength.get().totalSeconds();
       // Use a Riemann sum to integrate under the curve
-      for (unsigned i = 0; i < m_values.size(); i++) {
-        result += secs * m_values[i];
+      for (size_t i = 0; i < size; i++) {
+        result += secs * values[i];
       }
     } else {
+      const std::vector<long>& secondsFromStart = m_axis->secondsFromStart;
       double lastTime = 0;
       // Use a Riemann sum to integrate under the curve
-      for (unsigned i = 0; i < m_values.size(); i++) {
-        result += (m_secondsFromStart[i] - lastTime) * m_values[i];
-        lastTime = m_secondsFromStart[i];
+      for (size_t i = 0; i < size; i++) {
+        result += (secondsFromStart[i] - lastTime) * values[i];
+        lastTime = secondsFromStart[i];
       }
     }
     return result;
   }
 
   double TimeSeries_Impl::averageValue() const {
-    if (!m_secondsFromStart.empty()) {
-      return integrate() / m_secondsFromStart.back();
+    if (!m_axis->secondsFromStart.empty()) {
+      return integrate() / m_axis->secondsFromStart.back();
     }
     return 0;
   }
 
+  bool TimeSeries_Impl::empty() const {
+    return m_values->empty();
+  }
+
+  bool TimeSeries_Impl::sameGrid(const TimeSeries_Impl& other) const {
+    if ((m_values->size() != other.m_values->size()) || (m_firstReportDateTime != other.m_firstReportDateTime)
+        || (m_startDateTime != other.m_startDateTime) || (m_intervalLength != other.m_intervalLength) || (m_wrapAround != other.m_wrapAround)) {
+      return false;
+    }
+    if (m_axis == other.m_axis) {
+      return true;
+    }
+    return (m_axis->secondsFromFirstReport == other.m_axis->secondsFromFirstReport)
+           && (m_axis->secondsFromStart == other.m_axis->secondsFromStart);
+  }
+
+  std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::sumSameGrid(const std::vector<TimeSeries>& timeSeriesVector) {
+    OS_ASSERT(!timeSeriesVector.empty());
+    const TimeSeries_Impl& first = *timeSeriesVector.front().m_impl;
+
+    // accumulate in place, adding the series in order gives the same result as adding them one at a time
+    Vector values = *first.m_values;
+    double* result = values.data().begin();
+    for (size_t i = 1; i < timeSeriesVector.size(); ++i) {
+      const TimeSeries_Impl& other = *timeSeriesVector[i].m_impl;
+      OS_ASSERT((other.m_units == first.m_units) && first.sameGrid(other));
+      std::transform(result, result + values.size(), other.m_values->data().begin(), result, std::plus<double>());
+    }
+
+    return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(first, std::move(values), first.m_units));
+  }
+
 }  // namespace detail
 
 TimeSeries::TimeSeries() : m_impl(std::shared_ptr<detail::TimeSeries_Impl>(new detail::TimeSeries_Impl())) {}
@@ -832,6 +903,9 @@ TimeSeries::TimeSeries(const DateTimeVector& dateTimes, const Vector& values, co
 TimeSeries::TimeSeries(const DateTime& firstReportDateTime, const std::vector<long>& timeInSeconds, const Vector& values, const std::string& units)
   : m_impl(std::shared_ptr<detail::TimeSeries_Impl>(new detail::TimeSeries_Impl(firstReportDateTime, timeInSeconds, values, units))) {}
 
+TimeSeries::TimeSeries(const TimeSeries& reportingTimes, Vector&& values, const std::string& units)
+  : m_impl(std::shared_ptr<detail::TimeSeries_Impl>(new detail::TimeSeries_Impl(*reportingTimes.m_impl, std::move(values), units))) {}
+
 openstudio::OptionalTime TimeSeries::intervalLength() const {
   return m_impl->intervalLength();
 }
@@ -900,6 +974,10 @@ void TimeSeries::setOutOfRangeValue(double value) {
   m_impl->setOutOfRangeValue(value);
 }
 
+TimeSeries TimeSeries::clone() const {
+  return {std::make_shared<detail::TimeSeries_Impl>(*m_impl)};
+}
+
 TimeSeries TimeSeries::operator+(const TimeSeries& other) const {
   std::shared_ptr<detail::TimeSeries_Impl> impl = (*m_impl) + *(other.m_impl);
   return {impl};
@@ -935,6 +1013,16 @@ TimeSeries operator*(double d, const TimeSeries& series) {
 }
 
 TimeSeries sum(const std::vector<TimeSeries>& timeSeriesVector) {
+  if ((timeSeriesVector.size() > 1) && !timeSeriesVector.front().m_impl->empty()) {
+    const detail::TimeSeries_Impl& first = *timeSeriesVector.front().m_impl;
+    bool sameGrid = std::all_of(timeSeriesVector.begin() + 1, timeSeriesVector.end(), [&first](const TimeSeries& ts) {
+      return (ts.m_impl->units() == first.units()) && first.sameGrid(*ts.m_impl);
+    });
+    if (sameGrid) {
+      return {detail::TimeSeries_Impl::sumSameGrid(timeSeriesVector)};
+    }
+  }
+
   TimeSeries result;
   bool first = true;
   for (const TimeSeries& ts : timeSeriesVector) {
@@ -943,7 +1031,7 @@ TimeSeries sum(const std::vector<TimeSeries>& timeSeriesVector) {
     } else {
       result = result + ts;
     }
-    if (result.values().empty()) {
+    if (result.m_impl->empty()) {
       LOG_FREE(Info, "zero.sum",
                "Could not sum the timeSeriesVector. Either the first series is empty, or the "
                  << "units are incompatible.");
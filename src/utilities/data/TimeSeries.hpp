@@ -16,10 +16,13 @@
 #include <boost/optional.hpp>
 #include <boost/function.hpp>
 
+#include <memory>
 #include <vector>
 
 namespace openstudio {
 
+class TimeSeries;
+
 namespace detail {
 
   class UTILITIES_API TimeSeries_Impl
@@ -40,6 +43,9 @@ namespace detail {
 
     TimeSeries_Impl(const DateTime& firstReportDateTime, const std::vector<long>& timeInSeconds, const Vector& values, const std::string& units);
 
+    // series with the same grid as reportingTimes, values are swapped in and left empty
+    TimeSeries_Impl(const TimeSeries_Impl& reportingTimes, Vector&& values, const std::string& units);
+
     ~TimeSeries_Impl() = default;
 
     openstudio::OptionalTime intervalLength() const;
@@ -88,21 +94,38 @@ namespace detail {
 
     double averageValue() const;
 
+    bool empty() const;
+
+    /// true if other reports at exactly the same times as this series, arithmetic on such series is done element wise
+    bool sameGrid(const TimeSeries_Impl& other) const;
+
+    /// sum of the series, which must all have the same units and the same grid as the first one
+    static std::shared_ptr<TimeSeries_Impl> sumSameGrid(const std::vector<TimeSeries>& timeSeriesVector);
+
    private:
     REGISTER_LOGGER("utilities.TimeSeries_Impl");
+
+    // reporting times of a series, shared by the series that have the same grid, e.g. the results of arithmetic on a series
+    struct TimeAxis
+    {
+      explicit TimeAxis(size_t size = 0) : secondsFromFirstReport(size), secondsFromStart(size) {}
+
+      // integer seconds from first report date time, used for quick interpolation
+      std::vector<long> secondsFromFirstReport;
+      std::vector<long> secondsFromStart;
+    };
+
     // fully qualified first report date
     DateTime m_firstReportDateTime;
 
     // start date and time of time series
     DateTime m_startDateTime;
 
-    // integer seconds from first report date time, used for quick interpolation
-    std::vector<long> m_secondsFromFirstReport;
-    Vector m_secondsFromFirstReportAsVector;  // same as m_secondsFromFirstReport but stored as Vector
-    std::vector<long> m_secondsFromStart;
+    // never null, immutable once constructed
+    std::shared_ptr<const TimeAxis> m_axis;
 
-    // values reported at m_dateTimes
-    Vector m_values;
+    // values reported at m_dateTimes, never null, immutable once constructed like the axis
+    std::shared_ptr<const Vector> m_values;
 
     // units of the values
     std::string m_units;
@@ -191,6 +214,13 @@ class UTILITIES_API TimeSeries
    *   - start date and time of first reporting interval cannot be determined */
   TimeSeries(const DateTime& firstReportDateTime, const std::vector<long>& timeInSeconds, const Vector& values, const std::string& units);
 
+  /** Constructor from the reporting times of another series, values, and units.
+   *  The times are shared with reportingTimes rather than copied, and the values are moved in, leaving values empty.
+   *
+   * An exception is thrown if:
+   *   - values.size != reportingTimes.values().size */
+  TimeSeries(const TimeSeries& reportingTimes, Vector&& values, const std::string& units);
+
   /// Virtual destructor
   ~TimeSeries() = default;
 
@@ -253,6 +283,9 @@ class UTILITIES_API TimeSeries
   /// Set the value used for out of range data, defaults to 0
   void setOutOfRangeValue(double value);
 
+  /// Returns a series with the same data whose setters do not affect this one, the times and values are shared rather than copied
+  TimeSeries clone() const;
+
   //@}
   /** @name Operators */
   //@{
@@ -285,6 +318,9 @@ class UTILITIES_API TimeSeries
   // constructor from impl
   TimeSeries(std::shared_ptr<detail::TimeSeries_Impl> impl);
 
+  friend class detail::TimeSeries_Impl;
+  friend UTILITIES_API TimeSeries sum(const std::vector<TimeSeries>& timeSeriesVector);
+
   // pointer to impl
   std::shared_ptr<detail::TimeSeries_Impl> m_impl;
 };
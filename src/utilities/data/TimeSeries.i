@@ -11,6 +11,9 @@
 
 %ignore openstudio::detail;
 
+// moves values in, for bulk reads in C++ only
+%ignore openstudio::TimeSeries::TimeSeries(const TimeSeries&, Vector&&, const std::string&);
+
 %template(TimeSeriesPtr) std::shared_ptr<openstudio::TimeSeries>;
 
 // create an instantiation of the optional class
@@ -0,0 +1,50 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../TimeSeries.hpp"
+
+#include <vector>
+
+using namespace openstudio;
+
+// n hourly series over a year, like the meters summed by reporting measures
+// when shifted is set every other series reports one hour later, so that the series do not share a grid
+std::vector<TimeSeries> makeHourlySeries(size_t n, bool shifted) {
+  const Date startDate(MonthOfYear(MonthOfYear::Jan), 1);
+  const Time interval(0, 1, 0, 0);
+  std::vector<TimeSeries> result;
+  result.reserve(n);
+  for (size_t i = 0; i < n; ++i) {
+    Vector values = linspace(static_cast<double>(i), static_cast<double>(i + 8760), 8760);
+    DateTime firstReportDateTime(startDate, (shifted && (i % 2 == 1)) ? Time(0, 2, 0, 0) : interval);
+    result.emplace_back(firstReportDateTime, interval, values, "J");
+  }
+  return result;
+}
+
+static void BM_TimeSeriesSum(benchmark::State& state) {
+  const std::vector<TimeSeries> series = makeHourlySeries(state.range(0), state.range(1) != 0);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(sum(series));
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0) * 8760);
+}
+
+static void BM_TimeSeriesArithmetic(benchmark::State& state) {
+  const std::vector<TimeSeries> series = makeHourlySeries(2, state.range(0) != 0);
+
+  for (auto _ : state) {
+    TimeSeries result = (series[0] - series[1]) * 2.0;
+    benchmark::DoNotOptimize(result.integrate());
+    benchmark::DoNotOptimize(result.averageValue());
+  }
+}
+
+BENCHMARK(BM_TimeSeriesSum)->ArgNames({"n", "shifted"})->ArgsProduct({{10, 100}, {0, 1}})->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TimeSeriesArithmetic)->ArgName("shifted")->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
@@ -8,14 +8,175 @@
 #include "../idd/IddEnums.hpp"
 #include <utilities/idd/IddEnums.hxx>
 #include "../core/Checksum.hpp"
+#include "../core/FileCache.hpp"
 #include "../core/StringHelpers.hpp"
 #include "../core/Assert.hpp"
 
 #include <fmt/format.h>
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <charconv>
 #include <cmath>
+#include <limits>
+#include <mutex>
 
 namespace openstudio {
 
+// next line of text, like std::getline but also drops the carriage return of CRLF files
+static bool nextLine(std::string_view& text, std::string_view& line) {
+  if (text.empty()) {
+    return false;
+  }
+  const size_t pos = text.find('\n');
+  if (pos == std::string_view::npos) {
+    line = text;
+    text = std::string_view();
+  } else {
+    line = text.substr(0, pos);
+    text.remove_prefix(pos + 1);
+  }
+  if (!line.empty() && (line.back() == '\r')) {
+    line.remove_suffix(1);
+  }
+  return true;
+}
+
+// same fields as splitString(line, ','), without allocating a string per field
+static void splitFields(std::string_view line, std::vector<std::string_view>& fields) {
+  fields.clear();
+  if (line.empty()) {
+    return;
+  }
+  size_t begin = 0;
+  while (true) {
+    const size_t end = line.find(',', begin);
+    if (end == std::string_view::npos) {
+      fields.push_back(line.substr(begin));
+      break;
+    }
+    fields.push_back(line.substr(begin, end - begin));
+    begin = end + 1;
+  }
+}
+
+// same as std::stoi but returns false instead of throwing
+static bool parseInt(std::string_view field, int& value) {
+  while (!field.empty() && std::isspace(static_cast<unsigned char>(field.front()))) {
+    field.remove_prefix(1);
+  }
+  if (!field.empty() && (field.front() == '+')) {
+    field.remove_prefix(1);
+    if (!field.empty() && (field.front() == '-')) {
+      return false;
+    }
+  }
+  const auto [ptr, ec] = std::from_chars(field.data(), field.data() + field.size(), value);
+  return (ec == std::errc());
+}
+
+// same as std::stod but returns false instead of throwing
+static bool parseDouble(std::string_view field, double& value) {
+  while (!field.empty() && std::isspace(static_cast<unsigned char>(field.front()))) {
+    field.remove_prefix(1);
+  }
+  if (!field.empty() && (field.front() == '+')) {
+    field.remove_prefix(1);
+    if (!field.empty() && (field.front() == '-')) {
+      return false;
+    }
+  }
+  const auto [ptr, ec] = std::from_chars(field.data(), field.data() + field.size(), value);
+  return (ec == std::errc());
+}
+
+// the value EpwDataPoint::getField returns for a field set from text by EpwDataPoint::fromEpwStrings, NaN where it returns none
+static double epwDataValue(int field, std::string_view text) {
+  constexpr double missing = std::numeric_limits<double>::quiet_NaN();
+  double value = 0.0;
+  const bool ok = parseDouble(text, value);
+  // the setters keep the text of valid values, the getters then also treat the missing value code itself as missing
+  auto textValue = [&](std::string_view code, bool invalid) { return (!ok || invalid || (text == code)) ? missing : value; };
+  // some setters keep std::to_string(value) instead, which rounds to six decimals like to_chars does here
+  auto roundedValue = [&](bool invalid) {
+    if (!ok || invalid) {
+      return missing;
+    }
+    char buffer[400];
+    const auto [end, ec] = std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::fixed, 6);
+    double rounded = value;
+    std::from_chars(buffer, end, rounded);
+    return rounded;
+  };
+  auto warnLimits = [&](bool outside) {
+    if (ok && outside) {
+      LOG_FREE(Warn, "openstudio.EpwFile", EpwDataField(field).valueName() << " value '" << value << "' not within the expected limits");
+    }
+  };
+  int ivalue = 0;
+
+  switch (field) {
+    case EpwDataField::DryBulbTemperature:
+    case EpwDataField::DewPointTemperature:
+      warnLimits(-70 >= value || 70 <= value);
+      return textValue("99.9", false);
+    case EpwDataField::RelativeHumidity:
+      warnLimits(110 < value);
+      return textValue("999", 0 > value);
+    case EpwDataField::AtmosphericStationPressure:
+      warnLimits(31000 >= value || 120000 <= value);
+      return textValue("999999", false);
+    case EpwDataField::ExtraterrestrialHorizontalRadiation:
+    case EpwDataField::ExtraterrestrialDirectNormalRadiation:
+    case EpwDataField::HorizontalInfraredRadiationIntensity:
+    case EpwDataField::DirectNormalRadiation:
+    case EpwDataField::DiffuseHorizontalRadiation:
+      return textValue("9999", 0 > value || value == 9999);
+    case EpwDataField::GlobalHorizontalRadiation:
+      return roundedValue(0 > value || value == 9999);
+    case EpwDataField::GlobalHorizontalIlluminance:
+    case EpwDataField::DirectNormalIlluminance:
+    case EpwDataField::DiffuseHorizontalIlluminance:
+      return textValue("999999", 0 > value || 999900 < value);
+    case EpwDataField::ZenithLuminance:
+      return textValue("9999", 0 > value || 9999 <= value);
+    case EpwDataField::WindDirection:
+      return textValue("999", 0 > value || 360 < value);
+    case EpwDataField::WindSpeed:
+      warnLimits(40 < value);
+      return roundedValue(0 > value);
+    case EpwDataField::TotalSkyCover:
+    case EpwDataField::OpaqueSkyCover:
+      // never missing, 99 stands for an unknown cover
+      return (parseInt(text, ivalue) && (0 <= ivalue) && (10 >= ivalue)) ? ivalue : 99;
+    case EpwDataField::Visibility:
+      return textValue("9999", value == 9999);
+    case EpwDataField::CeilingHeight:
+      return textValue("99999", value == 99999);
+    case EpwDataField::PresentWeatherObservation:
+    case EpwDataField::PresentWeatherCodes:
+      // never missing, the default is 0
+      return parseInt(text, ivalue) ? ivalue : 0;
+    case EpwDataField::PrecipitableWater:
+      return textValue("999", value == 999);
+    case EpwDataField::AerosolOpticalDepth:
+      return textValue(".999", value == 0.999);
+    case EpwDataField::SnowDepth:
+      return textValue("999", value == 999);
+    case EpwDataField::DaysSinceLastSnowfall:
+      return textValue("99", value == 99);
+    case EpwDataField::Albedo:
+      return textValue("999", value == 999);
+    case EpwDataField::LiquidPrecipitationDepth:
+      return textValue("999", value == 999);
+    case EpwDataField::LiquidPrecipitationQuantity:
+      return textValue("99", value == 99);
+    default:
+      // date, time and the data source flags
+      return missing;
+  }
+}
+
 static double psat(double T) {
   // Compute water vapor saturation pressure, eqns 5 and 6 from ASHRAE Fundamentals 2009 Ch. 1
   // This version takes T in C rather than Kelvin since most of the other eqns use C
@@ -2526,17 +2687,10 @@ EpwFile::EpwFile(const openstudio::path& p, bool storeData)
     LOG_AND_THROW("Path '" << m_path << "' is not an EPW file");
   }
 
-  // set checksum
-  m_checksum = openstudio::checksum(m_path);
-
-  // open file
-  std::ifstream ifs(openstudio::toSystemFilename(m_path));
-
-  if (!parse(ifs, storeData)) {
-    ifs.close();
+  // parse and set checksum
+  if (!parseFile(storeData)) {
     LOG_AND_THROW("EpwFile '" << toString(p) << "' cannot be processed");
   }
-  ifs.close();
 }
 
 EpwFile::EpwFile() : m_latitude(0), m_longitude(0), m_timeZone(0), m_elevation(0), m_isActual(false), m_minutesMatch(true) {}
@@ -2552,8 +2706,7 @@ boost::optional<EpwFile> EpwFile::load(const openstudio::path& p, bool storeData
 
 boost::optional<EpwFile> EpwFile::loadFromString(const std::string& str, bool storeData) {
   EpwFile result;
-  std::stringstream ss(str);
-  if (result.parse(ss, storeData)) {
+  if (result.parseText(str, storeData)) {
     result.m_checksum = openstudio::checksum(str);
   } else {
     return boost::none;
@@ -2640,17 +2793,9 @@ std::vector<EpwDataPoint> EpwFile::data() {
       LOG_AND_THROW("Path '" << m_path << "' is not an EPW file");
     }
 
-    // set checksum
-    m_checksum = openstudio::checksum(m_path);
-
-    // open file
-    std::ifstream ifs(openstudio::toSystemFilename(m_path));
-
-    if (!parse(ifs, true)) {
-      ifs.close();
+    // parse and set checksum
+    if (!parseFile(true)) {
       LOG(Error, "EpwFile '" << toString(m_path) << "' cannot be processed");
-    } else {
-      ifs.close();
     }
   }
   return m_data;
@@ -3614,40 +3759,116 @@ std::vector<EpwDesignCondition> EpwFile::designConditions() {
       LOG_AND_THROW("Path '" << m_path << "' is not an EPW file");
     }
 
-    // set checksum
-    m_checksum = openstudio::checksum(m_path);
-
-    // open file
-    std::ifstream ifs(openstudio::toSystemFilename(m_path));
-
-    if (!parse(ifs)) {
-      ifs.close();
+    // parse and set checksum
+    if (!parseFile(false)) {
       LOG(Error, "EpwFile '" << toString(m_path) << "' cannot be processed");
-    } else {
-      ifs.close();
     }
   }
   return m_designs;
 }
 
-boost::optional<TimeSeries> EpwFile::getTimeSeries(const std::string& name) {
-  if (m_data.empty()) {
-    if (!openstudio::filesystem::exists(m_path) || !openstudio::filesystem::is_regular_file(m_path)) {
-      LOG_AND_THROW("Path '" << m_path << "' is not an EPW file");
+struct EpwFile::Columns
+{
+  static constexpr size_t numFields = EpwDataField::LiquidPrecipitationQuantity + 1;
+
+  // date and time of each record, without the year unless the file is actual
+  std::vector<DateTime> dateTimes;
+  // value of each EpwDataField for each record, NaN where the value is missing, released once the time series is built
+  std::array<std::vector<double>, numFields> values;
+
+  // time series built from the columns on first use, getTimeSeries returns clones sharing their data
+  std::mutex mutex;
+  std::map<int, boost::optional<TimeSeries>> timeSeries;
+  // first series built from a column without missing values, the other complete columns share its time axis
+  boost::optional<TimeSeries> fullSeries;
+
+  void append(EpwDataPoint& point) {
+    dateTimes.push_back(point.dateTime());
+    for (size_t field = 0; field < numFields; ++field) {
+      boost::optional<double> value = point.getField(EpwDataField(static_cast<int>(field)));
+      values[field].push_back(value ? value.get() : std::numeric_limits<double>::quiet_NaN());
     }
+  }
 
-    // set checksum
-    m_checksum = openstudio::checksum(m_path);
+  // same checks and values as appending the EpwDataPoint::fromEpwStrings of the record, without building the data point
+  bool append(int year, int month, int day, int hour, int minute, const std::vector<std::string_view>& fields) {
+    if (fields.size() < numFields) {
+      LOG_FREE(Error, "openstudio.EpwFile", "Expected 35 fields in EPW data instead of the " << fields.size() << " received");
+      return false;
+    } else if (fields.size() > numFields) {
+      LOG_FREE(Warn, "openstudio.EpwFile",
+               "Expected 35 fields in EPW data instead of the " << fields.size() << " received. The additional data will be ignored");
+    }
+    // the caller already checked the date and the minute
+    if (1 > hour || 24 < hour) {
+      LOG_FREE(Error, "openstudio.EpwFile", "Hour value " << hour << " out of range");
+      return false;
+    }
+    dateTimes.emplace_back(Date(MonthOfYear(month), static_cast<unsigned>(day), year), Time(0, hour, minute));
+    for (size_t field = 0; field < numFields; ++field) {
+      values[field].push_back(epwDataValue(static_cast<int>(field), fields[field]));
+    }
+    return true;
+  }
 
-    // open file
-    std::ifstream ifs(openstudio::toSystemFilename(m_path));
+  void stripYears() {
+    for (DateTime& dateTime : dateTimes) {
+      dateTime = DateTime(Date(dateTime.date().monthOfYear(), dateTime.date().dayOfMonth()), dateTime.time());
+    }
+  }
+};
+
+std::shared_ptr<EpwFile::Columns> EpwFile::columns() {
+  if (m_columns) {
+    return m_columns;
+  }
+
+  // files already read in this process, e.g. by other datapoints using the same weather file
+  // entries are a few MB each, the cache is emptied rather than growing without bound
+  static FileCache<std::shared_ptr<Columns>> cache(32);
+
+  boost::optional<FileCacheKey> key = fileCacheKey(m_path);
+  if (key) {
+    if (auto cached = cache.find(*key)) {
+      m_columns = *cached;
+      return m_columns;
+    }
+  }
+
+  auto result = std::make_shared<Columns>();
+  if (!m_data.empty()) {
+    // loaded from a string with its data, there is no file to read the columns from
+    result->dateTimes.reserve(m_data.size());
+    for (EpwDataPoint& point : m_data) {
+      result->append(point);
+    }
+    if (!isActual()) {
+      result->stripYears();
+    }
+  } else {
+    if (!openstudio::filesystem::exists(m_path) || !openstudio::filesystem::is_regular_file(m_path)) {
+      LOG_AND_THROW("Path '" << m_path << "' is not an EPW file");
+    }
 
-    if (!parse(ifs, true)) {
-      ifs.close();
+    // parse straight into the columns rather than keeping the data points
+    if (!parseFile(false, result.get())) {
       LOG(Error, "EpwFile '" << toString(m_path) << "' cannot be processed");
-      return boost::none;
+      return nullptr;
     }
-    ifs.close();
+  }
+
+  if (key) {
+    // another thread may have read the same file in the meantime, use the same columns
+    result = cache.insert(*key, result);
+  }
+  m_columns = result;
+  return m_columns;
+}
+
+boost::optional<TimeSeries> EpwFile::getTimeSeries(const std::string& name) {
+  std::shared_ptr<Columns> columns = this->columns();
+  if (!columns) {
+    return boost::none;
   }
   EpwDataField id;
   try {
@@ -3656,32 +3877,45 @@ boost::optional<TimeSeries> EpwFile::getTimeSeries(const std::string& name) {
     LOG(Warn, "Unrecognized EPW data field '" << name << "'");
     return boost::none;
   }
-  if (!m_data.empty()) {
-    std::string units = EpwDataPoint::getUnits(id);
+
+  std::lock_guard<std::mutex> lock(columns->mutex);
+  auto it = columns->timeSeries.find(id.value());
+  if (it == columns->timeSeries.end()) {
+    boost::optional<TimeSeries> timeSeries;
+    std::vector<double> column;
+    column.swap(columns->values[id.value()]);
+    bool complete = !column.empty() && std::none_of(column.begin(), column.end(), [](double value) { return std::isnan(value); });
+    if (complete && columns->fullSeries) {
+      timeSeries = TimeSeries(*columns->fullSeries, openstudio::createVector(column), EpwDataPoint::getUnits(id));
+      it = columns->timeSeries.emplace(id.value(), timeSeries).first;
+      return it->second->clone();
+    }
     DateTimeVector dates;
+    dates.reserve(column.size() + 1);
     dates.push_back(DateTime());  // Use a placeholder to avoid an insert
     std::vector<double> values;
-    for (unsigned int i = 0; i < m_data.size(); i++) {
-      DateTime dateTime = m_data[i].dateTime();
-      // Time time=m_data[i].time();
-      boost::optional<double> value = m_data[i].getField(id);
-      if (value) {
-        if (isActual()) {
-          dates.push_back(DateTime(dateTime));
-        } else {
-          // Strip year
-          dates.push_back(DateTime(Date(dateTime.date().monthOfYear(), dateTime.date().dayOfMonth()), dateTime.time()));
-        }
-        values.push_back(value.get());
+    values.reserve(column.size());
+    for (size_t i = 0; i < column.size(); ++i) {
+      if (!std::isnan(column[i])) {
+        dates.push_back(columns->dateTimes[i]);
+        values.push_back(column[i]);
       }
     }
     if (!values.empty()) {
       DateTime start = dates[1] - Time(0, 0, 0, 3600 / m_recordsPerHour);
       dates[0] = start;  // Overwrite the placeholder
-      return boost::optional<TimeSeries>(TimeSeries(dates, openstudio::createVector(values), units));
+      timeSeries = TimeSeries(dates, openstudio::createVector(values), EpwDataPoint::getUnits(id));
+      if (complete) {
+        columns->fullSeries = timeSeries;
+      }
     }
+    it = columns->timeSeries.emplace(id.value(), timeSeries).first;
   }
-  return boost::none;
+  if (!it->second) {
+    return boost::none;
+  }
+  // the clone shares the values but not the settings of the cached series
+  return it->second->clone();
 }
 
 boost::optional<TimeSeries> EpwFile::getComputedTimeSeries(const std::string& name) {
@@ -3690,18 +3924,11 @@ boost::optional<TimeSeries> EpwFile::getComputedTimeSeries(const std::string& na
       LOG_AND_THROW("Path '" << m_path << "' is not an EPW file");
     }
 
-    // set checksum
-    m_checksum = openstudio::checksum(m_path);
-
-    // open file
-    std::ifstream ifs(openstudio::toSystemFilename(m_path));
-
-    if (!parse(ifs, true)) {
-      ifs.close();
+    // parse and set checksum
+    if (!parseFile(true)) {
       LOG(Error, "EpwFile '" << toString(m_path) << "' cannot be processed");
       return boost::none;
     }
-    ifs.close();
   }
   EpwComputedField id;
   try {
@@ -3761,25 +3988,18 @@ bool EpwFile::translateToWth(openstudio::path path, std::string description) {
       LOG_AND_THROW("Path '" << m_path << "' is not an EPW file");
     }
 
-    // set checksum
-    m_checksum = openstudio::checksum(m_path);
-
-    // open file
-    std::ifstream ifs(openstudio::toSystemFilename(m_path));
-
-    if (!parse(ifs, true)) {
-      ifs.close();
+    // parse and set checksum
+    if (!parseFile(true)) {
       LOG(Error, "EpwFile '" << toString(m_path) << "' cannot be processed");
       return false;
     }
-    ifs.close();
   }
 
   if (description.empty()) {
     description = "Translated from " + openstudio::toString(this->path());
   }
 
-  if (data().empty()) {
+  if (m_data.empty()) {
     LOG(Error, "EPW file contains no data to translate");
     return false;
   }
@@ -3806,9 +4026,9 @@ bool EpwFile::translateToWth(openstudio::path path, std::string description) {
   }
 
   // Cheat to get data at the start time - this will need to change
-  openstudio::EpwDataPoint lastPt = data()[data().size() - 1];
+  openstudio::EpwDataPoint lastPt = m_data.back();
   std::vector<std::string> epwstrings = lastPt.toEpwStrings();
-  openstudio::DateTime dateTime = data()[0].dateTime();
+  openstudio::DateTime dateTime = m_data[0].dateTime();
   openstudio::Time dt = timeStep();
   dateTime -= dt;
   epwstrings[0] = std::to_string(dateTime.date().year());
@@ -3830,8 +4050,8 @@ bool EpwFile::translateToWth(openstudio::path path, std::string description) {
     return false;
   }
   fp << output.get() << '\n';
-  for (unsigned int i = 0; i < data().size(); i++) {
-    output = data()[i].toWthString();
+  for (unsigned int i = 0; i < m_data.size(); i++) {
+    output = m_data[i].toWthString();
     if (!output) {
       LOG(Error, "Translation to WTH has failed on data point " << i);
       fp.close();
@@ -3843,40 +4063,61 @@ bool EpwFile::translateToWth(openstudio::path path, std::string description) {
   return true;
 }
 
-bool EpwFile::parse(std::istream& ifs, bool storeData) {
+bool EpwFile::parseFile(bool storeData, Columns* columns) {
+  // read the file once, the same bytes are parsed and checksummed
+  std::string text;
+  openstudio::filesystem::ifstream ifs(m_path, std::ios_base::binary);
+  if (ifs) {
+    ifs.seekg(0, std::ios_base::end);
+    text.resize(static_cast<size_t>(std::max<std::streamoff>(ifs.tellg(), 0)));
+    ifs.seekg(0, std::ios_base::beg);
+    ifs.read(text.data(), static_cast<std::streamsize>(text.size()));
+    text.resize(static_cast<size_t>(ifs.gcount()));
+  }
+  ifs.close();
+
+  const bool result = parseText(text, storeData, columns);
+  // the columns are only read for a file that was already parsed and checksummed when it was opened
+  if (!columns) {
+    m_checksum = openstudio::checksum(std::move(text));
+  }
+  return result;
+}
+
+bool EpwFile::parseText(std::string_view text, bool storeData, Columns* columns) {
   // read line by line
-  std::string line;
+  std::string_view line;
 
   bool result = true;
 
   // read first 8 lines
   for (unsigned i = 0; i < 8; ++i) {
 
-    if (!std::getline(ifs, line)) {
+    if (!nextLine(text, line)) {
       LOG(Error, "Could not read line " << i + 1 << " of EPW file '" << m_path << "'");
       return false;
     }
 
     switch (i) {
       case 0:  // LOCATION,
-        result = result && parseLocation(line);
+        result = result && parseLocation(std::string(line));
         break;
       case 1:  // DESIGN CONDITIONS
-        result = result && parseDesignConditions(line);
+        result = result && parseDesignConditions(std::string(line));
         break;
       case 2:  // TYPICAL/EXTREME PERIODS
         break;
       case 3:  // GROUND TEMPERATURES
         break;
       case 4:  // HOLIDAYS/DAYLIGHT SAVINGS
-        result = result && parseHolidaysDaylightSavings(line);
+        result = result && parseHolidaysDaylightSavings(std::string(line));
         break;
       case 5:  // COMMENTS 1
         break;
       case 6:  // COMMENTS 2
         break;
       case 7:  // DATA PERIODS
-        result = result && parseDataPeriod(line);
+        result = result && parseDataPeriod(std::string(line));
         break;
       default:;
     }
@@ -3897,14 +4138,20 @@ bool EpwFile::parse(std::istream& ifs, bool storeData) {
   OS_ASSERT((60 % m_recordsPerHour) == 0);
   int minutesPerRecord = 60 / m_recordsPerHour;
   int currentMinute = 0;
-  while (std::getline(ifs, line)) {
+  std::vector<std::string_view> fields;
+  std::vector<std::string> strings;
+  while (nextLine(text, line)) {
     lineNumber++;
-    std::vector<std::string> strings = splitString(line, ',');
-    if (strings.size() >= 5) {
+    splitFields(line, fields);
+    if (fields.size() >= 5) {
+      int year = 0;
+      int month = 0;
+      int day = 0;
       try {
-        int year = std::stoi(strings[0]);
-        int month = std::stoi(strings[1]);
-        int day = std::stoi(strings[2]);
+        if (!parseInt(fields[0], year) || !parseInt(fields[1], month) || !parseInt(fields[2], day)) {
+          LOG(Error, "Could not read line " << lineNumber << " of EPW file '" << m_path << "'");
+          return false;
+        }
 
         Date date(month, day, year);
         if (!startDate) {
@@ -3928,27 +4175,43 @@ bool EpwFile::parse(std::istream& ifs, bool storeData) {
           }
         }
         lastDate = date;
+      } catch (...) {
+        LOG(Error, "Could not read line " << lineNumber << " of EPW file '" << m_path << "'");
+        return false;
+      }
 
-        // Store the data if requested
-        if (storeData) {
-          int hour = std::stoi(strings[3]);
-          int minutesInFile = std::stoi(strings[4]);
-          // Due to issues with some EPW files, we need to check stuff here
-          if (m_recordsPerHour != 1) {
-            currentMinute += minutesPerRecord;
-            if (currentMinute >= 60) {  // This could really be ==, but >= is used for safety
-              currentMinute = 0;
-            }
+      // Store the data if requested
+      if (storeData || columns) {
+        int hour = 0;
+        int minutesInFile = 0;
+        if (!parseInt(fields[3], hour) || !parseInt(fields[4], minutesInFile)) {
+          LOG(Error, "Could not read line " << lineNumber << " of EPW file '" << m_path << "'");
+          return false;
+        }
+        // Due to issues with some EPW files, we need to check stuff here
+        if (m_recordsPerHour != 1) {
+          currentMinute += minutesPerRecord;
+          if (currentMinute >= 60) {  // This could really be ==, but >= is used for safety
+            currentMinute = 0;
           }
-          // Check for agreement between the file value and the computed value
-          if (currentMinute != minutesInFile) {
-            if (m_minutesMatch) {  // Warn only once
-              LOG(Error, "Minutes field (" << minutesInFile << ") on line " << lineNumber << " of EPW file '" << m_path
-                                           << "' does not agree with computed value (" << currentMinute << "). Using computed value");
-              m_minutesMatch = false;
-            }
+        }
+        // Check for agreement between the file value and the computed value
+        if (currentMinute != minutesInFile) {
+          if (m_minutesMatch) {  // Warn only once
+            LOG(Error, "Minutes field (" << minutesInFile << ") on line " << lineNumber << " of EPW file '" << m_path
+                                         << "' does not agree with computed value (" << currentMinute << "). Using computed value");
+            m_minutesMatch = false;
+          }
+        }
+        if (storeData) {
+          strings.assign(fields.begin(), fields.end());
+          boost::optional<EpwDataPoint> pt;
+          try {
+            pt = EpwDataPoint::fromEpwStrings(year, month, day, hour, currentMinute, strings);
+          } catch (...) {
+            LOG(Error, "Could not read line " << lineNumber << " of EPW file '" << m_path << "'");
+            return false;
           }
-          boost::optional<EpwDataPoint> pt = EpwDataPoint::fromEpwStrings(year, month, day, hour, currentMinute, strings);
           if (pt) {
             m_data.push_back(pt.get());
           } else {
@@ -3956,10 +4219,11 @@ bool EpwFile::parse(std::istream& ifs, bool storeData) {
             return false;
           }
         }
-
-      } catch (...) {
-        LOG(Error, "Could not read line " << lineNumber << " of EPW file '" << m_path << "'");
-        return false;
+        // the columns are parsed straight from the fields, without a data point per record
+        if (columns && !columns->append(year, month, day, hour, currentMinute, fields)) {
+          LOG(Error, "Failed to parse line " << lineNumber << " of EPW file '" << m_path << "'");
+          return false;
+        }
       }
     } else {
       LOG(Error, "Insufficient weather data on line " << lineNumber << " of EPW file '" << m_path << "'");
@@ -4009,6 +4273,8 @@ bool EpwFile::parse(std::istream& ifs, bool storeData) {
 
   if (realYear) {
     m_isActual = true;
+  } else if (columns) {
+    columns->stripYears();
   }
 
   return result;
@@ -16,6 +16,9 @@
 #include "../time/DateTime.hpp"
 #include "../data/TimeSeries.hpp"
 
+#include <memory>
+#include <string_view>
+
 namespace openstudio {
 
 // forward declaration
@@ -920,6 +923,7 @@ class UTILITIES_API EpwFile
   std::vector<EpwDesignCondition> designConditions();
 
   /// get a time series of a particular weather field
+  /// the weather data is read once per file and process, the returned series share their data with other calls for the same field
   // This will probably need to include the period at some point, but for now just dump everything into a time series
   boost::optional<TimeSeries> getTimeSeries(const std::string& field);
   /// get a time series of a computed quantity
@@ -940,7 +944,14 @@ class UTILITIES_API EpwFile
 
  private:
   EpwFile();
-  bool parse(std::istream& is, bool storeData = false);
+
+  // weather data by field, shared with copies of this EpwFile and with other EpwFiles reading the same unchanged file
+  struct Columns;
+  std::shared_ptr<Columns> columns();
+
+  // columns, if not null, is filled with the weather data by field
+  bool parseText(std::string_view text, bool storeData = false, Columns* columns = nullptr);
+  bool parseFile(bool storeData = false, Columns* columns = nullptr);
   bool parseLocation(const std::string& line);
   bool parseDesignConditions(const std::string& line);
   bool parseDataPeriod(const std::string& line);
@@ -968,6 +979,7 @@ class UTILITIES_API EpwFile
   boost::optional<int> m_endDateActualYear;
   std::vector<EpwDataPoint> m_data;
   std::vector<EpwDesignCondition> m_designs;
+  std::shared_ptr<Columns> m_columns;
 
   bool m_leapYearObserved;
   boost::optional<Date> m_daylightSavingStartDate;
@@ -0,0 +1,81 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../EpwFile.hpp"
+#include "../../core/Filesystem.hpp"
+
+#include <resources.hxx>
+
+#include <ctime>
+#include <vector>
+
+using namespace openstudio;
+
+static void BM_EpwFileOpen(benchmark::State& state) {
+  openstudio::path p = resourcesPath() / toPath("utilities/Filetypes/USA_CO_Golden-NREL.724666_TMY3.epw");
+
+  for (auto _ : state) {
+    EpwFile epwFile(p);
+    benchmark::DoNotOptimize(epwFile);
+  }
+}
+
+static void BM_EpwFileGetTimeSeries(benchmark::State& state) {
+  openstudio::path p = resourcesPath() / toPath("utilities/Filetypes/USA_CO_Golden-NREL.724666_TMY3.epw");
+
+  // same pattern as many datapoints loading the same weather file
+  for (auto _ : state) {
+    EpwFile epwFile(p);
+    boost::optional<TimeSeries> dryBulb = epwFile.getTimeSeries("Dry Bulb Temperature");
+    boost::optional<TimeSeries> windSpeed = epwFile.getTimeSeries("Wind Speed");
+    benchmark::DoNotOptimize(dryBulb);
+    benchmark::DoNotOptimize(windSpeed);
+  }
+}
+
+static void BM_EpwFileGetTimeSeriesUncached(benchmark::State& state) {
+  openstudio::path p = resourcesPath() / toPath("utilities/Filetypes/USA_CO_Golden-NREL.724666_TMY3.epw");
+
+  // a copy dated in the future is never held by the file cache, so every iteration parses the columns
+  openstudio::path copy = openstudio::filesystem::temp_directory_path() / toPath("EpwFile_Benchmark.epw");
+  openstudio::filesystem::copy_file(p, copy, openstudio::filesystem::copy_options::overwrite_existing);
+  openstudio::filesystem::last_write_time(copy, std::time(nullptr) + 24 * 3600);
+
+  for (auto _ : state) {
+    EpwFile epwFile(copy);
+    boost::optional<TimeSeries> dryBulb = epwFile.getTimeSeries("Dry Bulb Temperature");
+    boost::optional<TimeSeries> windSpeed = epwFile.getTimeSeries("Wind Speed");
+    benchmark::DoNotOptimize(dryBulb);
+    benchmark::DoNotOptimize(windSpeed);
+  }
+  openstudio::filesystem::remove(copy);
+}
+
+static void BM_EpwFileGetTimeSeriesDataPoints(benchmark::State& state) {
+  openstudio::path p = resourcesPath() / toPath("utilities/Filetypes/USA_CO_Golden-NREL.724666_TMY3.epw");
+
+  // what getTimeSeries did before the columns, an EpwDataPoint per record and a getField per value
+  for (auto _ : state) {
+    EpwFile epwFile(p, true);
+    std::vector<double> dryBulb;
+    std::vector<double> windSpeed;
+    std::vector<EpwDataPoint> data = epwFile.data();
+    for (EpwDataPoint& point : data) {
+      boost::optional<double> value = point.getField(EpwDataField::DryBulbTemperature);
+      dryBulb.push_back(value ? value.get() : 0.0);
+      value = point.getField(EpwDataField::WindSpeed);
+      windSpeed.push_back(value ? value.get() : 0.0);
+    }
+    benchmark::DoNotOptimize(dryBulb);
+    benchmark::DoNotOptimize(windSpeed);
+  }
+}
+
+BENCHMARK(BM_EpwFileOpen)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_EpwFileGetTimeSeries)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_EpwFileGetTimeSeriesUncached)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_EpwFileGetTimeSeriesDataPoints)->Unit(benchmark::kMillisecond);
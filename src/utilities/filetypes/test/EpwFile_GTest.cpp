@@ -976,3 +976,91 @@ DATA PERIODS,1,1,Data,Sunday, 1/ 1,1/1
     ++i;
   }
 }
+
+TEST(Filetypes, EpwFile_SharedTimeSeries) {
+  path p = resourcesPath() / toPath("utilities/Filetypes/USA_CO_Golden-NREL.724666_TMY3.epw");
+  EpwFile epwFile(p);
+  EXPECT_EQ(openstudio::checksum(epwFile.path()), epwFile.checksum());
+
+  boost::optional<TimeSeries> series1 = epwFile.getTimeSeries("Dry Bulb Temperature");
+  boost::optional<TimeSeries> series2 = epwFile.getTimeSeries("Dry Bulb Temperature");
+  ASSERT_TRUE(series1);
+  ASSERT_TRUE(series2);
+  ASSERT_EQ(8760u, series1->values().size());
+  EXPECT_EQ(series1->firstReportDateTime(), series2->firstReportDateTime());
+
+  // a second EpwFile on the same file gets the same values
+  EpwFile epwFile2(p);
+  boost::optional<TimeSeries> series3 = epwFile2.getTimeSeries("Dry Bulb Temperature");
+  ASSERT_TRUE(series3);
+  ASSERT_EQ(series1->values().size(), series3->values().size());
+  std::vector<EpwDataPoint> data = epwFile2.data();
+  ASSERT_EQ(8760u, data.size());
+  for (unsigned i = 0; i < 8760; ++i) {
+    EXPECT_EQ(series1->values()[i], series3->values()[i]);
+    ASSERT_TRUE(data[i].dryBulbTemperature());
+    EXPECT_DOUBLE_EQ(data[i].dryBulbTemperature().get(), series3->values()[i]);
+  }
+
+  // other fields are independent
+  boost::optional<TimeSeries> windSpeed = epwFile2.getTimeSeries("Wind Speed");
+  ASSERT_TRUE(windSpeed);
+  EXPECT_EQ(8760u, windSpeed->values().size());
+  EXPECT_FALSE(epwFile2.getTimeSeries("Not A Field"));
+
+  // settings changed on a returned series do not leak to other callers
+  series1->setOutOfRangeValue(-999.0);
+  EXPECT_EQ(-999.0, series1->outOfRangeValue());
+  boost::optional<TimeSeries> series4 = epwFile.getTimeSeries("Dry Bulb Temperature");
+  ASSERT_TRUE(series4);
+  EXPECT_EQ(series2->outOfRangeValue(), series4->outOfRangeValue());
+  EXPECT_NE(-999.0, series4->outOfRangeValue());
+  EXPECT_NE(-999.0, series3->outOfRangeValue());
+
+  // a series requested again after its column was released still has all its values
+  EXPECT_EQ(8760u, epwFile2.getTimeSeries("Wind Speed")->values().size());
+}
+
+TEST(Filetypes, EpwFile_TimeSeriesMatchDataPoints) {
+  // the time series are parsed without data points, they must hold the values the data points return
+  for (const std::string& fileName : {"USA_CO_Golden-NREL.724666_TMY3.epw", "CHN_Guangdong.Shaoguan.590820_CSWD.epw", "TUN_Tunis.607150_IWEC.epw"}) {
+    path p = resourcesPath() / toPath("utilities/Filetypes") / toPath(fileName);
+    EpwFile epwFile(p);
+    std::vector<EpwDataPoint> data = EpwFile(p, true).data();
+    ASSERT_FALSE(data.empty()) << fileName;
+
+    for (int value : EpwDataField::getValues()) {
+      EpwDataField field(value);
+      const std::string fieldName = field.valueName();
+      std::vector<double> expected;
+      for (EpwDataPoint& point : data) {
+        if (boost::optional<double> value = point.getField(field)) {
+          expected.push_back(value.get());
+        }
+      }
+      boost::optional<TimeSeries> series = epwFile.getTimeSeries(fieldName);
+      if (expected.empty()) {
+        EXPECT_FALSE(series) << fileName << " " << fieldName;
+        continue;
+      }
+      ASSERT_TRUE(series) << fileName << " " << fieldName;
+      openstudio::Vector values = series->values();
+      ASSERT_EQ(expected.size(), values.size()) << fileName << " " << fieldName;
+      for (unsigned i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(expected[i], values[i]) << fileName << " " << fieldName << " " << i;
+      }
+      if (expected.size() == data.size()) {
+        // the complete columns share one time axis
+        std::vector<DateTime> dateTimes = series->dateTimes();
+        ASSERT_EQ(data.size(), dateTimes.size()) << fileName << " " << fieldName;
+        for (size_t i : {size_t(0), data.size() / 2, data.size() - 1}) {
+          // the year is stripped unless the file is actual
+          DateTime expectedDateTime = data[i].dateTime();
+          EXPECT_EQ(expectedDateTime.date().monthOfYear(), dateTimes[i].date().monthOfYear()) << fileName << " " << fieldName << " " << i;
+          EXPECT_EQ(expectedDateTime.date().dayOfMonth(), dateTimes[i].date().dayOfMonth()) << fileName << " " << fieldName << " " << i;
+          EXPECT_EQ(expectedDateTime.time(), dateTimes[i].time()) << fileName << " " << fieldName << " " << i;
+        }
+      }
+    }
+  }
+}
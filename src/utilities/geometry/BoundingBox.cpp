@@ -7,8 +7,88 @@
 
 #include "Point3d.hpp"
 
+#include <algorithm>
+#include <array>
+
 namespace openstudio {
 
+namespace {
+
+  // BoundingBox without the optionals, so that the tree can be built and walked quickly
+  struct Box
+  {
+    std::array<double, 3> min;
+    std::array<double, 3> max;
+
+    void add(const Box& other) {
+      for (unsigned k = 0; k < 3; ++k) {
+        min[k] = std::min(min[k], other.min[k]);
+        max[k] = std::max(max[k], other.max[k]);
+      }
+    }
+
+    // same test as BoundingBox::intersects
+    bool intersects(const Box& other, double tol) const {
+      for (unsigned k = 0; k < 3; ++k) {
+        if ((min[k] > other.max[k] + tol) || (other.min[k] > max[k] + tol)) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    double center(unsigned k) const {
+      return 0.5 * (min[k] + max[k]);
+    }
+  };
+
+  // Node of the bounding volume hierarchy. Leaves refer to the range [begin, end) of the sorted
+  // box indices, interior nodes have their children at index + 1 and at secondChild.
+  struct BvhNode
+  {
+    Box box;
+    unsigned begin = 0;
+    unsigned end = 0;
+    unsigned secondChild = 0;
+  };
+
+  constexpr unsigned bvhLeafSize = 4;
+
+  unsigned buildBvh(std::vector<BvhNode>& nodes, std::vector<unsigned>& indices, const std::vector<Box>& boxes, unsigned begin, unsigned end) {
+    unsigned nodeIndex = nodes.size();
+    nodes.emplace_back();
+
+    Box box = boxes[indices[begin]];
+    for (unsigned i = begin + 1; i < end; ++i) {
+      box.add(boxes[indices[i]]);
+    }
+    nodes[nodeIndex].box = box;
+    nodes[nodeIndex].begin = begin;
+    nodes[nodeIndex].end = end;
+
+    if (end - begin <= bvhLeafSize) {
+      return nodeIndex;
+    }
+
+    // split at the median center along the longest axis
+    unsigned axis = 0;
+    for (unsigned k = 1; k < 3; ++k) {
+      if (box.max[k] - box.min[k] > box.max[axis] - box.min[axis]) {
+        axis = k;
+      }
+    }
+    unsigned middle = begin + (end - begin) / 2;
+    std::nth_element(indices.begin() + begin, indices.begin() + middle, indices.begin() + end,
+                     [&boxes, axis](unsigned a, unsigned b) { return boxes[a].center(axis) < boxes[b].center(axis); });
+
+    buildBvh(nodes, indices, boxes, begin, middle);
+    unsigned secondChild = buildBvh(nodes, indices, boxes, middle, end);
+    nodes[nodeIndex].secondChild = secondChild;
+    return nodeIndex;
+  }
+
+}  // namespace
+
 void BoundingBox::add(const BoundingBox& other) {
   this->addPoints(other.corners());
 }
@@ -97,4 +177,69 @@ std::vector<Point3d> BoundingBox::corners() const {
   return result;
 }
 
+std::vector<std::pair<unsigned, unsigned>> intersectingBoundingBoxPairs(const std::vector<BoundingBox>& boxes, double tol) {
+  std::vector<std::pair<unsigned, unsigned>> result;
+
+  // empty boxes do not intersect anything
+  std::vector<Box> nonEmptyBoxes;
+  std::vector<unsigned> boxIndices;
+  for (unsigned i = 0; i < boxes.size(); ++i) {
+    const BoundingBox& boundingBox = boxes[i];
+    if (boundingBox.isEmpty()) {
+      continue;
+    }
+    nonEmptyBoxes.push_back(Box{{*boundingBox.minX(), *boundingBox.minY(), *boundingBox.minZ()},
+                                {*boundingBox.maxX(), *boundingBox.maxY(), *boundingBox.maxZ()}});
+    boxIndices.push_back(i);
+  }
+  unsigned n = nonEmptyBoxes.size();
+  if (n < 2) {
+    return result;
+  }
+
+  std::vector<unsigned> indices(n);
+  for (unsigned i = 0; i < n; ++i) {
+    indices[i] = i;
+  }
+  std::vector<BvhNode> nodes;
+  nodes.reserve(2 * (n / bvhLeafSize + 1));
+  buildBvh(nodes, indices, nonEmptyBoxes, 0, n);
+
+  // a node's box contains its children's boxes, so if a box does not intersect it (with tol) it
+  // cannot intersect anything below it
+  std::vector<unsigned> stack;
+  std::vector<unsigned> candidates;
+  for (unsigned i = 0; i < n; ++i) {
+    const Box& box = nonEmptyBoxes[i];
+    candidates.clear();
+    stack.assign(1, 0u);
+    while (!stack.empty()) {
+      unsigned nodeIndex = stack.back();
+      stack.pop_back();
+      const BvhNode& node = nodes[nodeIndex];
+      if (!box.intersects(node.box, tol)) {
+        continue;
+      }
+      if (node.secondChild == 0) {
+        for (unsigned k = node.begin; k < node.end; ++k) {
+          unsigned j = indices[k];
+          if ((j > i) && box.intersects(nonEmptyBoxes[j], tol)) {
+            candidates.push_back(j);
+          }
+        }
+      } else {
+        stack.push_back(node.secondChild);
+        stack.push_back(nodeIndex + 1);
+      }
+    }
+
+    std::sort(candidates.begin(), candidates.end());
+    for (unsigned j : candidates) {
+      result.emplace_back(boxIndices[i], boxIndices[j]);
+    }
+  }
+
+  return result;
+}
+
 }  // namespace openstudio
@@ -11,6 +11,7 @@
 
 #include <boost/optional.hpp>
 
+#include <utility>
 #include <vector>
 
 namespace openstudio {
@@ -69,6 +70,12 @@ using OptionalBoundingBox = boost::optional<BoundingBox>;
 // vector of BoundingBox
 using BoundingBoxVector = std::vector<BoundingBox>;
 
+/** Returns the indices (i, j), i < j, of every pair of boxes for which boxes[i].intersects(boxes[j], tol),
+ *  sorted by i and then by j, i.e. in the order a double loop over all pairs would find them. Candidate
+ *  pairs come from a bounding volume hierarchy over the boxes, so the cost grows with the number of
+ *  intersecting pairs rather than with the square of the number of boxes. */
+UTILITIES_API std::vector<std::pair<unsigned, unsigned>> intersectingBoundingBoxPairs(const std::vector<BoundingBox>& boxes, double tol = 0.01);
+
 }  // namespace openstudio
 
 #endif  //UTILITIES_GEOMETRY_BOUNDINGBOX_HPP
@@ -5,6 +5,7 @@
 
 #include "Geometry.hpp"
 #include "Intersection.hpp"
+#include "PointSet.hpp"
 #include "Transformation.hpp"
 #include "Vector3d.hpp"
 
@@ -454,7 +455,7 @@ std::vector<std::vector<Point3d>> computeTriangulation(const Point3dVector& vert
   // if holes have been triangulated, rejoin them here before subtraction
   const std::vector<std::vector<Point3d>> newHoles = joinAll(holes, tol);
 
-  std::vector<Point3d> allPoints;
+  PointSet allPoints(tol);
 
   // PolyPartition does not support holes which intersect the polygon or share an edge
   // if any hole is not fully contained we will use boost to remove all the holes
@@ -494,7 +495,7 @@ std::vector<std::vector<Point3d>> computeTriangulation(const Point3dVector& vert
       return result;
     }
 
-    const Point3d point = getCombinedPoint(vertices[n - i - 1], allPoints, tol);
+    const Point3d point = allPoints.getCombinedPoint(vertices[n - i - 1]);
     outerPoly[i].x = point.x();
     outerPoly[i].y = point.y();
   }
@@ -521,7 +522,7 @@ std::vector<std::vector<Point3d>> computeTriangulation(const Point3dVector& vert
         return result;
       }
 
-      const Point3d point = getCombinedPoint(holeVertices[i], allPoints, tol);
+      const Point3d point = allPoints.getCombinedPoint(holeVertices[i]);
       innerPoly[i].x = point.x();
       innerPoly[i].y = point.y();
     }
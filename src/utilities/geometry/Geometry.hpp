@@ -80,7 +80,7 @@ UTILITIES_API double getAngle(const Vector3d& vector1, const Vector3d& vector2);
 UTILITIES_API bool circularEqual(const std::vector<Point3d>& points1, const std::vector<Point3d>& points2, double tol = 0.001);
 
 /// if point3d is within tol of any existing points then returns existing point
-/// otherwise adds point3d to allPoints and returns point3d
+/// otherwise adds point3d to allPoints and returns point3d, use a PointSet when combining many points
 UTILITIES_API Point3d getCombinedPoint(const Point3d& point3d, std::vector<Point3d>& allPoints, double tol = 0.001);
 
 /// compute triangulation of vertices, holes are removed in the triangulation
@@ -103,10 +103,13 @@ UTILITIES_API bool applyViewAndDaylightingGlassRatios(double viewGlassToWallRati
                                                       std::vector<Point3d>& daylightingVertices, std::vector<Point3d>& exteriorShadingVertices,
                                                       std::vector<Point3d>& interiorShelfVertices);
 
+// Default tolerance of isAlmostEqual3dPt and isPointOnLineBetweenPoints, in meters (half an inch)
+constexpr double defaultPointTolerance = 0.0127;
+
 // Checks that a point is **almost** equal to another (with some tolerance)
-UTILITIES_API bool isAlmostEqual3dPt(const Point3d& lhs, const Point3d& rhs, double tol = 0.0127);
+UTILITIES_API bool isAlmostEqual3dPt(const Point3d& lhs, const Point3d& rhs, double tol = defaultPointTolerance);
 
-UTILITIES_API bool isPointOnLineBetweenPoints(const Point3d& start, const Point3d& end, const Point3d& test, double tol = 0.0127);
+UTILITIES_API bool isPointOnLineBetweenPoints(const Point3d& start, const Point3d& end, const Point3d& test, double tol = defaultPointTolerance);
 
 }  // namespace openstudio
 
@@ -6,6 +6,7 @@
 #include "Geometry.hpp"
 #include "Vector3d.hpp"
 #include "Intersection.hpp"
+#include "PointSet.hpp"
 #include "../data/Matrix.hpp"
 #include "../core/Assert.hpp"
 #include "../core/ContainersMove.hpp"
@@ -321,20 +322,20 @@ std::vector<BoostPolygon> removeHoles(const std::vector<BoostPolygon>& polygons)
 }
 
 // convert a Point3d to a BoostPoint
-boost::tuple<double, double> boostPointFromPoint3d(const Point3d& point3d, std::vector<Point3d>& allPoints, double tol) {
-  OS_ASSERT(std::abs(point3d.z()) <= tol);
+boost::tuple<double, double> boostPointFromPoint3d(const Point3d& point3d, PointSet& allPoints) {
+  OS_ASSERT(std::abs(point3d.z()) <= allPoints.tolerance());
 
   // simple method
   //return boost::make_tuple(point3d.x(), point3d.y());
 
   // detailed method, try to combine points within tolerance
-  const Point3d resultPoint = getCombinedPoint(point3d, allPoints, tol);
+  const Point3d resultPoint = allPoints.getCombinedPoint(point3d);
 
   return boost::make_tuple(resultPoint.x() * scaleBy, resultPoint.y() * scaleBy);
 }
 
 // convert vertices to a boost polygon, all vertices must lie on z = 0 plane
-boost::optional<BoostPolygon> boostPolygonFromVertices(const std::vector<Point3d>& vertices, std::vector<Point3d>& allPoints, double tol) {
+boost::optional<BoostPolygon> boostPolygonFromVertices(const std::vector<Point3d>& vertices, PointSet& allPoints, double tol) {
   if (vertices.size() < 3) {
     return boost::none;
   }
@@ -350,11 +351,11 @@ boost::optional<BoostPolygon> boostPolygonFromVertices(const std::vector<Point3d
     }
 
     // use helper method which combines close points
-    boost::geometry::append(polygon, boostPointFromPoint3d(vertex, allPoints, tol));
+    boost::geometry::append(polygon, boostPointFromPoint3d(vertex, allPoints));
   }
 
   // close polygon, use helper method which combines close points
-  boost::geometry::append(polygon, boostPointFromPoint3d(vertices[0], allPoints, tol));
+  boost::geometry::append(polygon, boostPointFromPoint3d(vertices[0], allPoints));
 
   //boost::geometry::correct(polygon);
 
@@ -367,8 +368,7 @@ boost::optional<BoostPolygon> boostPolygonFromVertices(const std::vector<Point3d
   return polygon;
 }
 
-boost::optional<BoostPolygon> nonIntersectingBoostPolygonFromVertices(const std::vector<Point3d>& polygon, std::vector<Point3d>& allPoints,
-                                                                      double tol) {
+boost::optional<BoostPolygon> nonIntersectingBoostPolygonFromVertices(const std::vector<Point3d>& polygon, PointSet& allPoints, double tol) {
   boost::optional<BoostPolygon> result = boostPolygonFromVertices(polygon, allPoints, tol);
   if (!result) {
     return boost::none;
@@ -384,7 +384,7 @@ boost::optional<BoostPolygon> nonIntersectingBoostPolygonFromVertices(const std:
 }
 
 // convert vertices to a boost ring, all vertices must lie on z = 0 plane
-boost::optional<BoostRing> boostRingFromVertices(const std::vector<Point3d>& vertices, std::vector<Point3d>& allPoints, double tol) {
+boost::optional<BoostRing> boostRingFromVertices(const std::vector<Point3d>& vertices, PointSet& allPoints, double tol) {
   if (vertices.size() < 3) {
     return boost::none;
   }
@@ -400,11 +400,11 @@ boost::optional<BoostRing> boostRingFromVertices(const std::vector<Point3d>& ver
     }
 
     // use helper method which combines close points
-    boost::geometry::append(ring, boostPointFromPoint3d(vertex, allPoints, tol));
+    boost::geometry::append(ring, boostPointFromPoint3d(vertex, allPoints));
   }
 
   // close polygon, use helper method which combines close points
-  boost::geometry::append(ring, boostPointFromPoint3d(vertices[0], allPoints, tol));
+  boost::geometry::append(ring, boostPointFromPoint3d(vertices[0], allPoints));
 
   //boost::geometry::correct(ring);
 
@@ -417,7 +417,7 @@ boost::optional<BoostRing> boostRingFromVertices(const std::vector<Point3d>& ver
   return ring;
 }
 
-boost::optional<BoostRing> nonIntersectingBoostRingFromVertices(const std::vector<Point3d>& polygon, std::vector<Point3d>& allPoints, double tol) {
+boost::optional<BoostRing> nonIntersectingBoostRingFromVertices(const std::vector<Point3d>& polygon, PointSet& allPoints, double tol) {
   boost::optional<BoostRing> result = boostRingFromVertices(polygon, allPoints, tol);
   if (!result) {
     return boost::none;
@@ -433,8 +433,7 @@ boost::optional<BoostRing> nonIntersectingBoostRingFromVertices(const std::vecto
 }
 
 // convert a boost polygon to vertices
-std::vector<Point3d> verticesFromBoostPolygon(const BoostPolygon& polygon, std::vector<Point3d>& allPoints, double tol,
-                                              bool removeCollinear = false) {
+std::vector<Point3d> verticesFromBoostPolygon(const BoostPolygon& polygon, PointSet& allPoints, bool removeCollinear = false) {
   std::vector<Point3d> result;
   BoostRing outer = polygon.outer();
   if (outer.empty()) {
@@ -446,7 +445,7 @@ std::vector<Point3d> verticesFromBoostPolygon(const BoostPolygon& polygon, std::
     const Point3d point3d(outer[i].x() / scaleBy, outer[i].y() / scaleBy, 0.0);
 
     // try to combine points within tolerance
-    Point3d resultPoint = getCombinedPoint(point3d, allPoints, tol);
+    Point3d resultPoint = allPoints.getCombinedPoint(point3d);
 
     // don't keep repeated vertices
     if ((i > 0) && (result.back() == resultPoint)) {
@@ -477,7 +476,7 @@ std::vector<Point3d> verticesFromBoostPolygon(const BoostPolygon& polygon, std::
 }
 
 // convert a boost ring to vertices
-std::vector<Point3d> verticesFromBoostRing(const BoostRing& ring, std::vector<Point3d>& allPoints, double tol) {
+std::vector<Point3d> verticesFromBoostRing(const BoostRing& ring, PointSet& allPoints) {
   std::vector<Point3d> result;
 
   // add point for each vertex except final vertex
@@ -485,7 +484,7 @@ std::vector<Point3d> verticesFromBoostRing(const BoostRing& ring, std::vector<Po
     const Point3d point3d(ring[i].x(), ring[i].y(), 0.0);
 
     // try to combine points within tolerance
-    Point3d resultPoint = getCombinedPoint(point3d, allPoints, tol);
+    Point3d resultPoint = allPoints.getCombinedPoint(point3d);
 
     // don't keep repeated vertices
     if ((i > 0) && (result.back() == resultPoint)) {
@@ -595,7 +594,7 @@ double IntersectionResult::area2() const {
 
 std::vector<Point3d> removeSpikes(const std::vector<Point3d>& polygon, double tol) {
   // convert vertices to boost rings
-  std::vector<Point3d> allPoints;
+  PointSet allPoints(tol);
 
   boost::optional<BoostPolygon> boostPolygon = boostPolygonFromVertices(polygon, allPoints, tol);
   if (!boostPolygon) {
@@ -604,7 +603,7 @@ std::vector<Point3d> removeSpikes(const std::vector<Point3d>& polygon, double to
 
   const BoostPolygon boostResult = removeSpikes(*boostPolygon);
 
-  std::vector<Point3d> result = verticesFromBoostPolygon(boostResult, allPoints, tol);
+  std::vector<Point3d> result = verticesFromBoostPolygon(boostResult, allPoints);
 
   return result;
 }
@@ -612,7 +611,7 @@ std::vector<Point3d> removeSpikes(const std::vector<Point3d>& polygon, double to
 bool polygonInPolygon(std::vector<Point3d>& points, const std::vector<Point3d>& polygon, double tol) {
 
   // convert vertices to boost rings
-  std::vector<Point3d> allPoints;
+  PointSet allPoints(tol);
 
   boost::optional<BoostRing> boostPolygon = nonIntersectingBoostRingFromVertices(polygon, allPoints, tol);
   if (!boostPolygon) {
@@ -630,7 +629,7 @@ bool polygonInPolygon(std::vector<Point3d>& points, const std::vector<Point3d>&
   }
 
   for (const Point3d& point : points) {
-    boost::tuple<double, double> p = boostPointFromPoint3d(point, allPoints, tol);
+    boost::tuple<double, double> p = boostPointFromPoint3d(point, allPoints);
     const BoostPoint boostPoint(p.get<0>(), p.get<1>());
     const double distance = boost::geometry::distance(boostPoint, *boostPolygon);
     if (distance >= 0.0001) {
@@ -642,7 +641,7 @@ bool polygonInPolygon(std::vector<Point3d>& points, const std::vector<Point3d>&
 
 bool pointInPolygon(const Point3d& point, const std::vector<Point3d>& polygon, double tol) {
   // convert vertices to boost rings
-  std::vector<Point3d> allPoints;
+  PointSet allPoints(tol);
 
   boost::optional<BoostRing> boostPolygon = nonIntersectingBoostRingFromVertices(polygon, allPoints, tol);
   if (!boostPolygon) {
@@ -653,7 +652,7 @@ bool pointInPolygon(const Point3d& point, const std::vector<Point3d>& polygon, d
     return false;
   }
 
-  boost::tuple<double, double> p = boostPointFromPoint3d(point, allPoints, tol);
+  boost::tuple<double, double> p = boostPointFromPoint3d(point, allPoints);
   const BoostPoint boostPoint(p.get<0>(), p.get<1>());
 
   //boost::geometry::strategy::within::winding<BoostPoint> strategy;
@@ -673,7 +672,7 @@ bool pointInPolygon(const Point3d& point, const std::vector<Point3d>& polygon, d
 
 boost::optional<std::vector<Point3d>> join(const std::vector<Point3d>& polygon1, const std::vector<Point3d>& polygon2, double tol) {
   // convert vertices to boost rings
-  std::vector<Point3d> allPoints;
+  PointSet allPoints(tol);
 
   boost::optional<BoostRing> boostPolygon1 = nonIntersectingBoostRingFromVertices(polygon1, allPoints, tol);
   if (!boostPolygon1) {
@@ -707,7 +706,7 @@ boost::optional<std::vector<Point3d>> join(const std::vector<Point3d>& polygon1,
     return boost::none;
   };
 
-  std::vector<Point3d> unionVertices = verticesFromBoostPolygon(unionResult[0], allPoints, tol);
+  std::vector<Point3d> unionVertices = verticesFromBoostPolygon(unionResult[0], allPoints);
   boost::optional<double> testArea = boost::geometry::area(unionResult[0]);
   if (!testArea || unionVertices.empty()) {
     LOG_FREE(Info, "utilities.geometry.join", "Cannot compute area of union");
@@ -810,7 +809,7 @@ boost::optional<IntersectionResult> intersect(const std::vector<Point3d>& polygo
   //std::cout << "Initial polygon2 area " << getArea(polygon2).get() << '\n';
 
   // convert vertices to boost rings
-  std::vector<Point3d> allPoints;
+  PointSet allPoints(tol);
 
   boost::optional<BoostRing> boostPolygon1 = nonIntersectingBoostRingFromVertices(polygon1, allPoints, tol);
   if (!boostPolygon1) {
@@ -870,7 +869,7 @@ boost::optional<IntersectionResult> intersect(const std::vector<Point3d>& polygo
   }
 
   // check that largest intersection is ok
-  std::vector<Point3d> intersectionVertices = verticesFromBoostPolygon(intersectionResult[0], allPoints, tol, false);
+  std::vector<Point3d> intersectionVertices = verticesFromBoostPolygon(intersectionResult[0], allPoints, false);
   boost::optional<double> testArea = boost::geometry::area(intersectionResult[0]);
   if (!testArea || intersectionVertices.empty()) {
     LOG_FREE(Info, "utilities.geometry.intersect", "Cannot compute area of largest intersection");
@@ -896,7 +895,7 @@ boost::optional<IntersectionResult> intersect(const std::vector<Point3d>& polygo
   // create new polygon for each **remaining** intersection (all but the largest one)
   for (unsigned i = 1; i < intersectionResult.size(); ++i) {
 
-    std::vector<Point3d> newPolygon = verticesFromBoostPolygon(intersectionResult[i], allPoints, tol, false);
+    std::vector<Point3d> newPolygon = verticesFromBoostPolygon(intersectionResult[i], allPoints, false);
 
     testArea = boost::geometry::area(intersectionResult[i]);
     if (!testArea || newPolygon.empty()) {
@@ -933,7 +932,7 @@ boost::optional<IntersectionResult> intersect(const std::vector<Point3d>& polygo
 
   // create new polygon for each difference
   for (auto& pp : differenceResult1) {
-    std::vector<Point3d> newPolygon1 = verticesFromBoostPolygon(pp, allPoints, tol, false);
+    std::vector<Point3d> newPolygon1 = verticesFromBoostPolygon(pp, allPoints, false);
 
     testArea = boost::geometry::area(pp);
     if (!testArea || newPolygon1.empty()) {
@@ -964,7 +963,7 @@ boost::optional<IntersectionResult> intersect(const std::vector<Point3d>& polygo
 
   // create new polygon for each difference
   for (auto& pp : differenceResult2) {
-    std::vector<Point3d> newPolygon2 = verticesFromBoostPolygon(pp, allPoints, tol, false);
+    std::vector<Point3d> newPolygon2 = verticesFromBoostPolygon(pp, allPoints, false);
 
     testArea = boost::geometry::area(pp);
     if (!testArea || newPolygon2.empty()) {
@@ -999,7 +998,7 @@ std::vector<std::vector<Point3d>> subtract(const std::vector<Point3d>& polygon,
   std::vector<std::vector<Point3d>> result;
 
   // convert vertices to boost rings
-  std::vector<Point3d> allPoints;
+  PointSet allPoints(tol);
 
   boost::optional<BoostPolygon> initialBoostPolygon = nonIntersectingBoostPolygonFromVertices(polygon, allPoints, tol);
   if (!initialBoostPolygon) {
@@ -1032,7 +1031,7 @@ std::vector<std::vector<Point3d>> subtract(const std::vector<Point3d>& polygon,
     const std::vector<BoostPolygon>& removedHoles = removeHoles(removedSpikes);
     result.reserve(result.size() + removedHoles.size());
     for (const BoostPolygon& removedHole : removedHoles) {
-      result.push_back(verticesFromBoostPolygon(removedHole, allPoints, tol));
+      result.push_back(verticesFromBoostPolygon(removedHole, allPoints));
     }
   }
 
@@ -1041,7 +1040,7 @@ std::vector<std::vector<Point3d>> subtract(const std::vector<Point3d>& polygon,
 
 bool selfIntersects(const std::vector<Point3d>& polygon, double tol) {
   // convert vertices to boost rings
-  std::vector<Point3d> allPoints;
+  PointSet allPoints(tol);
 
   const boost::optional<BoostPolygon> bp = nonIntersectingBoostPolygonFromVertices(polygon, allPoints, tol);
   // if bp has a value, we're able to get a non intersecting polygon, so does not self intersect
@@ -1050,7 +1049,7 @@ bool selfIntersects(const std::vector<Point3d>& polygon, double tol) {
 
 bool intersects(const std::vector<Point3d>& polygon1, const std::vector<Point3d>& polygon2, double tol) {
   // convert vertices to boost rings
-  std::vector<Point3d> allPoints;
+  PointSet allPoints(tol);
 
   boost::optional<BoostPolygon> bp1 = boostPolygonFromVertices(polygon1, allPoints, tol);
   boost::optional<BoostPolygon> bp2 = boostPolygonFromVertices(polygon2, allPoints, tol);
@@ -1069,14 +1068,14 @@ bool within(const Point3d& point1, const std::vector<Point3d>& polygon2, double
 
 bool within(const std::vector<Point3d>& geometry1, const std::vector<Point3d>& polygon2, double tol) {
   // convert vertices to boost rings
-  std::vector<Point3d> allPoints;
+  PointSet allPoints(tol);
 
   if (geometry1.size() == 1) {
     if (geometry1[0].z() > tol) {
       return false;
     }
 
-    boost::tuple<double, double> p = boostPointFromPoint3d(geometry1[0], allPoints, tol);
+    boost::tuple<double, double> p = boostPointFromPoint3d(geometry1[0], allPoints);
     const BoostPoint boostPoint(p.get<0>(), p.get<1>());
 
     boost::optional<BoostPolygon> bp2 = boostPolygonFromVertices(polygon2, allPoints, tol);
@@ -1104,7 +1103,7 @@ bool within(const std::vector<Point3d>& geometry1, const std::vector<Point3d>& p
   boost::optional<BoostPolygon> bp2 = boostPolygonFromVertices(polygon2, allPoints, tol);
   if (bp2) {
     for (const Point3d& point : geometry1) {
-      boost::tuple<double, double> p = boostPointFromPoint3d(point, allPoints, tol);
+      boost::tuple<double, double> p = boostPointFromPoint3d(point, allPoints);
       const BoostPoint boostPoint(p.get<0>(), p.get<1>());
 
       if (!boost::geometry::within(boostPoint, *bp2)) {
@@ -1156,7 +1155,7 @@ boost::optional<double> getLinearAlpha(const Point3d& point0, const Point3d& poi
 }
 
 std::vector<Point3d> simplify(const std::vector<Point3d>& vertices, bool removeCollinear, double tol) {
-  std::vector<Point3d> allPoints;
+  PointSet allPoints(tol);
 
   bool reversed = false;
   boost::optional<Vector3d> outwardNormal = getOutwardNormal(vertices);
@@ -1189,7 +1188,7 @@ std::vector<Point3d> simplify(const std::vector<Point3d>& vertices, bool removeC
     boost::geometry::simplify(*bp, out, tol);  // points within tol would already be merged
   }
 
-  std::vector<Point3d> tmp = verticesFromBoostPolygon(out, allPoints, tol, removeCollinear);
+  std::vector<Point3d> tmp = verticesFromBoostPolygon(out, allPoints, removeCollinear);
 
   if (reversed) {
     tmp = reorderULC(reverse(tmp));
@@ -1269,7 +1268,7 @@ std::vector<Point3d> simplify(const std::vector<Point3d>& vertices, bool removeC
 }
 
 /// Converts a Polygon to a BoostPolygon
-boost::optional<BoostPolygon> BoostPolygonFromPolygon(const Polygon3d& polygon, Point3dVector& allPoints, double tol) {
+boost::optional<BoostPolygon> BoostPolygonFromPolygon(const Polygon3d& polygon, PointSet& allPoints) {
   BoostPolygon boostPolygon;
 
   for (const Point3d& vertex : polygon.getOuterPath()) {
@@ -1280,17 +1279,17 @@ boost::optional<BoostPolygon> BoostPolygonFromPolygon(const Polygon3d& polygon,
     //  LOG_FREE(Error, "utilities.geometry.boostPolygonFromVertices", "All points must be on z = 0 plane");
     //  return boost::none;
     //}
-    boost::geometry::append(boostPolygon, boostPointFromPoint3d(vertex, allPoints, tol));
+    boost::geometry::append(boostPolygon, boostPointFromPoint3d(vertex, allPoints));
   }
 
   const Point3dVector& path = polygon.getOuterPath();
   const Point3d& first = path.front();
-  boost::geometry::append(boostPolygon, boostPointFromPoint3d(first, allPoints, tol));
+  boost::geometry::append(boostPolygon, boostPointFromPoint3d(first, allPoints));
 
   return boostPolygon;
 }
 
-Polygon3d PolygonFromBoostPolygon(const BoostPolygon& boostPolygon, Point3dVector& allPoints, double tol) {
+Polygon3d PolygonFromBoostPolygon(const BoostPolygon& boostPolygon, PointSet& allPoints) {
   Polygon3d p;
   BoostRing outer = boostPolygon.outer();
   if (outer.empty()) {
@@ -1300,7 +1299,7 @@ Polygon3d PolygonFromBoostPolygon(const BoostPolygon& boostPolygon, Point3dVecto
   Point3dVector points;
   for (unsigned i = 0; i < outer.size() - 1; ++i) {
     const Point3d point3d(outer[i].x() / scaleBy, outer[i].y() / scaleBy, 0.0);
-    Point3d resultPoint = getCombinedPoint(point3d, allPoints, tol);
+    Point3d resultPoint = allPoints.getCombinedPoint(point3d);
     // don't keep repeated vertices
     if ((i > 0) && (points.back() == resultPoint)) {
       continue;
@@ -1317,7 +1316,7 @@ Polygon3d PolygonFromBoostPolygon(const BoostPolygon& boostPolygon, Point3dVecto
     Point3dVector hole;
     for (unsigned i = 0; i < inner.size() - 1; ++i) {
       Point3d point3d(inner[i].x() / scaleBy, inner[i].y() / scaleBy, 0.0);
-      const Point3d resultPoint = getCombinedPoint(point3d, allPoints, tol);
+      const Point3d resultPoint = allPoints.getCombinedPoint(point3d);
       // don't keep repeated vertices
       if ((i > 0) && (hole.back() == resultPoint)) {
         continue;
@@ -1332,17 +1331,17 @@ Polygon3d PolygonFromBoostPolygon(const BoostPolygon& boostPolygon, Point3dVecto
 
 // Non class member stuff
 boost::optional<Polygon3d> join(const Polygon3d& polygon1, const Polygon3d& polygon2) {
-  Point3dVector allPoints;
-
   constexpr double tol = 0.01;
 
+  PointSet allPoints(tol);
+
   // Convert polygons to boost polygon (not ring obvs)
-  boost::optional<BoostPolygon> boostPolygon1 = BoostPolygonFromPolygon(polygon1, allPoints, tol);
+  boost::optional<BoostPolygon> boostPolygon1 = BoostPolygonFromPolygon(polygon1, allPoints);
   if (!boostPolygon1) {
     return boost::none;
   }
 
-  boost::optional<BoostPolygon> boostPolygon2 = BoostPolygonFromPolygon(polygon2, allPoints, tol);
+  boost::optional<BoostPolygon> boostPolygon2 = BoostPolygonFromPolygon(polygon2, allPoints);
   if (!boostPolygon2) {
     return boost::none;
   }
@@ -1364,7 +1363,7 @@ boost::optional<Polygon3d> join(const Polygon3d& polygon1, const Polygon3d& poly
   }
 
   // Convert back to polygon
-  Polygon3d p = PolygonFromBoostPolygon(unionResult.front(), allPoints, tol);
+  Polygon3d p = PolygonFromBoostPolygon(unionResult.front(), allPoints);
   return p;
 }
 
@@ -1459,10 +1458,10 @@ std::vector<Polygon3d> joinAll(const std::vector<Polygon3d>& polygons, double /*
 
 std::vector<Polygon3d> bufferAll(const std::vector<Polygon3d>& polygons, double tol) {
   BoostMultiPolygon source;
-  std::vector<Point3d> allPoints;
+  PointSet allPoints(tol);
 
   for (const Polygon3d& polygon : polygons) {
-    boost::optional<BoostPolygon> boostPolygon = BoostPolygonFromPolygon(polygon, allPoints, tol);
+    boost::optional<BoostPolygon> boostPolygon = BoostPolygonFromPolygon(polygon, allPoints);
     source.push_back(*boostPolygon);
   }
 
@@ -1483,14 +1482,14 @@ std::vector<Polygon3d> bufferAll(const std::vector<Polygon3d>& polygons, double
   for (const auto& boostPolygon : resultShrink) {
     BoostPolygon simplified;
     boost::geometry::simplify(boostPolygon, simplified, tol);
-    result.push_back(PolygonFromBoostPolygon(simplified, allPoints, tol));
+    result.push_back(PolygonFromBoostPolygon(simplified, allPoints));
   }
 
   return result;
 }
 
 boost::optional<std::vector<Point3d>> buffer(const std::vector<Point3d>& polygon1, double amount, double tol) {
-  std::vector<Point3d> allPoints;
+  PointSet allPoints(tol);
   boost::optional<BoostPolygon> boostPolygon1 = nonIntersectingBoostPolygonFromVertices(polygon1, allPoints, tol);
 
   if (!boostPolygon1) {
@@ -1515,12 +1514,12 @@ boost::optional<std::vector<Point3d>> buffer(const std::vector<Point3d>& polygon
   boost::geometry::buffer(polygons, buffered, distance_strategy, side_strategy, join_strategy, end_strategy, point_strategy);
   boost::geometry::simplify(buffered, result, 0.0005);
 
-  std::vector<Point3d> vertices = verticesFromBoostPolygon(result[0], allPoints, tol);
+  std::vector<Point3d> vertices = verticesFromBoostPolygon(result[0], allPoints);
   return vertices;
 }
 
 boost::optional<std::vector<std::vector<Point3d>>> buffer(const std::vector<std::vector<Point3d>>& polygons, double amount, double tol) {
-  std::vector<Point3d> allPoints;
+  PointSet allPoints(tol);
 
   BoostMultiPolygon boostPolygons;
   boostPolygons.reserve(polygons.size());
@@ -1547,7 +1546,7 @@ boost::optional<std::vector<std::vector<Point3d>>> buffer(const std::vector<std:
   std::vector<Point3dVector> results;
   results.reserve(result.size());
   for (const auto& boostPolygon : result) {
-    results.push_back(verticesFromBoostPolygon(boostPolygon, allPoints, tol));
+    results.push_back(verticesFromBoostPolygon(boostPolygon, allPoints));
   }
   return results;
 }
@@ -0,0 +1,70 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include "PointGrid.hpp"
+
+#include <cmath>
+
+namespace openstudio {
+
+namespace {
+
+  // keep cell indices well inside int64 so that neighbouring cells can be computed without overflow
+  constexpr double maxCell = 1.0e15;
+
+}  // namespace
+
+size_t PointGrid::CellKeyHash::operator()(const CellKey& key) const {
+  // cell indices are small and regularly spaced, mix them so that neighbouring cells spread over the buckets
+  auto mix = [](std::uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+  };
+  std::uint64_t h = mix(static_cast<std::uint64_t>(key.i));
+  h = mix(h ^ static_cast<std::uint64_t>(key.j));
+  h = mix(h ^ static_cast<std::uint64_t>(key.k));
+  return static_cast<size_t>(h);
+}
+
+PointGrid::PointGrid(double cellSize) : m_cellSize(cellSize) {}
+
+double PointGrid::cellSize() const {
+  return m_cellSize;
+}
+
+bool PointGrid::cellKey(double x, double y, double z, CellKey& key) const {
+  if (!(m_cellSize > 0.0) || !std::isfinite(x) || !std::isfinite(y) || !std::isfinite(z)) {
+    return false;
+  }
+  auto cellIndex = [this](double value) { return static_cast<std::int64_t>(std::clamp(std::floor(value / m_cellSize), -maxCell, maxCell)); };
+  key.i = cellIndex(x);
+  key.j = cellIndex(y);
+  key.k = cellIndex(z);
+  return true;
+}
+
+void PointGrid::insert(const Point3d& point3d, size_t index) {
+  CellKey key{};
+  if (cellKey(point3d.x(), point3d.y(), point3d.z(), key)) {
+    m_cells[key].push_back(index);
+  } else {
+    m_unbucketed.push_back(index);
+  }
+}
+
+void PointGrid::candidates(const Point3d& corner1, const Point3d& corner2, double margin, std::vector<size_t>& result) const {
+  forEachCandidate(corner1, corner2, margin, [&result](size_t index) { result.push_back(index); });
+}
+
+void PointGrid::clear() {
+  m_cells.clear();
+  m_unbucketed.clear();
+}
+
+}  // namespace openstudio
@@ -0,0 +1,118 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_GEOMETRY_POINTGRID_HPP
+#define UTILITIES_GEOMETRY_POINTGRID_HPP
+
+#include "../UtilitiesAPI.hpp"
+#include "Point3d.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace openstudio {
+
+/** PointGrid is a hash grid of indexed points, used to find the points that may be close to a point or to a segment by
+ *  visiting the cells around it instead of every point. It only returns candidates, callers still apply their exact test
+ *  (a distance, isAlmostEqual3dPt, etc). Points with non finite coordinates, or any point if the cell size is not positive,
+ *  are not bucketed and are always returned as candidates. */
+class UTILITIES_API PointGrid
+{
+ public:
+  explicit PointGrid(double cellSize);
+
+  double cellSize() const;
+
+  void insert(const Point3d& point3d, size_t index);
+
+  /// calls f(index) for the points in the cells overlapping the box spanned by corner1 and corner2 and expanded by margin,
+  /// in no particular order
+  template <typename F>
+  void forEachCandidate(const Point3d& corner1, const Point3d& corner2, double margin, F&& f) const;
+
+  /// indices of the points in the cells overlapping the box spanned by corner1 and corner2 and expanded by margin, appended to
+  /// result in no particular order
+  void candidates(const Point3d& corner1, const Point3d& corner2, double margin, std::vector<size_t>& result) const;
+
+  void clear();
+
+ private:
+  struct CellKey
+  {
+    std::int64_t i;
+    std::int64_t j;
+    std::int64_t k;
+
+    bool operator==(const CellKey& other) const {
+      return i == other.i && j == other.j && k == other.k;
+    }
+  };
+
+  struct CellKeyHash
+  {
+    size_t operator()(const CellKey& key) const;
+  };
+
+  // false if the point cannot be bucketed
+  bool cellKey(double x, double y, double z, CellKey& key) const;
+
+  double m_cellSize;
+  std::unordered_map<CellKey, std::vector<size_t>, CellKeyHash> m_cells;
+  std::vector<size_t> m_unbucketed;
+};
+
+template <typename F>
+void PointGrid::forEachCandidate(const Point3d& corner1, const Point3d& corner2, double margin, F&& f) const {
+  for (size_t index : m_unbucketed) {
+    f(index);
+  }
+
+  CellKey low{};
+  CellKey high{};
+  if (!cellKey(std::min(corner1.x(), corner2.x()) - margin, std::min(corner1.y(), corner2.y()) - margin, std::min(corner1.z(), corner2.z()) - margin,
+               low)
+      || !cellKey(std::max(corner1.x(), corner2.x()) + margin, std::max(corner1.y(), corner2.y()) + margin,
+                  std::max(corner1.z(), corner2.z()) + margin, high)) {
+    for (const auto& [key, indices] : m_cells) {
+      for (size_t index : indices) {
+        f(index);
+      }
+    }
+    return;
+  }
+
+  // a long diagonal segment can span more cells than there are occupied cells, then it is cheaper to visit them all
+  const double numCells =
+    static_cast<double>(high.i - low.i + 1) * static_cast<double>(high.j - low.j + 1) * static_cast<double>(high.k - low.k + 1);
+  if (numCells > static_cast<double>(m_cells.size())) {
+    for (const auto& [key, indices] : m_cells) {
+      if ((key.i >= low.i) && (key.i <= high.i) && (key.j >= low.j) && (key.j <= high.j) && (key.k >= low.k) && (key.k <= high.k)) {
+        for (size_t index : indices) {
+          f(index);
+        }
+      }
+    }
+    return;
+  }
+
+  for (std::int64_t i = low.i; i <= high.i; ++i) {
+    for (std::int64_t j = low.j; j <= high.j; ++j) {
+      for (std::int64_t k = low.k; k <= high.k; ++k) {
+        auto it = m_cells.find(CellKey{i, j, k});
+        if (it != m_cells.end()) {
+          for (size_t index : it->second) {
+            f(index);
+          }
+        }
+      }
+    }
+  }
+}
+
+}  // namespace openstudio
+
+#endif  // UTILITIES_GEOMETRY_POINTGRID_HPP
@@ -0,0 +1,91 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include "PointSet.hpp"
+
+#include <cmath>
+#include <limits>
+
+namespace openstudio {
+
+namespace {
+
+  constexpr size_t noPoint = std::numeric_limits<size_t>::max();
+
+}  // namespace
+
+PointSet::PointSet(double tol) : m_tol(tol), m_grid(2.0 * tol) {}
+
+double PointSet::tolerance() const {
+  return m_tol;
+}
+
+size_t PointSet::size() const {
+  return m_points.size();
+}
+
+bool PointSet::empty() const {
+  return m_points.empty();
+}
+
+const std::vector<Point3d>& PointSet::points() const {
+  return m_points;
+}
+
+const Point3d& PointSet::operator[](size_t index) const {
+  return m_points[index];
+}
+
+boost::optional<size_t> PointSet::find(const Point3d& point3d) const {
+  // non positive tolerances, and non finite points, never match
+  if (!(m_tol > 0.0) || !std::isfinite(point3d.x()) || !std::isfinite(point3d.y()) || !std::isfinite(point3d.z())) {
+    return boost::none;
+  }
+
+  // cells are twice the tolerance wide, so the box within tolerance of the point overlaps at most 8 cells.
+  // Candidates come in no particular order, keep the lowest index that matches
+  size_t result = noPoint;
+  m_grid.forEachCandidate(point3d, point3d, m_tol, [this, &point3d, &result](size_t index) {
+    if (index > result) {
+      return;
+    }
+    const Point3d& otherPoint = m_points[index];
+    if (std::sqrt(std::pow(point3d.x() - otherPoint.x(), 2) + std::pow(point3d.y() - otherPoint.y(), 2) + std::pow(point3d.z() - otherPoint.z(), 2))
+        < m_tol) {
+      result = index;
+    }
+  });
+
+  if (result == noPoint) {
+    return boost::none;
+  }
+  return result;
+}
+
+size_t PointSet::insert(const Point3d& point3d) {
+  if (boost::optional<size_t> index_ = find(point3d)) {
+    return *index_;
+  }
+
+  const size_t index = m_points.size();
+  m_points.push_back(point3d);
+  // points that can never match are not worth bucketing
+  if ((m_tol > 0.0) && std::isfinite(point3d.x()) && std::isfinite(point3d.y()) && std::isfinite(point3d.z())) {
+    m_grid.insert(point3d, index);
+  }
+
+  return index;
+}
+
+Point3d PointSet::getCombinedPoint(const Point3d& point3d) {
+  return m_points[insert(point3d)];
+}
+
+void PointSet::clear() {
+  m_points.clear();
+  m_grid.clear();
+}
+
+}  // namespace openstudio
@@ -0,0 +1,62 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_GEOMETRY_POINTSET_HPP
+#define UTILITIES_GEOMETRY_POINTSET_HPP
+
+#include "../UtilitiesAPI.hpp"
+#include "Point3d.hpp"
+#include "PointGrid.hpp"
+
+#include <boost/optional.hpp>
+
+#include <vector>
+
+namespace openstudio {
+
+/** PointSet is an insertion ordered set of Point3d in which points closer than a tolerance are welded together.
+ *  Looking up a point returns the first inserted point that is strictly closer than the tolerance, exactly like a linear
+ *  scan of the points in insertion order would. Points are bucketed in a PointGrid of cells twice the size of the
+ *  tolerance, so a lookup only visits the 8 cells closest to the point instead of every point in the set. */
+class UTILITIES_API PointSet
+{
+ public:
+  /// create an empty set, points closer than tol are combined. Default tolerance is 1mm
+  explicit PointSet(double tol = 0.001);
+
+  double tolerance() const;
+
+  /// number of distinct points in the set
+  size_t size() const;
+
+  bool empty() const;
+
+  /// distinct points, in insertion order
+  const std::vector<Point3d>& points() const;
+
+  const Point3d& operator[](size_t index) const;
+
+  /// index of the first point within tolerance of point3d, if any
+  boost::optional<size_t> find(const Point3d& point3d) const;
+
+  /// if point3d is within tolerance of any existing point then returns the index of the first such point
+  /// otherwise adds point3d to the set and returns its index
+  size_t insert(const Point3d& point3d);
+
+  /// if point3d is within tolerance of any existing point then returns the first such point
+  /// otherwise adds point3d to the set and returns point3d
+  Point3d getCombinedPoint(const Point3d& point3d);
+
+  void clear();
+
+ private:
+  double m_tol;
+  std::vector<Point3d> m_points;
+  PointGrid m_grid;
+};
+
+}  // namespace openstudio
+
+#endif  // UTILITIES_GEOMETRY_POINTSET_HPP
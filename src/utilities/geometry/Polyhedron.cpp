@@ -10,18 +10,38 @@
 #include "Intersection.hpp"
 #include "Plane.hpp"
 #include "Point3d.hpp"
+#include "PointGrid.hpp"
 #include "Transformation.hpp"
 #include "Vector3d.hpp"
 
 #include <fmt/core.h>
 
 #include <algorithm>
+#include <cmath>
 #include <numeric>
+#include <tuple>
 #include <utility>
 #include <vector>
 
 namespace openstudio {
 
+namespace {
+
+  // default tolerance of isAlmostEqual3dPt and isPointOnLineBetweenPoints, with a little slack so that rounding never drops a candidate
+  constexpr double searchMargin = defaultPointTolerance * 1.01;
+
+  /// edges that may be equal to edge, i.e. whose start is close to either end of edge, sorted and without duplicates
+  /// edgeGrid holds the start point of each edge
+  void edgeCandidates(const PointGrid& edgeGrid, const Surface3dEdge& edge, std::vector<size_t>& result) {
+    result.clear();
+    edgeGrid.candidates(edge.start(), edge.start(), searchMargin, result);
+    edgeGrid.candidates(edge.end(), edge.end(), searchMargin, result);
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+  }
+
+}  // namespace
+
 Surface3dEdge::Surface3dEdge(Point3d start, Point3d end, const Surface3d& firstSurface)
   : m_start(std::move(start)), m_end(std::move(end)), m_firstSurfaceName(firstSurface.name) {
   m_allSurfNums.push_back(firstSurface.surfNum);
@@ -242,29 +262,50 @@ void Polyhedron::performEdgeMatching() {
 
   m_hasAnySurfaceWithIncorrectOrientation = false;
 
-  // We use **Combinations** (rather than Permutations) to avoid traversing unnecessarily
+  // Every edge of every surface, the grid holds their start points so that matching edges are found without comparing all pairs
+  std::vector<std::pair<size_t, size_t>> allEdges;  // surface index, edge index
+  allEdges.reserve(numVertices());
+  PointGrid edgeGrid(2 * searchMargin);
   for (size_t i = 0; i < m_surfaces.size(); ++i) {
-    for (size_t j = i + 1; j < m_surfaces.size(); ++j) {
-      auto& surface1 = m_surfaces[i];
-      auto& surface2 = m_surfaces[j];
-      for (Surface3dEdge& edge1 : surface1.edges) {
-        for (Surface3dEdge& edge2 : surface2.edges) {
-          if (edge1 == edge2) {
-            if (std::find(edge1.allSurfNums().begin(), edge1.allSurfNums().cend(), edge2.firstSurfNum()) == edge1.allSurfNums().end()) {
-              // appendSurface will allow use to check edge.count() later to check if count == 2.
-              // All edges must be count == 2 in an Enclosed Polyhedron
-              edge1.appendSurface(surface2);
-              edge2.appendSurface(surface1);
-              // In a Polyhedron that has a consistent orientation (typically all faces are in counter clockwise order),
-              // each edge must be matched by an edge in the **opposite** direction. If not, mark conflicted
-              if (!edge1.reverseEqual(edge2)) {
-                edge1.markConflictedOrientation();
-                edge2.markConflictedOrientation();
-                m_hasAnySurfaceWithIncorrectOrientation = true;
-              }
-            }
-          }
-        }
+    for (size_t a = 0; a < m_surfaces[i].edges.size(); ++a) {
+      edgeGrid.insert(m_surfaces[i].edges[a].start(), allEdges.size());
+      allEdges.emplace_back(i, a);
+    }
+  }
+
+  // Matching pairs of edges of two different surfaces, visited in the same order as comparing every edge of every surface i
+  // to every edge of every later surface j would: by surface i, surface j, edge of i, edge of j. The order matters since
+  // it determines the order of allSurfNums
+  std::vector<std::tuple<size_t, size_t, size_t, size_t>> matches;
+  std::vector<size_t> candidates;
+  for (const auto& [i, a] : allEdges) {
+    const Surface3dEdge& edge1 = m_surfaces[i].edges[a];
+    edgeCandidates(edgeGrid, edge1, candidates);
+    for (size_t candidate : candidates) {
+      const auto& [j, b] = allEdges[candidate];
+      if ((j > i) && (edge1 == m_surfaces[j].edges[b])) {
+        matches.emplace_back(i, j, a, b);
+      }
+    }
+  }
+  std::sort(matches.begin(), matches.end());
+
+  for (const auto& [i, j, a, b] : matches) {
+    auto& surface1 = m_surfaces[i];
+    auto& surface2 = m_surfaces[j];
+    Surface3dEdge& edge1 = surface1.edges[a];
+    Surface3dEdge& edge2 = surface2.edges[b];
+    if (std::find(edge1.allSurfNums().begin(), edge1.allSurfNums().cend(), edge2.firstSurfNum()) == edge1.allSurfNums().end()) {
+      // appendSurface will allow use to check edge.count() later to check if count == 2.
+      // All edges must be count == 2 in an Enclosed Polyhedron
+      edge1.appendSurface(surface2);
+      edge2.appendSurface(surface1);
+      // In a Polyhedron that has a consistent orientation (typically all faces are in counter clockwise order),
+      // each edge must be matched by an edge in the **opposite** direction. If not, mark conflicted
+      if (!edge1.reverseEqual(edge2)) {
+        edge1.markConflictedOrientation();
+        edge2.markConflictedOrientation();
+        m_hasAnySurfaceWithIncorrectOrientation = true;
       }
     }
   }
@@ -296,7 +337,24 @@ void Polyhedron::resetEdgeMatching() {
 void Polyhedron::updateZonePolygonsForMissingColinearPoints() {
   const std::vector<Point3d> uniqVertices = uniqueVertices();
 
+  // A vertex can only split an edge if it is within tolerance of it, so only the vertices in the cells around the edge are tested.
+  // Cells about the size of an edge keep the number of cells visited per edge small
+  double totalLength = 0.0;
+  size_t numEdges = 0;
+  for (const auto& surface : m_surfaces) {
+    for (const auto& edge : surface.edges) {
+      totalLength += getDistance(edge.start(), edge.end());
+      ++numEdges;
+    }
+  }
+  const double averageLength = (numEdges > 0) ? totalLength / static_cast<double>(numEdges) : 0.0;
+  PointGrid vertexGrid(std::isfinite(averageLength) ? std::max(2 * searchMargin, averageLength) : 2 * searchMargin);
+  for (size_t v = 0; v < uniqVertices.size(); ++v) {
+    vertexGrid.insert(uniqVertices[v], v);
+  }
+
   bool anyInserted = false;
+  std::vector<size_t> candidates;
 
   for (auto& surface : m_surfaces) {
     LOG(Debug, surface.name)
@@ -306,8 +364,12 @@ void Polyhedron::updateZonePolygonsForMissingColinearPoints() {
 
       for (auto it = surface.edges.begin(); it != surface.edges.end(); ++it) {
 
-        // now go through all the vertices and see if they are colinear with start and end vertices
-        for (const auto& testVertex : uniqVertices) {
+        // now go through the nearby vertices, in the order of uniqVertices, and see if they are colinear with start and end vertices
+        candidates.clear();
+        vertexGrid.candidates(it->start(), it->end(), searchMargin, candidates);
+        std::sort(candidates.begin(), candidates.end());
+        for (size_t v : candidates) {
+          const auto& testVertex = uniqVertices[v];
           if (const boost::optional<Surface3dEdge> newEdge = it->splitEdge(testVertex)) {
             LOG(Debug, testVertex << " is on " << *it);
             auto itnext = std::next(it);
@@ -348,11 +410,15 @@ std::vector<Point3d> Polyhedron::uniqueVertices() const {
   std::vector<Point3d> uniqVertices;
   uniqVertices.reserve(numVertices());
 
+  PointGrid vertexGrid(2 * searchMargin);
+  std::vector<size_t> candidates;
   for (const auto& surface : m_surfaces) {
     for (const auto& edge : surface.edges) {
       const auto& pt = edge.start();
-      if (std::find_if(uniqVertices.cbegin(), uniqVertices.cend(), [&pt](const auto& unqV) { return isAlmostEqual3dPt(pt, unqV); })
-          == uniqVertices.cend()) {
+      candidates.clear();
+      vertexGrid.candidates(pt, pt, searchMargin, candidates);
+      if (std::none_of(candidates.cbegin(), candidates.cend(), [&pt, &uniqVertices](size_t v) { return isAlmostEqual3dPt(pt, uniqVertices[v]); })) {
+        vertexGrid.insert(pt, uniqVertices.size());
         uniqVertices.push_back(pt);
       }
     }
@@ -366,10 +432,14 @@ std::vector<Surface3dEdge> Polyhedron::uniqueEdges() const {
   uniqueSurface3dEdges.reserve(numVertices());
 
   // construct list of unique edges
+  PointGrid edgeGrid(2 * searchMargin);
+  std::vector<size_t> candidates;
   for (const auto& surface : m_surfaces) {
     for (const Surface3dEdge& thisSurface3dEdge : surface.edges) {
-      auto itFound = std::find(uniqueSurface3dEdges.begin(), uniqueSurface3dEdges.end(), thisSurface3dEdge);
-      if (itFound == uniqueSurface3dEdges.end()) {
+      edgeCandidates(edgeGrid, thisSurface3dEdge, candidates);
+      if (std::none_of(candidates.cbegin(), candidates.cend(),
+                       [&thisSurface3dEdge, &uniqueSurface3dEdges](size_t e) { return uniqueSurface3dEdges[e] == thisSurface3dEdge; })) {
+        edgeGrid.insert(thisSurface3dEdge.start(), uniqueSurface3dEdges.size());
         uniqueSurface3dEdges.push_back(thisSurface3dEdge);
       }
     }
@@ -384,13 +454,17 @@ std::vector<Surface3dEdge> Polyhedron::edgesNotTwo(bool includeCreatedEdges) con
   edgesNotTwo.reserve(numVertices());
 
   // All edges for an enclosed polyhedron should be shared by two (and only two) side
+  PointGrid edgeGrid(2 * searchMargin);
+  std::vector<size_t> candidates;
   for (const auto& surface : m_surfaces) {
     for (const Surface3dEdge& thisSurface3dEdge : surface.edges) {
       // only return a list of those edges that appear in both the original edge and the revised edges:
       // this eliminates added edges that will confuse users (edges that were caught by the updateZonePolygonsForMissingColinearPoints routine)
       if ((thisSurface3dEdge.count() != 2) && (includeCreatedEdges || !thisSurface3dEdge.hasBeenCreated())) {
-        auto itFound = std::find(edgesNotTwo.begin(), edgesNotTwo.end(), thisSurface3dEdge);
-        if (itFound == edgesNotTwo.end()) {
+        edgeCandidates(edgeGrid, thisSurface3dEdge, candidates);
+        if (std::none_of(candidates.cbegin(), candidates.cend(),
+                         [&thisSurface3dEdge, &edgesNotTwo](size_t e) { return edgesNotTwo[e] == thisSurface3dEdge; })) {
+          edgeGrid.insert(thisSurface3dEdge.start(), edgesNotTwo.size());
           edgesNotTwo.push_back(thisSurface3dEdge);
         }
       }
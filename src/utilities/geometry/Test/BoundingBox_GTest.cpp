@@ -120,3 +120,47 @@ TEST_F(GeometryFixture, BoundingBox_NoIntersection) {
   EXPECT_FALSE(b1.intersects(b2));
   EXPECT_FALSE(b2.intersects(b1));
 }
+
+TEST_F(GeometryFixture, BoundingBox_IntersectingPairs) {
+  // a grid of unit boxes, some of them touching, some a little apart, plus empty boxes
+  std::vector<BoundingBox> boxes;
+  for (unsigned i = 0; i < 12; ++i) {
+    for (unsigned j = 0; j < 9; ++j) {
+      for (unsigned k = 0; k < 3; ++k) {
+        double x = i * (i % 3 == 0 ? 1.005 : 1.0);
+        double y = j * (j % 2 == 0 ? 1.02 : 1.0);
+        double z = 3.0 * k;
+        BoundingBox box;
+        box.addPoint(Point3d(x, y, z));
+        box.addPoint(Point3d(x + 1.0, y + 1.0, z + ((i + j) % 4 == 0 ? 3.0 : 2.995)));
+        boxes.push_back(box);
+        if ((i + j + k) % 17 == 0) {
+          boxes.push_back(BoundingBox());
+        }
+      }
+    }
+  }
+  // one box that contains everything
+  BoundingBox all;
+  for (const BoundingBox& box : boxes) {
+    if (!box.isEmpty()) {
+      all.add(box);
+    }
+  }
+  boxes.insert(boxes.begin() + 50, all);
+
+  for (double tol : {0.0, 0.01, 0.5}) {
+    std::vector<std::pair<unsigned, unsigned>> expected;
+    for (unsigned i = 0; i < boxes.size(); ++i) {
+      for (unsigned j = i + 1; j < boxes.size(); ++j) {
+        if (boxes[i].intersects(boxes[j], tol)) {
+          expected.emplace_back(i, j);
+        }
+      }
+    }
+    EXPECT_EQ(expected, intersectingBoundingBoxPairs(boxes, tol)) << tol;
+  }
+
+  EXPECT_TRUE(intersectingBoundingBoxPairs(std::vector<BoundingBox>()).empty());
+  EXPECT_TRUE(intersectingBoundingBoxPairs(std::vector<BoundingBox>(3)).empty());
+}
@@ -0,0 +1,98 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "GeometryFixture.hpp"
+
+#include "../PointSet.hpp"
+#include "../Point3d.hpp"
+#include "../Geometry.hpp"
+
+#include <cmath>
+#include <limits>
+#include <random>
+
+using namespace openstudio;
+
+TEST_F(GeometryFixture, PointSet_Basic) {
+  PointSet points(0.01);
+  EXPECT_DOUBLE_EQ(0.01, points.tolerance());
+  EXPECT_TRUE(points.empty());
+  EXPECT_FALSE(points.find(Point3d(0, 0, 0)));
+
+  EXPECT_EQ(0u, points.insert(Point3d(0, 0, 0)));
+  EXPECT_EQ(1u, points.insert(Point3d(1, 0, 0)));
+  EXPECT_EQ(2u, points.insert(Point3d(0, 1, 0)));
+  EXPECT_EQ(3u, points.size());
+
+  // within tolerance, including across cell boundaries
+  EXPECT_EQ(0u, points.insert(Point3d(0.005, -0.005, 0.005)));
+  EXPECT_EQ(1u, points.insert(Point3d(0.999, 0.0, -0.001)));
+  EXPECT_TRUE(pointEqual(Point3d(0, 1, 0), points.getCombinedPoint(Point3d(0.0, 1.009, 0.0))));
+  EXPECT_EQ(3u, points.size());
+
+  // tolerance is strict
+  EXPECT_FALSE(points.find(Point3d(0.0, 1.01, 0.0)));
+  EXPECT_EQ(3u, points.insert(Point3d(2.0, 2.0, 2.0)));
+  EXPECT_EQ(4u, points.size());
+
+  ASSERT_EQ(4u, points.points().size());
+  EXPECT_TRUE(pointEqual(Point3d(2.0, 2.0, 2.0), points[3]));
+
+  points.clear();
+  EXPECT_TRUE(points.empty());
+  EXPECT_FALSE(points.find(Point3d(0, 0, 0)));
+}
+
+TEST_F(GeometryFixture, PointSet_FirstMatchWins) {
+  // two points 0.015 apart, a third point is within tolerance of both
+  PointSet points(0.01);
+  EXPECT_EQ(0u, points.insert(Point3d(0.0145, 0, 0)));
+  EXPECT_EQ(1u, points.insert(Point3d(0.0005, 0, 0)));
+  EXPECT_EQ(0u, points.insert(Point3d(0.007, 0, 0)));
+
+  // same thing, inserted in the other order
+  points.clear();
+  EXPECT_EQ(0u, points.insert(Point3d(0.0005, 0, 0)));
+  EXPECT_EQ(1u, points.insert(Point3d(0.0145, 0, 0)));
+  EXPECT_EQ(0u, points.insert(Point3d(0.007, 0, 0)));
+}
+
+TEST_F(GeometryFixture, PointSet_SameAsGetCombinedPoint) {
+  // points on a lattice 0.6mm apart with jitter, with 1mm tolerance many of them combine with several existing points
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int> lattice(-20, 20);
+  std::uniform_real_distribution<double> jitter(-0.0002, 0.0002);
+
+  std::vector<Point3d> allPoints;
+  PointSet points;
+  for (unsigned i = 0; i < 5000; ++i) {
+    Point3d point(0.0006 * lattice(gen) + jitter(gen), 0.0006 * lattice(gen) + jitter(gen), 0.0006 * lattice(gen) + jitter(gen));
+    Point3d expected = getCombinedPoint(point, allPoints);
+    Point3d combined = points.getCombinedPoint(point);
+    EXPECT_EQ(expected.x(), combined.x());
+    EXPECT_EQ(expected.y(), combined.y());
+    EXPECT_EQ(expected.z(), combined.z());
+    ASSERT_EQ(allPoints.size(), points.size());
+  }
+}
+
+TEST_F(GeometryFixture, PointSet_Degenerate) {
+  // non positive tolerance never combines anything, like getCombinedPoint
+  PointSet points(0.0);
+  EXPECT_EQ(0u, points.insert(Point3d(0, 0, 0)));
+  EXPECT_EQ(1u, points.insert(Point3d(0, 0, 0)));
+
+  // non finite coordinates never match
+  PointSet points2;
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  EXPECT_EQ(0u, points2.insert(Point3d(nan, 0, 0)));
+  EXPECT_EQ(1u, points2.insert(Point3d(nan, 0, 0)));
+
+  // very large coordinates still work
+  EXPECT_EQ(2u, points2.insert(Point3d(1.0e30, 0, 0)));
+  EXPECT_EQ(2u, points2.insert(Point3d(1.0e30, 0, 0)));
+  EXPECT_EQ(3u, points2.insert(Point3d(-1.0e30, 0, 0)));
+}
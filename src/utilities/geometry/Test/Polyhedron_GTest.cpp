@@ -217,3 +217,69 @@ TEST_F(GeometryFixture, Surface3d_Convexity) {
     EXPECT_FALSE(surface.isConvex());
   }
 }
+
+// n x n x n box, every face split into 1x1 squares except the roof which is a single surface, so every roof edge needs
+// n - 1 colinear points added before the box is enclosed
+std::vector<Surface3d> makeSubdividedBox(int n) {
+  std::vector<Surface3d> surfaces;
+  const auto N = static_cast<double>(n);
+  auto add = [&surfaces](std::vector<Point3d> vertices, const std::string& name) {
+    surfaces.emplace_back(std::move(vertices), fmt::format("{}-{}", name, surfaces.size()), surfaces.size());
+  };
+  for (int a = 0; a < n; ++a) {
+    for (int b = 0; b < n; ++b) {
+      const double u0 = a;
+      const double u1 = a + 1;
+      const double v0 = b;
+      const double v1 = b + 1;
+      add({{u0, v0, 0.0}, {u0, v1, 0.0}, {u1, v1, 0.0}, {u1, v0, 0.0}}, "Floor");
+      add({{u0, 0.0, v0}, {u1, 0.0, v0}, {u1, 0.0, v1}, {u0, 0.0, v1}}, "South");
+      add({{u1, N, v0}, {u0, N, v0}, {u0, N, v1}, {u1, N, v1}}, "North");
+      add({{0.0, u1, v0}, {0.0, u0, v0}, {0.0, u0, v1}, {0.0, u1, v1}}, "West");
+      add({{N, u0, v0}, {N, u1, v0}, {N, u1, v1}, {N, u0, v1}}, "East");
+    }
+  }
+  add({{0.0, 0.0, N}, {N, 0.0, N}, {N, N, N}, {0.0, N, N}}, "Roof");
+  return surfaces;
+}
+
+TEST_F(GeometryFixture, Polyhedron_Subdivided_Box) {
+  constexpr int n = 6;
+  std::vector<Surface3d> surfaces = makeSubdividedBox(n);
+  ASSERT_EQ(5 * n * n + 1, surfaces.size());
+
+  {
+    Polyhedron zonePoly(surfaces);
+    EXPECT_TRUE(zonePoly.isEnclosedVolume());
+    EXPECT_TRUE(zonePoly.hasAddedColinearPoints());
+    EXPECT_FALSE(zonePoly.hasAnySurfaceWithIncorrectOrientation());
+    EXPECT_TRUE(zonePoly.edgesNotTwo().empty());
+    // a fully subdivided box has 6n^2 + 2 vertices and 12n^2 edges, the roof has none of the (n - 1)^2 interior points
+    // nor the 2n(n - 1) interior edges
+    EXPECT_EQ(6u * n * n + 2u - (n - 1) * (n - 1), zonePoly.uniqueVertices().size());
+    EXPECT_EQ(12u * n * n - 2u * n * (n - 1), zonePoly.uniqueEdges().size());
+    EXPECT_DOUBLE_EQ(n * n * n, zonePoly.polyhedronVolume());
+    EXPECT_DOUBLE_EQ(n * n * n, zonePoly.calcDivergenceTheoremVolume());
+    // the roof picked up the 4 * (n - 1) points of the walls below it
+    EXPECT_EQ(4u * n, zonePoly.surface3ds().back().vertices.size());
+  }
+
+  // flip one wall and remove another
+  std::reverse(surfaces[3].vertices.begin(), surfaces[3].vertices.end());
+  const std::string flippedName = surfaces[3].name;
+  std::vector<Surface3d> flipped;
+  for (size_t i = 0; i < surfaces.size(); ++i) {
+    if (i != 7) {
+      flipped.emplace_back(surfaces[i].vertices, surfaces[i].name, flipped.size());
+    }
+  }
+  {
+    Polyhedron zonePoly(flipped);
+    EXPECT_FALSE(zonePoly.isEnclosedVolume());
+    EXPECT_TRUE(zonePoly.hasAnySurfaceWithIncorrectOrientation());
+    EXPECT_EQ(4u, zonePoly.edgesNotTwo().size());
+    std::vector<Surface3d> incorrect = zonePoly.findSurfacesWithIncorrectOrientation();
+    ASSERT_EQ(1u, incorrect.size());
+    EXPECT_EQ(flippedName, incorrect.front().name);
+  }
+}
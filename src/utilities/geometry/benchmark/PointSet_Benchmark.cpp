@@ -0,0 +1,65 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../PointSet.hpp"
+#include "../Point3d.hpp"
+#include "../Geometry.hpp"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace openstudio;
+
+// Corners of n 1x1 m squares on a grid, each corner is shared by up to 4 squares and jittered below tolerance,
+// like the vertices of the triangulated surfaces of a large model
+std::vector<Point3d> makeSharedCorners(size_t n) {
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> jitter(-0.0001, 0.0001);
+
+  const auto perSide = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(n))));
+  std::vector<Point3d> result;
+  result.reserve(4 * n);
+  for (size_t i = 0; i < n; ++i) {
+    const auto x = static_cast<double>(i % perSide);
+    const auto y = static_cast<double>(i / perSide);
+    for (const auto& [dx, dy] : {std::pair{0.0, 0.0}, {1.0, 0.0}, {1.0, 1.0}, {0.0, 1.0}}) {
+      result.emplace_back(x + dx + jitter(gen), y + dy + jitter(gen), jitter(gen));
+    }
+  }
+  return result;
+}
+
+static void BM_GetCombinedPointVector(benchmark::State& state) {
+  const std::vector<Point3d> points = makeSharedCorners(state.range(0));
+
+  for (auto _ : state) {
+    std::vector<Point3d> allPoints;
+    for (const Point3d& point : points) {
+      benchmark::DoNotOptimize(getCombinedPoint(point, allPoints));
+    }
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_GetCombinedPointPointSet(benchmark::State& state) {
+  const std::vector<Point3d> points = makeSharedCorners(state.range(0));
+
+  for (auto _ : state) {
+    PointSet allPoints;
+    for (const Point3d& point : points) {
+      benchmark::DoNotOptimize(allPoints.getCombinedPoint(point));
+    }
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(BM_GetCombinedPointVector)->RangeMultiplier(4)->Range(16, 4096)->Complexity();
+
+BENCHMARK(BM_GetCombinedPointPointSet)->RangeMultiplier(4)->Range(16, 65536)->Complexity();
@@ -0,0 +1,89 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../Polyhedron.hpp"
+#include "../Point3d.hpp"
+
+#include <fmt/core.h>
+
+#include <vector>
+
+using namespace openstudio;
+
+// n x n x n box with every face split into 1x1 squares, 6n^2 surfaces. With splitRoof = false the roof is a single
+// surface and its edges need the colinear points of the walls below added, 5n^2 + 1 surfaces
+std::vector<Surface3d> makeSubdividedBox(int n, bool splitRoof) {
+  std::vector<Surface3d> surfaces;
+  const auto N = static_cast<double>(n);
+  auto add = [&surfaces](std::vector<Point3d> vertices, const char* name) {
+    surfaces.emplace_back(std::move(vertices), fmt::format("{}-{}", name, surfaces.size()), surfaces.size());
+  };
+  for (int a = 0; a < n; ++a) {
+    for (int b = 0; b < n; ++b) {
+      const double u0 = a;
+      const double u1 = a + 1;
+      const double v0 = b;
+      const double v1 = b + 1;
+      add({{u0, v0, 0.0}, {u0, v1, 0.0}, {u1, v1, 0.0}, {u1, v0, 0.0}}, "Floor");
+      if (splitRoof) {
+        add({{u0, v0, N}, {u1, v0, N}, {u1, v1, N}, {u0, v1, N}}, "Roof");
+      }
+      add({{u0, 0.0, v0}, {u1, 0.0, v0}, {u1, 0.0, v1}, {u0, 0.0, v1}}, "South");
+      add({{u1, N, v0}, {u0, N, v0}, {u0, N, v1}, {u1, N, v1}}, "North");
+      add({{0.0, u1, v0}, {0.0, u0, v0}, {0.0, u0, v1}, {0.0, u1, v1}}, "West");
+      add({{N, u0, v0}, {N, u1, v0}, {N, u1, v1}, {N, u0, v1}}, "East");
+    }
+  }
+  if (!splitRoof) {
+    add({{0.0, 0.0, N}, {N, 0.0, N}, {N, N, N}, {0.0, N, N}}, "Roof");
+  }
+  return surfaces;
+}
+
+static void BM_PolyhedronEnclosed(benchmark::State& state) {
+  const std::vector<Surface3d> surfaces = makeSubdividedBox(static_cast<int>(state.range(0)), true);
+
+  for (auto _ : state) {
+    Polyhedron polyhedron(surfaces);
+    benchmark::DoNotOptimize(polyhedron.isEnclosedVolume());
+  }
+
+  state.counters["surfaces"] = static_cast<double>(surfaces.size());
+  state.SetComplexityN(static_cast<int64_t>(surfaces.size()));
+}
+
+static void BM_PolyhedronMissingColinearPoints(benchmark::State& state) {
+  const std::vector<Surface3d> surfaces = makeSubdividedBox(static_cast<int>(state.range(0)), false);
+
+  for (auto _ : state) {
+    Polyhedron polyhedron(surfaces);
+    benchmark::DoNotOptimize(polyhedron.isEnclosedVolume());
+  }
+
+  state.counters["surfaces"] = static_cast<double>(surfaces.size());
+  state.SetComplexityN(static_cast<int64_t>(surfaces.size()));
+}
+
+// what Space_Impl::isEnclosedVolume reports for a leaky space
+static void BM_PolyhedronEdgesNotTwo(benchmark::State& state) {
+  std::vector<Surface3d> surfaces = makeSubdividedBox(static_cast<int>(state.range(0)), true);
+  surfaces.pop_back();
+  const Polyhedron polyhedron(surfaces);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(polyhedron.edgesNotTwo());
+    benchmark::DoNotOptimize(polyhedron.uniqueEdges());
+  }
+
+  state.counters["surfaces"] = static_cast<double>(surfaces.size());
+  state.SetComplexityN(static_cast<int64_t>(surfaces.size()));
+}
+
+// 41 is about 10k surfaces
+BENCHMARK(BM_PolyhedronEnclosed)->Unit(benchmark::kMillisecond)->Arg(5)->Arg(13)->Arg(41)->Complexity();
+BENCHMARK(BM_PolyhedronMissingColinearPoints)->Unit(benchmark::kMillisecond)->Arg(5)->Arg(13)->Arg(45)->Complexity();
+BENCHMARK(BM_PolyhedronEdgesNotTwo)->Unit(benchmark::kMillisecond)->Arg(5)->Arg(13)->Arg(41)->Complexity();
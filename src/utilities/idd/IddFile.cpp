@@ -16,6 +16,10 @@
 
 #include "../core/Containers.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
 namespace openstudio {
 
 namespace detail {
@@ -71,26 +75,18 @@ namespace detail {
   }
 
   boost::optional<IddObject> IddFile_Impl::versionObject() const {
-    if (m_versionObject) {
-      return m_versionObject;
-    }
-
     OptionalIddObject result;
-    IddObjectVector candidates = getObjects(iddRegex::versionObjectName());
-    if (candidates.size() == 1u) {
-      result = candidates[0];
+    if (m_versionObjectCandidates.size() == 1u) {
+      result = m_objects[m_versionObjectCandidates[0]];
     }
-    m_versionObject = result;
     return result;
   }
 
   boost::optional<IddObject> IddFile_Impl::getObject(const std::string& objectName) const {
     OptionalIddObject result;
-    for (const IddObject& object : m_objects) {
-      if (istringEqual(object.name(), objectName)) {
-        result = object;
-        break;
-      }
+    auto it = m_objectsByName.find(openstudio::ascii_to_upper_copy(objectName));
+    if (it != m_objectsByName.end()) {
+      result = m_objects[it->second];
     }
     return result;
   }
@@ -106,11 +102,9 @@ namespace detail {
       return result;
     }
 
-    for (const IddObject& object : m_objects) {
-      if (object.type() == objectType) {
-        result = object;
-        break;
-      }
+    auto it = m_objectsByType.find(objectType.value());
+    if (it != m_objectsByType.end()) {
+      result = m_objects[it->second];
     }
 
     return result;
@@ -147,17 +141,17 @@ namespace detail {
   }
 
   void IddFile_Impl::addObject(const IddObject& object) {
-    m_objects.push_back(object);
+    indexObject(object);
   }
 
   // SERIALIZATION
 
-  std::shared_ptr<IddFile_Impl> IddFile_Impl::load(std::istream& is) {
+  std::shared_ptr<IddFile_Impl> IddFile_Impl::load(std::istream& is, unsigned numThreads) {
     std::shared_ptr<IddFile_Impl> result;
     IddFile_Impl iddFileImpl;
 
     try {
-      iddFileImpl.parse(is);
+      iddFileImpl.parse(is, numThreads);
     } catch (...) {
       return result;
     }
@@ -181,7 +175,21 @@ namespace detail {
 
   // PRIVATE
 
-  void IddFile_Impl::parse(std::istream& is) {
+  void IddFile_Impl::indexObject(const IddObject& object) {
+    const size_t index = m_objects.size();
+    m_objects.push_back(object);
+
+    // lookups return the first match, like a scan of m_objects would
+    m_objectsByName.try_emplace(openstudio::ascii_to_upper_copy(object.name()), index);
+    if (object.type() != IddObjectType::UserCustom) {
+      m_objectsByType.try_emplace(object.type().value(), index);
+    }
+    if (boost::regex_match(object.name(), iddRegex::versionObjectName())) {
+      m_versionObjectCandidates.push_back(index);
+    }
+  }
+
+  void IddFile_Impl::parse(std::istream& is, unsigned numThreads) {
 
     // keep track of line number in the idd
     int lineNum = 0;
@@ -201,7 +209,16 @@ namespace detail {
     OptionalIddObject commentOnlyObject =
       IddObject::load(iddRegex::commentOnlyObjectName(), currentGroup, iddRegex::commentOnlyObjectText(), IddObjectType::CommentOnly);
     OS_ASSERT(commentOnlyObject);
-    m_objects.push_back(*commentOnlyObject);
+    indexObject(*commentOnlyObject);
+
+    // name, group and text of each object, objects are only parsed once the whole file has been split
+    struct ObjectText
+    {
+      std::string name;
+      std::string group;
+      std::string text;
+    };
+    std::vector<ObjectText> objectTexts;
 
     // temp string to read file
     std::string line;
@@ -320,15 +337,50 @@ namespace detail {
           }
         }
 
-        // construct the IddObject using default UserCustom type
-        OptionalIddObject object = IddObject::load(objectName, currentGroup, text);
+        objectTexts.push_back(ObjectText{std::move(objectName), currentGroup, std::move(text)});
+      }
+    }
 
-        // construct a new object and put it in the object vector
-        if (object) {
-          m_objects.push_back(*object);
-        } else {
-          LOG_AND_THROW("Unable to construct IddObject from text: " << '\n' << text);
+    // construct the IddObjects using default UserCustom type, each object only depends on its own text
+    std::vector<OptionalIddObject> objects(objectTexts.size());
+    auto parseObject = [&objectTexts, &objects](size_t i) {
+      objects[i] = IddObject::load(objectTexts[i].name, objectTexts[i].group, objectTexts[i].text);
+    };
+
+    if (numThreads == 0) {
+      numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    numThreads = static_cast<unsigned>(std::min<size_t>(numThreads, objectTexts.size()));
+
+    if (numThreads <= 1) {
+      for (size_t i = 0; i < objectTexts.size(); ++i) {
+        parseObject(i);
+      }
+    } else {
+      std::atomic<size_t> next(0);
+      auto work = [&next, &objectTexts, &parseObject]() {
+        for (size_t i = next++; i < objectTexts.size(); i = next++) {
+          parseObject(i);
         }
+      };
+
+      std::vector<std::thread> threads;
+      threads.reserve(numThreads - 1);
+      for (unsigned i = 1; i < numThreads; ++i) {
+        threads.emplace_back(work);
+      }
+      work();
+      for (std::thread& thread : threads) {
+        thread.join();
+      }
+    }
+
+    // put the objects in the object vector in file order
+    for (size_t i = 0; i < objects.size(); ++i) {
+      if (objects[i]) {
+        indexObject(*objects[i]);
+      } else {
+        LOG_AND_THROW("Unable to construct IddObject from text: " << '\n' << objectTexts[i].text);
       }
     }
 
@@ -419,7 +471,11 @@ std::vector<IddObject> IddFile::uniqueObjects() const {
 // SERIALIZATION
 
 OptionalIddFile IddFile::load(std::istream& is) {
-  std::shared_ptr<detail::IddFile_Impl> p = detail::IddFile_Impl::load(is);
+  return load(is, 1u);
+}
+
+OptionalIddFile IddFile::load(std::istream& is, unsigned numThreads) {
+  std::shared_ptr<detail::IddFile_Impl> p = detail::IddFile_Impl::load(is, numThreads);
   if (p) {
     return IddFile(p);
   }
@@ -98,6 +98,10 @@ class UTILITIES_API IddFile
   /** Load an IddFile from std::istream, if possible. */
   static boost::optional<IddFile> load(std::istream& is);
 
+  /** Load an IddFile from std::istream, if possible, parsing its objects on up to numThreads threads
+   *  (0 means one thread per hardware thread). */
+  static boost::optional<IddFile> load(std::istream& is, unsigned numThreads);
+
   /** Load an IddFile from path p, if possible. */
   static boost::optional<IddFile> load(const openstudio::path& p);
 
@@ -12,6 +12,7 @@
 
 #include <string>
 #include <ostream>
+#include <unordered_map>
 #include <vector>
 
 #include <boost/algorithm/string.hpp>
@@ -86,8 +87,9 @@ namespace detail {
     /** @name Serialization */
     //@{
 
-    /// parse text from input stream to construct an IddFile_Impl
-    static std::shared_ptr<IddFile_Impl> load(std::istream& is);
+    /// parse text from input stream to construct an IddFile_Impl, objects are parsed on up to numThreads threads
+    /// (0 means one thread per hardware thread)
+    static std::shared_ptr<IddFile_Impl> load(std::istream& is, unsigned numThreads = 1);
 
     /// print
     std::ostream& print(std::ostream& os) const;
@@ -95,8 +97,12 @@ namespace detail {
     //@}
 
    private:
-    /// Parse file text to populate this IddFile.
-    void parse(std::istream& is);
+    /// Parse file text to populate this IddFile. The file is split into objects serially, then the objects are
+    /// parsed on up to numThreads threads.
+    void parse(std::istream& is, unsigned numThreads);
+
+    /// Add object to m_objects and to the lookup indices.
+    void indexObject(const IddObject& object);
 
     /// Version string required to be at top of any IddFile.
     std::string m_version;
@@ -110,8 +116,15 @@ namespace detail {
     /// The vector of IddObjects that constitute this IddFile.
     std::vector<IddObject> m_objects;
 
-    /// Cache the Version IddObject
-    mutable boost::optional<IddObject> m_versionObject;
+    /// Index in m_objects of the first object with a given upper case name, for getObject(const std::string&).
+    std::unordered_map<std::string, size_t> m_objectsByName;
+
+    /// Index in m_objects of the first object with a given type, for getObject(IddObjectType). UserCustom is not indexed.
+    std::unordered_map<int, size_t> m_objectsByType;
+
+    /// Indices in m_objects of the objects whose name matches iddRegex::versionObjectName(), kept up to date instead
+    /// of cached on first use so that an IddFile can be shared between threads.
+    std::vector<size_t> m_versionObjectCandidates;
 
     /// Configure logging.
     REGISTER_LOGGER("utilities.idd.IddFile");
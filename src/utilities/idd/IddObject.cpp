@@ -41,6 +41,7 @@ namespace detail {
     oField = IddField::load("Generic Data Field", "A2; \\field Generic Data Field \n \\type alpha \n \\begin-extensible", m_name);
     OS_ASSERT(oField);
     m_extensibleFields.push_back(*oField);
+    updateNameField();
   }
 
   // GETTERS
@@ -156,6 +157,7 @@ namespace detail {
         unsigned newMaxFields = m_properties.maxFields.get() + 1;
         m_properties.maxFields = newMaxFields;
       }
+      updateNameField();
     }
   }
 
@@ -210,22 +212,12 @@ namespace detail {
   }
 
   bool IddObject_Impl::hasNameField() const {
-    if (m_nameFieldCache) {
-      return m_nameFieldCache->first;
-    }
-
-    unsigned index = 0;
-    if (hasHandleField()) {
-      index = 1;
-    }
-    bool result = ((m_fields.size() > index) && (m_fields[index].isNameField()));
-    m_nameFieldCache = std::pair<bool, unsigned>(result, index);
-    return result;
+    return m_hasNameField;
   }
 
   boost::optional<unsigned> IddObject_Impl::nameFieldIndex() const {
-    if (hasNameField()) {
-      return m_nameFieldCache->second;
+    if (m_hasNameField) {
+      return m_nameFieldIndex;
     }
     return boost::none;
   }
@@ -452,6 +444,13 @@ namespace detail {
     if (m_properties.extensible) {
       makeExtensible();
     }
+
+    updateNameField();
+  }
+
+  void IddObject_Impl::updateNameField() {
+    m_nameFieldIndex = hasHandleField() ? 1 : 0;
+    m_hasNameField = ((m_fields.size() > m_nameFieldIndex) && (m_fields[m_nameFieldIndex].isNameField()));
   }
 
   void IddObject_Impl::makeExtensible() {
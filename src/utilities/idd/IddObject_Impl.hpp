@@ -166,8 +166,10 @@ namespace detail {
     IddFieldVector m_extensibleFields;  // vector of extensible fields, forms single
                                         // extensible field group
     std::vector<unsigned> m_urlIdx;
-    // .first = hasNameField(); .second = nameFieldIndex
-    mutable boost::optional<std::pair<bool, unsigned>> m_nameFieldCache;
+    // hasNameField() and nameFieldIndex(), set by updateNameField whenever m_fields changes so that
+    // IddObjects shared between threads are never written by their getters
+    bool m_hasNameField = false;
+    unsigned m_nameFieldIndex = 0;
 
     // partial constructor used by load
     IddObject_Impl(const std::string& name, const std::string& group, IddObjectType type);
@@ -180,6 +182,8 @@ namespace detail {
     void parseFields(const std::string& text);
     void makeExtensible();
 
+    void updateNameField();
+
     // configure logging
     REGISTER_LOGGER("utilities.idd.IddObject");
   };
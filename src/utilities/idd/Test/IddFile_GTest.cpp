@@ -354,3 +354,36 @@ TEST_F(IddFixture, IddFile_EpGroups) {
                                                                      << " object groups, including the first, unnamed group: " << '\n'
                                                                      << ss.str());
 }
+
+TEST_F(IddFixture, IddFile_LoadThreaded) {
+  path iddPath = resourcesPath() / toPath("model/OpenStudio.idd");
+
+  openstudio::filesystem::ifstream serialFile(iddPath);
+  ASSERT_TRUE(serialFile ? true : false);
+  OptionalIddFile serialIddFile = IddFile::load(serialFile);
+  ASSERT_TRUE(serialIddFile);
+
+  openstudio::filesystem::ifstream threadedFile(iddPath);
+  ASSERT_TRUE(threadedFile ? true : false);
+  OptionalIddFile threadedIddFile = IddFile::load(threadedFile, 4u);
+  ASSERT_TRUE(threadedIddFile);
+
+  // same objects in the same order
+  EXPECT_EQ(serialIddFile->version(), threadedIddFile->version());
+  EXPECT_EQ(serialIddFile->header(), threadedIddFile->header());
+  IddObjectVector serialObjects = serialIddFile->objects();
+  IddObjectVector threadedObjects = threadedIddFile->objects();
+  ASSERT_EQ(serialObjects.size(), threadedObjects.size());
+  for (unsigned i = 0, n = serialObjects.size(); i < n; ++i) {
+    EXPECT_TRUE(serialObjects[i] == threadedObjects[i]) << serialObjects[i].name();
+  }
+
+  // lookups by name are case insensitive
+  OptionalIddObject versionObject = threadedIddFile->versionObject();
+  ASSERT_TRUE(versionObject);
+  EXPECT_EQ("OS:Version", versionObject->name());
+  OptionalIddObject object = threadedIddFile->getObject("os:version");
+  ASSERT_TRUE(object);
+  EXPECT_EQ("OS:Version", object->name());
+  EXPECT_FALSE(threadedIddFile->getObject("OS:NotAnObject"));
+}
@@ -10,6 +10,8 @@
 #include "../../core/Filesystem.hpp"
 #include "../../core/Assert.hpp"
 
+#include <utilities/idd/IddFactory.hxx>
+
 #include <resources.hxx>
 
 #include <OpenStudio.hxx>
@@ -27,11 +29,9 @@ static void BM_ParseEnergyPlusIdd(benchmark::State& state, const std::string& te
     std::shared_ptr<openstudio::detail::IddFile_Impl> iddFileImpl_ptr;
 
     if (testCase == "Old") {
-      iddFileImpl_ptr = openstudio::detail::IddFile_Impl::load(inFile);  //, boost::none);
-      //} else if (testCase == "New") {
-      //iddFileImpl_ptr = openstudio::detail::IddFile_Impl::load(inFile, false);
-      //} else if (testCase == "NewParallel") {
-      //iddFileImpl_ptr = openstudio::detail::IddFile_Impl::load(inFile, true);
+      iddFileImpl_ptr = openstudio::detail::IddFile_Impl::load(inFile);
+    } else if (testCase == "NewParallel") {
+      iddFileImpl_ptr = openstudio::detail::IddFile_Impl::load(inFile, 0u);
     } else {
       BOOST_ASSERT(false);
     }
@@ -53,11 +53,9 @@ static void BM_ParseOpenStudioIdd(benchmark::State& state, const std::string& te
     std::shared_ptr<openstudio::detail::IddFile_Impl> iddFileImpl_ptr;
 
     if (testCase == "Old") {
-      iddFileImpl_ptr = openstudio::detail::IddFile_Impl::load(inFile);  //, boost::none);
-      //} else if (testCase == "New") {
-      //iddFileImpl_ptr = openstudio::detail::IddFile_Impl::load(inFile, false);
-      //} else if (testCase == "NewParallel") {
-      //iddFileImpl_ptr = openstudio::detail::IddFile_Impl::load(inFile, true);
+      iddFileImpl_ptr = openstudio::detail::IddFile_Impl::load(inFile);
+    } else if (testCase == "NewParallel") {
+      iddFileImpl_ptr = openstudio::detail::IddFile_Impl::load(inFile, 0u);
     } else {
       BOOST_ASSERT(false);
     }
@@ -68,10 +66,37 @@ static void BM_ParseOpenStudioIdd(benchmark::State& state, const std::string& te
   }
 }
 
+// Only the first iteration materializes the IddObjects of the factory, later iterations return the shared IddFile.
+// Run with --benchmark_repetitions=1 --benchmark_min_time=1x to see the cold start on its own.
+static void BM_FactoryOpenStudioIdd(benchmark::State& state) {
+  for (auto _ : state) {
+    IddFile iddFile = IddFactory::instance().getIddFile(IddFileType::OpenStudio);
+    benchmark::DoNotOptimize(iddFile);
+  }
+}
+
+// Lookups by name, as done for every object when loading an IdfFile against an IddFile
+static void BM_IddFileGetObjectByName(benchmark::State& state) {
+  IddFile iddFile = IddFactory::instance().getIddFile(IddFileType::OpenStudio);
+  std::vector<std::string> names;
+  for (const IddObject& iddObject : iddFile.objects()) {
+    names.push_back(iddObject.name());
+  }
+
+  for (auto _ : state) {
+    for (const std::string& name : names) {
+      benchmark::DoNotOptimize(iddFile.getObject(name));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * names.size());
+}
+
 BENCHMARK_CAPTURE(BM_ParseEnergyPlusIdd, Old, std::string("Old"))->Unit(benchmark::kMillisecond);
-// BENCHMARK_CAPTURE(BM_ParseEnergyPlusIdd, New, std::string("New"));
-// BENCHMARK_CAPTURE(BM_ParseEnergyPlusIdd, NewParallel, std::string("NewParallel"));
+BENCHMARK_CAPTURE(BM_ParseEnergyPlusIdd, NewParallel, std::string("NewParallel"))->Unit(benchmark::kMillisecond)->UseRealTime();
 
 BENCHMARK_CAPTURE(BM_ParseOpenStudioIdd, Old, std::string("Old"))->Unit(benchmark::kMillisecond);
-// BENCHMARK_CAPTURE(BM_ParseOpenStudioIdd, New, std::string("New"));
-// BENCHMARK_CAPTURE(BM_ParseOpenStudioIdd, NewParallel, std::string("NewParallel"));
+BENCHMARK_CAPTURE(BM_ParseOpenStudioIdd, NewParallel, std::string("NewParallel"))->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK(BM_FactoryOpenStudioIdd)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_IddFileGetObjectByName);
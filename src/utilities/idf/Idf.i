@@ -89,6 +89,9 @@
 %ignore openstudio::IdfFile::load(std::istream&, IddFileType);
 %ignore openstudio::IdfFile::load(std::istream&, const IddFile&);
 
+// scoped object, its lifetime cannot be controlled from the bindings
+%ignore openstudio::Workspace::BatchEdit;
+
 #if defined(SWIGRUBY)
   // add mixins
   %mixin openstudio::IdfObject "Comparable, Marshal";
@@ -6,6 +6,7 @@
 #include "IdfFile.hpp"
 #include <utilities/idf/IdfObject_Impl.hpp>  // needed for serialization
 #include "IdfRegex.hpp"
+#include "IdfTokenizer.hpp"
 #include "ValidityReport.hpp"
 
 #include "../idd/IddRegex.hpp"
@@ -20,6 +21,14 @@
 
 #include <boost/iostreams/filter/newline.hpp>
 #include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <map>
+#include <sstream>
+#include <thread>
 
 namespace openstudio {
 
@@ -316,6 +325,34 @@ OptionalIdfFile IdfFile::load(std::istream& is, const IddFile& iddFile, Progress
   return boost::none;
 }
 
+boost::optional<IdfFile> IdfFile::loadUsingRegex(std::istream& is, const IddFileType& iddFileType, ProgressBar* progressBar) {
+  IdfFile result(iddFileType);
+  // remove initial version object
+  if (OptionalIdfObject vo = result.versionObject()) {
+    result.removeObject(*vo);
+  }
+  if (result.m_loadUsingRegex(is, progressBar)) {
+    // check for it again here
+    result.addVersionObject();
+    return result;
+  }
+  return boost::none;
+}
+
+OptionalIdfFile IdfFile::loadUsingRegex(std::istream& is, const IddFile& iddFile, ProgressBar* progressBar) {
+  IdfFile result(iddFile);
+  // remove initial version object
+  if (OptionalIdfObject vo = result.versionObject()) {
+    result.removeObject(*vo);
+  }
+  if (result.m_loadUsingRegex(is, progressBar)) {
+    // check for it again here
+    result.addVersionObject();
+    return result;
+  }
+  return boost::none;
+}
+
 OptionalIdfFile IdfFile::load(const path& p, ProgressBar* progressBar) {
   // determine IddFileType
   IddFileType iddType(IddFileType::EnergyPlus);  // default
@@ -357,14 +394,20 @@ OptionalIdfFile IdfFile::load(const path& p, const IddFileType& iddFileType, Pro
   // In fact, don't pass the ext param, skip the entire call to setFileExtension which is pointless since it won't force replace it
   wp = completePathToFile(wp, path(), "", false);
 
-  // try to open file and parse
-  openstudio::filesystem::ifstream inFile(wp);
-  if (inFile) {
-    try {
-      return load(inFile, iddFileType, progressBar);
-    } catch (...) {
-      return boost::none;
+  // try to map file and parse
+  try {
+    IdfFile result(iddFileType);
+    // remove initial version object
+    if (OptionalIdfObject vo = result.versionObject()) {
+      result.removeObject(*vo);
     }
+    if (result.m_load(wp, progressBar)) {
+      // check for it again here
+      result.addVersionObject();
+      return result;
+    }
+  } catch (...) {
+    return boost::none;
   }
 
   return boost::none;
@@ -374,19 +417,40 @@ OptionalIdfFile IdfFile::load(const path& p, const IddFile& iddFile, ProgressBar
   // complete path
   path wp = completePathToFile(p, path(), "idf", false);
 
-  // try to open file and parse
-  openstudio::filesystem::ifstream inFile(wp);
-  if (inFile) {
-    try {
-      return load(inFile, iddFile, progressBar);
-    } catch (...) {
-      return boost::none;
+  // try to map file and parse
+  try {
+    IdfFile result(iddFile);
+    // remove initial version object
+    if (OptionalIdfObject vo = result.versionObject()) {
+      result.removeObject(*vo);
+    }
+    if (result.m_load(wp, progressBar)) {
+      // check for it again here
+      result.addVersionObject();
+      return result;
     }
+  } catch (...) {
+    return boost::none;
   }
 
   return boost::none;
 }
 
+namespace {
+
+  // parse on the calling thread unless asked otherwise, 0 means one per hardware thread
+  std::atomic<unsigned> numIdfLoadThreads{1};
+
+}  // namespace
+
+unsigned IdfFile::numLoadThreads() {
+  return numIdfLoadThreads;
+}
+
+void IdfFile::setNumLoadThreads(unsigned numThreads) {
+  numIdfLoadThreads = numThreads;
+}
+
 boost::optional<VersionString> IdfFile::loadVersionOnly(std::istream& is) {
   boost::optional<VersionString> result;
   IddFile catchallIdd = IddFile::catchallIddFile();
@@ -498,6 +562,259 @@ bool IdfFile::save(const openstudio::path& p, bool overwrite) {
 // SERIALIZATION
 
 bool IdfFile::m_load(std::istream& is, ProgressBar* progressBar, bool versionOnly) {
+  if (versionOnly) {
+    // the version object is near the top of the file, no need to read all of it
+    return m_loadUsingRegex(is, progressBar, versionOnly);
+  }
+
+  std::string text = idfTokenizer::readNormalized(is);
+  return m_loadText(text, progressBar, 1);
+}
+
+bool IdfFile::m_load(const path& p, ProgressBar* progressBar) {
+  unsigned numThreads = numLoadThreads();
+  if (numThreads == 0) {
+    numThreads = std::max(std::thread::hardware_concurrency(), 1u);
+  }
+
+  boost::iostreams::mapped_file_source file;
+  try {
+    file.open(p);
+  } catch (const std::exception&) {
+    // empty files cannot be mapped, and some file systems do not support it
+  }
+
+  if (!file.is_open()) {
+    openstudio::filesystem::ifstream inFile(p);
+    if (!inFile) {
+      return false;
+    }
+    std::string text = idfTokenizer::readNormalized(inFile);
+    return m_loadText(text, progressBar, numThreads);
+  }
+
+  std::string_view text(file.data(), file.size());
+  if (text.find('\r') == std::string_view::npos) {
+    return m_loadText(text, progressBar, numThreads);
+  }
+
+  std::string normalizedText(text);
+  file.close();
+  idfTokenizer::normalizeLineEndings(normalizedText);
+  return m_loadText(normalizedText, progressBar, numThreads);
+}
+
+bool IdfFile::m_loadText(std::string_view text, ProgressBar* progressBar, unsigned numThreads) {
+  try {
+    return m_loadTokenized(text, progressBar, numThreads);
+  } catch (const std::exception& e) {
+    LOG(Warn, "Tokenized parsing failed with '" << e.what() << "'. Reverting to the regex-based parser.");
+  }
+
+  m_header.clear();
+  m_objects.clear();
+  m_versionObjectIndices.clear();
+  std::stringstream ss{std::string(text)};
+  return m_loadUsingRegex(ss, progressBar);
+}
+
+bool IdfFile::m_loadTokenized(std::string_view text, ProgressBar* progressBar, unsigned numThreads) {
+
+  // an object to construct, in file order
+  struct ObjectText
+  {
+    std::string_view text;                             // text of the object, from its preceding comment through the closing ';'
+    IddObject iddObject;                               // type of the object
+    size_t end = 0;                                    // offset of the end of the object in text, for progress
+    std::shared_ptr<detail::IdfObject_Impl> object;    // the parsed object
+  };
+
+  int objectNum = 0;                                  // number of objects, first is #1
+  size_t commentBegin = std::string_view::npos;       // start of running comment
+  bool firstBlock = true;                             // to capture first comment block as the header
+  std::map<std::string, OptionalIddObject, std::less<>> iddObjects;  // IddObjects by object type, as spelled in text
+  std::vector<ObjectText> objectTexts;
+
+  if (progressBar) {
+    progressBar->setMinimum(0);
+    progressBar->setMaximum(static_cast<int>(text.size()));
+  }
+
+  size_t pos = 0;
+  auto getLine = [&text, &pos](std::string_view& line) {
+    if (pos >= text.size()) {
+      return false;
+    }
+    size_t newLine = text.find('\n', pos);
+    size_t end = (newLine == std::string_view::npos) ? text.size() : newLine;
+    line = text.substr(pos, end - pos);
+    pos = (newLine == std::string_view::npos) ? text.size() : newLine + 1;
+    return true;
+  };
+
+  // read the text line by line, every line is one of comment, whitespace, or the start of an object
+  std::string_view line;
+  while (getLine(line)) {
+
+    size_t lineBegin = line.data() - text.data();
+
+    if (idfTokenizer::isCommentOnlyLine(line)) {
+      // continue comment
+      if (commentBegin == std::string_view::npos) {
+        commentBegin = lineBegin;
+      }
+    } else if (idfTokenizer::isWhitespaceOnlyLine(line)) {
+      // end comment
+      std::string_view comment;
+      if (commentBegin != std::string_view::npos) {
+        comment = idfTokenizer::trim(text.substr(commentBegin, lineBegin - commentBegin));
+      }
+
+      if (!comment.empty()) {
+        if (firstBlock) {
+          // set this comment as the header
+          setHeader(std::string(comment));
+          firstBlock = false;
+        } else {
+          // make a comment only object to hold the comment
+          OptionalIddObject commentOnlyIddObject = m_iddFileAndFactoryWrapper.getObject(IddObjectType::CommentOnly);
+          if (!commentOnlyIddObject) {
+            LOG(Error, "IddFile does not contain a CommentOnly object. Will not be able to save comment objects.");
+            continue;
+          }
+
+          std::string commentOnlyText = commentOnlyIddObject->name() + ";";
+          commentOnlyText += comment;
+          std::shared_ptr<detail::IdfObject_Impl> commentOnlyObject = detail::IdfObject_Impl::loadTokenized(commentOnlyText, *commentOnlyIddObject);
+          OS_ASSERT(commentOnlyObject);
+
+          // keep its place in the object list
+          objectTexts.push_back(ObjectText{std::string_view(), *commentOnlyIddObject, pos, commentOnlyObject});
+        }
+      }
+
+      // clear out comment
+      commentBegin = std::string_view::npos;
+
+    } else {
+
+      firstBlock = false;
+
+      // peek at the object type
+      std::string_view objectType;
+      idfTokenizer::LineMatch lineMatch;
+      if (idfTokenizer::line(line, lineMatch)) {
+        objectType = idfTokenizer::trim(lineMatch.content);
+      } else {
+        // can't figure out the object's type
+        LOG(Warn, "Unrecognizable object type '" << line << "'. Defaulting to 'Catchall'.");
+        objectType = "Catchall";
+      }
+
+      // get the corresponding idd object entry
+      auto it = iddObjects.find(objectType);
+      if (it == iddObjects.end()) {
+        it = iddObjects.emplace(std::string(objectType), m_iddFileAndFactoryWrapper.getObject(std::string(objectType))).first;
+      }
+      OptionalIddObject iddObject = it->second;
+      if (!iddObject) {
+        LOG(Warn, "Cannot find object type '" << objectType << "' in Idd. Placing data in Catchall object.");
+        iddObject = IddObject();
+      } else {
+        OS_ASSERT(iddObject->type() != IddObjectType::Catchall);
+      }
+
+      // the text for this object runs from its preceding comment through the line with the
+      // closing ';'
+      size_t objectBegin = (commentBegin == std::string_view::npos) ? lineBegin : commentBegin;
+      commentBegin = std::string_view::npos;
+
+      // continue reading until we have seen the entire object
+      bool foundEndLine = idfTokenizer::isObjectEnd(line);
+      while (!foundEndLine && getLine(line)) {
+        foundEndLine = idfTokenizer::isObjectEnd(line);
+      }
+
+      if (foundEndLine) {
+        objectTexts.push_back(ObjectText{text.substr(objectBegin, pos - objectBegin), *iddObject, pos, nullptr});
+      }
+    }
+  }
+
+  // construct the objects, splitting them between threads in blocks of consecutive objects
+  constexpr size_t blockSize = 64;
+  const size_t numBlocks = (objectTexts.size() + blockSize - 1) / blockSize;
+  std::atomic<size_t> nextBlock{0};
+  auto parseBlocks = [&objectTexts, &nextBlock, numBlocks]() {
+    for (size_t block = nextBlock++; block < numBlocks; block = nextBlock++) {
+      for (size_t i = block * blockSize, n = std::min(i + blockSize, objectTexts.size()); i < n; ++i) {
+        ObjectText& objectText = objectTexts[i];
+        if (!objectText.object) {
+          objectText.object = detail::IdfObject_Impl::loadTokenized(objectText.text, objectText.iddObject);
+        }
+      }
+    }
+  };
+
+  // not worth starting a thread for less than a few blocks
+  numThreads = std::min<size_t>(numThreads, numBlocks / 4);
+  if (numThreads <= 1) {
+    parseBlocks();
+  } else {
+    std::vector<std::exception_ptr> exceptions(numThreads);
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads - 1);
+    auto work = [&parseBlocks, &exceptions](size_t t) {
+      try {
+        parseBlocks();
+      } catch (...) {
+        exceptions[t] = std::current_exception();
+      }
+    };
+    for (unsigned t = 1; t < numThreads; ++t) {
+      threads.emplace_back(work, t);
+    }
+    work(0);
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+    for (const std::exception_ptr& exception : exceptions) {
+      if (exception) {
+        std::rethrow_exception(exception);
+      }
+    }
+  }
+
+  // put them in the object list
+  for (ObjectText& objectText : objectTexts) {
+    if (!objectText.object) {
+      LOG(Error, "Unable to construct IdfObject from text: " << '\n'
+                                                             << objectText.text << '\n'
+                                                             << "Throwing this object out and parsing the remainder of the file.");
+    } else {
+      // a valid Idf object to parse
+      if (objectText.object->iddObject().type() != IddObjectType::Catchall) {
+        ++objectNum;
+      }
+
+      addObject(IdfObject(objectText.object));
+    }
+
+    if (progressBar) {
+      progressBar->setValue(static_cast<int>(objectText.end));
+    }
+  }
+
+  // If we sucessfully parsed at least one object, we return true, otherwise false
+  if (objectNum > 0) {
+    return true;
+  } else {
+    LOG(Error, "Could not parse a single valid object in file.");
+    return false;
+  }
+}
+
+bool IdfFile::m_loadUsingRegex(std::istream& is, ProgressBar* progressBar, bool versionOnly) {
 
   [[maybe_unused]] int lineNum = 0;  // Idf line number
   int objectNum = 0;                 // number of objects, first is #1
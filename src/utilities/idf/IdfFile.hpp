@@ -14,6 +14,7 @@
 #include "../core/Path.hpp"
 
 #include <string>
+#include <string_view>
 #include <ostream>
 #include <vector>
 
@@ -170,6 +171,26 @@ class UTILITIES_API IdfFile
    *  try "idf". */
   static boost::optional<IdfFile> load(const path& p, const IddFile& iddFile, ProgressBar* progressBar = nullptr);
 
+  /** Returns the number of threads used to parse objects when loading an IdfFile from path. The
+   *  default is 1, 0 means one thread per hardware thread. */
+  static unsigned numLoadThreads();
+
+  /** Sets the number of threads used to parse objects when loading an IdfFile from path, for all
+   *  loads in the process (Workspace::load, VersionTranslator, etc.). Objects are always added in
+   *  file order, so this only affects speed. Each load starts its own threads, and messages logged
+   *  while parsing come from them, so they will not reach a LogSink restricted to the calling
+   *  thread. Loading from std::istream always parses on the calling thread. */
+  static void setNumLoadThreads(unsigned numThreads);
+
+  /** Load an IdfFile from std::istream using the IDD defined by IddFactory and iddFileType, with
+   *  the original line-by-line regex parser. The other load methods use a hand-written tokenizer
+   *  that produces the same objects much faster; this one is kept as a reference and fallback. */
+  static boost::optional<IdfFile> loadUsingRegex(std::istream& is, const IddFileType& iddFileType, ProgressBar* progressBar = nullptr);
+
+  /** Load an IdfFile from std::istream using iddFile, with the original line-by-line regex
+   *  parser. */
+  static boost::optional<IdfFile> loadUsingRegex(std::istream& is, const IddFile& iddFile, ProgressBar* progressBar = nullptr);
+
   /** Quick load method that uses the IddFile::catchallIddFile and stops parsing once a version
    *  identifier is found. Used to determine the appropriate IddFile to use for a full load. */
   static boost::optional<VersionString> loadVersionOnly(std::istream& is);
@@ -215,6 +236,19 @@ class UTILITIES_API IdfFile
   /// private load function that uses m_iddFile and m_iddFileType initialized elsewhere
   bool m_load(std::istream& is, ProgressBar* progressBar = nullptr, bool versionOnly = false);
 
+  /// memory maps the file at p and parses it with up to numLoadThreads() threads
+  bool m_load(const path& p, ProgressBar* progressBar = nullptr);
+
+  /// parses text (with '\n' line endings), reverting to the regex-based parser if the tokenizer throws
+  bool m_loadText(std::string_view text, ProgressBar* progressBar, unsigned numThreads);
+
+  /// tokenizes text (with '\n' line endings) in a single pass, then parses the objects on up to
+  /// numThreads threads and adds them in file order
+  bool m_loadTokenized(std::string_view text, ProgressBar* progressBar = nullptr, unsigned numThreads = 1);
+
+  /// original regex-based implementation of m_load, reads is line by line
+  bool m_loadUsingRegex(std::istream& is, ProgressBar* progressBar = nullptr, bool versionOnly = false);
+
   // configure logging
   REGISTER_LOGGER("utilities.idf.IdfFile");
 };
@@ -8,6 +8,7 @@
 
 #include "IdfExtensibleGroup.hpp"
 #include "IdfRegex.hpp"
+#include "IdfTokenizer.hpp"
 #include "ValidityReport.hpp"
 
 #include "../idd/IddKey.hpp"
@@ -47,6 +48,7 @@ namespace detail {
         OS_ASSERT(ok);
       }
     }
+    resizeCachedDoubles();
   }
 
   IdfObject_Impl::IdfObject_Impl(IddObjectType type, bool fastName) : m_handle(openstudio::createUUID()) {
@@ -215,6 +217,9 @@ namespace detail {
 
   boost::optional<double> IdfObject_Impl::getDouble(unsigned index, bool returnDefault) const {
     OptionalDouble result;
+    if (getCachedDouble(index, returnDefault, result)) {
+      return result;
+    }
     OptionalString value = getString(index, returnDefault, false);
     if (value) {
       if (!(istringEqual(*value, "") || istringEqual(*value, "autosize") || istringEqual(*value, "autocalculate"))) {
@@ -235,6 +240,17 @@ namespace detail {
 
   boost::optional<unsigned> IdfObject_Impl::getUnsigned(unsigned index, bool returnDefault) const {
     OptionalUnsigned result;
+    OptionalDouble cached;
+    if (getCachedDouble(index, returnDefault, cached)) {
+      if (cached) {
+        try {
+          result = boost::numeric_cast<unsigned>(*cached);
+        } catch (const std::exception&) {
+          LOG(Error, "Could not convert '" << *cached << "' to unsigned");
+        }
+      }
+      return result;
+    }
     OptionalString value = getString(index, returnDefault, false);
     if (value) {
       if (!(istringEqual(*value, "") || istringEqual(*value, "autosize") || istringEqual(*value, "autocalculate"))) {
@@ -251,6 +267,17 @@ namespace detail {
 
   boost::optional<int> IdfObject_Impl::getInt(unsigned index, bool returnDefault) const {
     OptionalInt result;
+    OptionalDouble cached;
+    if (getCachedDouble(index, returnDefault, cached)) {
+      if (cached) {
+        try {
+          result = boost::numeric_cast<int>(*cached);
+        } catch (const std::exception&) {
+          LOG(Error, "Could not convert '" << *cached << "' to int");
+        }
+      }
+      return result;
+    }
     OptionalString value = getString(index, returnDefault, false);
     if (value) {
       if (!(istringEqual(*value, "") || istringEqual(*value, "autosize") || istringEqual(*value, "autocalculate"))) {
@@ -379,11 +406,13 @@ namespace detail {
       if (i < n) {
         std::string oldName = m_fields[i];
         m_fields[i] = newName;
+        invalidateCachedDouble(i);
         m_diffs.push_back(IdfObjectDiff(i, oldName, newName));
       } else {
         m_fields.push_back(newName);
         m_diffs.push_back(IdfObjectDiff(i, boost::none, newName));
       }
+      nameFieldChanged();
       //return decoded string since we might have made changes to it if its an EMS object.
       newName = decodeString(newName);
       return newName;  // success!
@@ -451,6 +480,7 @@ namespace detail {
 
         // resize fields
         m_fields.resize(n);
+        truncateCachedDoubles(n);
         if (m_fieldComments.size() > n) {
           m_fieldComments.resize(n);
         }
@@ -461,6 +491,7 @@ namespace detail {
       OS_ASSERT(index < m_fields.size());
 
       m_fields[index] = value;
+      invalidateCachedDouble(index);
       m_diffs.emplace_back(index, oldValue, value);
       return result;
     }
@@ -601,6 +632,7 @@ namespace detail {
 
         // resize the fields
         m_fields.resize(n);
+        truncateCachedDoubles(n);
         if (m_fieldComments.size() > n) {
           m_fieldComments.resize(n);
         }
@@ -631,6 +663,7 @@ namespace detail {
 
           // resize the fields
           m_fields.resize(n);
+          truncateCachedDoubles(n);
           if (m_fieldComments.size() > n) {
             m_fieldComments.resize(n);
           }
@@ -787,6 +820,7 @@ namespace detail {
       }
 
       m_fields.resize(numAfterPop);
+      truncateCachedDoubles(numAfterPop);
       if (m_fieldComments.size() > m_fields.size()) {
         m_fieldComments.resize(numAfterPop);
       }
@@ -1216,6 +1250,25 @@ namespace detail {
     return result;
   }
 
+  std::shared_ptr<IdfObject_Impl> IdfObject_Impl::loadTokenized(std::string_view text, const IddObject& iddObject) {
+    std::shared_ptr<IdfObject_Impl> result(new IdfObject_Impl(iddObject, false, true));
+
+    try {
+      result->parseTokenized(text);
+      result->resizeToMinFields();
+    } catch (...) {
+      return nullptr;
+    }
+
+    // same handle as the copy made by load
+    if (result->m_iddObject.hasHandleField()) {
+      OS_ASSERT(!result->m_handle.isNull());
+    } else {
+      result->m_handle = openstudio::createUUID();
+    }
+    return result;
+  }
+
   std::ostream& IdfObject_Impl::print(std::ostream& os) const {
     unsigned n = numFields();
     if (n == 0) {
@@ -1321,6 +1374,8 @@ namespace detail {
       return;
     }
 
+    this->onImmediateChange.nano_emit();
+
     bool nameChange = false;
     bool dataChange = false;
 
@@ -1376,6 +1431,7 @@ namespace detail {
         }
       }
     }
+    resizeCachedDoubles();
   }
 
   void IdfObject_Impl::parse(const std::string& text, bool getIddFromFactory) {
@@ -1547,10 +1603,219 @@ namespace detail {
     }
   }
 
+  void IdfObject_Impl::parseTokenized(std::string_view text) {
+    std::string_view parsedText = text;
+
+    // get preceding comments
+    idfTokenizer::CommentMatch commentMatch;
+    while (idfTokenizer::commentOnlyLine(parsedText, commentMatch)) {
+      if (!commentMatch.comment.empty()) {
+        m_comment += '!';
+        m_comment += commentMatch.comment;
+        m_comment += idfRegex::newLinestring();
+      }
+      parsedText = idfTokenizer::trimLeft(commentMatch.rest);
+    }
+
+    // the first entry will be the object type
+    idfTokenizer::LineMatch lineMatch;
+    if (!idfTokenizer::line(parsedText, lineMatch)) {
+      LOG_AND_THROW("Cannot extract an IdfObject type from text '" << parsedText << "'");
+    }
+
+    std::string_view objectType = idfTokenizer::trim(lineMatch.content);
+    if (!boost::iequals(objectType, m_iddObject.name())) {
+      if (m_iddObject.type() != IddObjectType::Catchall) {
+        LOG(Error, "IdfObject type '" << objectType << "', does not equal its IddObject name '" << m_iddObject.name()
+                                      << "'. Reverting to default Catchall IddObject.");
+      }
+      m_iddObject = IddObject();
+      m_fields.emplace_back(objectType);
+    }
+
+    std::string_view commentOrOtherText = idfTokenizer::trimLeft(lineMatch.rest);
+    if (commentOrOtherText.empty() || (commentOrOtherText.front() == '!')) {
+      m_comment += commentOrOtherText;
+      parsedText = lineMatch.remainder;
+    } else {
+      // more fields on this line, commentOrOtherText runs on into the remainder
+      parsedText = text.substr(commentOrOtherText.data() - text.data());
+    }
+
+    // get trailing comments
+    while (idfTokenizer::commentOnlyLine(parsedText, commentMatch)) {
+      if (!commentMatch.comment.empty()) {
+        m_comment += '!';
+        m_comment += commentMatch.comment;
+        m_comment += idfRegex::newLinestring();
+      }
+      parsedText = idfTokenizer::trimLeft(commentMatch.rest);
+    }
+
+    // remove trailing whitespace and new lines
+    boost::trim_right(m_comment);
+
+    // parse the fields
+    parseFieldsTokenized(parsedText);
+  }
+
+  void IdfObject_Impl::parseFieldsTokenized(std::string_view text) {
+    const IddFieldVector& fields = m_iddObject.nonextensibleFields();
+    const IddFieldVector& extensibleFields = m_iddObject.extensibleGroup();
+
+    // cut down on this text as we parse
+    std::string_view unparsedText = text;
+
+    // current idd field index
+    unsigned iddFieldIndex = 0;
+
+    // parse all the fields
+    idfTokenizer::LineMatch lineMatch;
+    while (idfTokenizer::line(unparsedText, lineMatch)) {
+      std::string_view fieldText = idfTokenizer::trim(lineMatch.content);
+      std::string_view commentOrOtherText = idfTokenizer::trim(lineMatch.rest);
+
+      if (commentOrOtherText.empty() || (commentOrOtherText.front() == '!')) {
+        unparsedText = lineMatch.remainder;
+      } else {
+        // there may be multiple fields on this line
+        unparsedText = text.substr(lineMatch.rest.data() - text.data());
+        commentOrOtherText = std::string_view();
+      }
+
+      // get the idd field
+      const IddField* iddField = nullptr;
+      if (iddFieldIndex < fields.size()) {
+        iddField = &fields[iddFieldIndex];
+      } else if (!extensibleFields.empty()) {
+        iddField = &extensibleFields[(iddFieldIndex - fields.size()) % extensibleFields.size()];
+      }
+
+      if (iddField) {
+
+        // add this to our fields
+        m_fields.emplace_back(fieldText);
+
+        // drop default comments
+        if (!commentOrOtherText.empty() && !idfTokenizer::isEditorCommentWhitespaceOnlyLine(commentOrOtherText)) {
+          m_fieldComments.resize(m_fields.size());
+          m_fieldComments.back() = commentOrOtherText;
+        }
+
+        // keep handle if this is a handle field
+        if (iddField->properties().type == IddFieldType::HandleType) {
+          Handle candidate = toUUID(std::string(fieldText));
+          if (!candidate.isNull()) {
+            m_handle = candidate;
+          }
+        }
+
+      } else {
+        LOG(Error, "IdfObject of type '" << m_iddObject.name() << "' "
+                                         << "cannot have field index of " << iddFieldIndex << ". "
+                                         << "Cutting off IdfObject field parsing here, with the following text "
+                                         << "remaining: " << '\n'
+                                         << fieldText << '\n'
+                                         << unparsedText);
+        return;
+      }
+
+      // increment current idd field index
+      ++iddFieldIndex;
+    }  // while line matches
+
+    unparsedText = idfTokenizer::trim(unparsedText);
+    if (!unparsedText.empty()) {
+      LOG(Warn, "After parsing IdfObject fields, the following text remains unprocessed: " << '\n' << unparsedText);
+    }
+  }
+
   // GETTER AND SETTER HELPERS
 
+  void IdfObject_Impl::nameFieldChanged() {}
+
+  void IdfObject_Impl::truncateCachedDoubles(unsigned size) {
+    if (m_cachedDoubles.size() > size) {
+      m_cachedDoubles.resize(size);
+    }
+  }
+
+  void IdfObject_Impl::resizeCachedDoubles() {
+    m_cachedDoubles.resize(m_fields.size());
+  }
+
+  bool IdfObject_Impl::getCachedDouble(unsigned index, bool returnDefault, boost::optional<double>& result) const {
+    // fields that do not exist yet, or that the setters have not sized the cache for, are left to getString
+    if (index >= m_fields.size() || index >= m_cachedDoubles.size()) {
+      return false;
+    }
+
+    CachedDouble& cached = m_cachedDoubles[index];
+    CachedDouble::State state = cached.state.load(std::memory_order_acquire);
+    double value = 0.0;
+    if (state == CachedDouble::Unparsed) {
+      OptionalIddField iddField = m_iddObject.getField(index);
+      if (!iddField || !((iddField->properties().type == IddFieldType::RealType) || (iddField->properties().type == IddFieldType::IntegerType))) {
+        cached.state.store(CachedDouble::NotCacheable, std::memory_order_release);
+        return false;
+      }
+
+      // same text getString(index, true) would return
+      std::string text = decodeString(m_fields[index]);
+      bool isEmpty = text.empty();
+      if (isEmpty && iddField->properties().stringDefault) {
+        text = decodeString(*(iddField->properties().stringDefault));
+      }
+
+      if (text.empty() || istringEqual(text, "autosize") || istringEqual(text, "autocalculate")) {
+        state = isEmpty ? CachedDouble::Empty : CachedDouble::NotNumeric;
+      } else {
+        try {
+          value = boost::lexical_cast<double>(text);
+          state = isEmpty ? CachedDouble::EmptyWithDefault : CachedDouble::Numeric;
+        } catch (const std::exception&) {
+          // not cached, so that every call logs the error
+          return false;
+        }
+      }
+      cached.value.store(value, std::memory_order_relaxed);
+      cached.state.store(state, std::memory_order_release);
+    } else {
+      value = cached.value.load(std::memory_order_relaxed);
+    }
+
+    switch (state) {
+      case CachedDouble::NotCacheable:
+        return false;
+      case CachedDouble::Numeric:
+        result = value;
+        break;
+      case CachedDouble::EmptyWithDefault:
+        if (returnDefault) {
+          result = value;
+        } else {
+          result.reset();
+        }
+        break;
+      default:
+        result.reset();
+        break;
+    }
+    return true;
+  }
+
+  void IdfObject_Impl::invalidateCachedDouble(unsigned index) {
+    if (index < m_cachedDoubles.size()) {
+      m_cachedDoubles[index].state.store(CachedDouble::Unparsed, std::memory_order_relaxed);
+    } else if (index < m_fields.size()) {
+      resizeCachedDoubles();
+    }
+  }
+
   bool IdfObject_Impl::setIddObject(const IddObject& iddObject) {
     m_iddObject = iddObject;
+    // field types and defaults may have changed
+    m_cachedDoubles.clear();
     if (m_fields.size() < minFields()) {
       m_fields.resize(minFields());
     } else {
@@ -1565,6 +1830,7 @@ namespace detail {
         }
       }
     }
+    resizeCachedDoubles();
     return true;
   }
 
@@ -17,7 +17,9 @@
 
 #include <boost/optional.hpp>
 
+#include <atomic>
 #include <string>
+#include <string_view>
 #include <ostream>
 #include <vector>
 
@@ -36,7 +38,8 @@ class OSOptionalQuantity;
 // private namespace
 namespace detail {
 
-  /** Implementation of IdfObject. */
+  /** Implementation of IdfObject. Const getters, including getDouble, getInt and getUnsigned,
+   *  may be called on one object from several threads at once. Setters need exclusive access. */
   class UTILITIES_API IdfObject_Impl
     : public std::enable_shared_from_this<IdfObject_Impl>
     , public Nano::Observer
@@ -313,6 +316,11 @@ namespace detail {
      *  be invalid at enums::Strictness level None.) */
     static std::shared_ptr<IdfObject_Impl> load(const std::string& text, const IddObject& iddObject);
 
+    /** Constructor from text and an explicit iddObject that scans text directly rather than
+     *  going through idfRegex. Gives the same result as load(text, iddObject), and is used by
+     *  IdfFile to parse objects in place. */
+    static std::shared_ptr<IdfObject_Impl> loadTokenized(std::string_view text, const IddObject& iddObject);
+
     /** Serialize this object to os as Idf text. */
     std::ostream& print(std::ostream& os) const;
 
@@ -352,6 +360,10 @@ namespace detail {
     // Emitted on any change--any field, any comment.
     Nano::Signal<void()> onChange;
 
+    // Emitted on any change as soon as it is made, unlike onChange it is not held back by a
+    // Workspace::BatchEdit. For state an object derives from its own fields, e.g. cached geometry.
+    Nano::Signal<void()> onImmediateChange;
+
     // Emitted if name field changed.
     Nano::Signal<void()> onNameChange;
 
@@ -399,9 +411,53 @@ namespace detail {
 
     virtual bool fieldIsNonnullIfRequired(unsigned index) const;
 
+    // SETTER HELPERS
+
+    /** Called right after the name field is set, before any signals are emitted. */
+    virtual void nameFieldChanged();
+
+    /** Drops the cached numeric values of fields at or past size. Must be called whenever
+     *  m_fields shrinks. */
+    void truncateCachedDoubles(unsigned size);
+
+    /** Sizes the cached numeric values like m_fields, new fields are unparsed. Fields past the
+     *  cache are still read correctly, just without the cache. */
+    void resizeCachedDoubles();
+
    private:
     IdfObject_Impl() = default;
 
+    // Parsed value of a numeric field, so getDouble, getInt and getUnsigned do not parse the
+    // same text over and over.
+    struct CachedDouble
+    {
+      enum State : unsigned char
+      {
+        Unparsed,
+        NotCacheable,      // not a real or integer field
+        NotNumeric,        // autosize, autocalculate
+        Numeric,           // value holds the field value
+        Empty,             // empty, no numeric default
+        EmptyWithDefault,  // empty, value holds the default
+      };
+
+      CachedDouble() = default;
+
+      // only copied when the vector is resized, which setters do with exclusive access
+      CachedDouble(const CachedDouble& other) noexcept
+        : value(other.value.load(std::memory_order_relaxed)), state(other.state.load(std::memory_order_relaxed)) {}
+
+      CachedDouble& operator=(const CachedDouble&) = delete;
+
+      // readers that parse the same field concurrently store the same value, state is published last
+      std::atomic<double> value{0.0};
+      std::atomic<State> state{Unparsed};
+    };
+
+    // Sized by the setters, indexed like m_fields but never longer, filled lazily by the const getters.
+    // Invalidated by every setter.
+    mutable std::vector<CachedDouble> m_cachedDoubles;
+
     // CONSTRUCTION HELPERS
 
     /** Minimal constructor from iddObject for use by IdfObject_Impl::load. */
@@ -419,8 +475,22 @@ namespace detail {
     // parse fields
     void parseFields(const std::string& text);
 
+    /* Equivalent of parse(text, false) implemented with idfTokenizer. */
+    void parseTokenized(std::string_view text);
+
+    // parse fields with idfTokenizer
+    void parseFieldsTokenized(std::string_view text);
+
     // GETTER AND SETTER HELPERS
 
+    /** If field index is a real or integer field whose text is a number, autosize, autocalculate
+     *  or empty, sets result as getDouble would and returns true, parsing the text only the first
+     *  time. Otherwise returns false and getDouble has to go through getString. */
+    bool getCachedDouble(unsigned index, bool returnDefault, boost::optional<double>& result) const;
+
+    /** Marks field index as changed, growing the cache to cover it. */
+    void invalidateCachedDouble(unsigned index);
+
     /** Set this object's IddObject to iddObject. */
     bool setIddObject(const IddObject& iddObject);
 
@@ -0,0 +1,167 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include "IdfTokenizer.hpp"
+
+#include <algorithm>
+#include <istream>
+#include <iterator>
+
+namespace openstudio {
+namespace idfTokenizer {
+
+  std::string_view trimLeft(std::string_view text) {
+    size_t i = 0;
+    while ((i < text.size()) && isSpace(text[i])) {
+      ++i;
+    }
+    return text.substr(i);
+  }
+
+  std::string_view trimRight(std::string_view text) {
+    size_t n = text.size();
+    while ((n > 0) && isSpace(text[n - 1])) {
+      --n;
+    }
+    return text.substr(0, n);
+  }
+
+  std::string_view trim(std::string_view text) {
+    return trimRight(trimLeft(text));
+  }
+
+  // "^[\\s\\t]*[!]([^\\n]*)[\\n]?(.*)", where '.' also matches new lines
+  bool commentOnlyLine(std::string_view text, CommentMatch& match) {
+    std::string_view candidate = trimLeft(text);
+    if (candidate.empty() || (candidate.front() != '!')) {
+      return false;
+    }
+    size_t newLine = candidate.find('\n');
+    if (newLine == std::string_view::npos) {
+      match.comment = candidate.substr(1);
+      match.rest = candidate.substr(candidate.size());
+    } else {
+      match.comment = candidate.substr(1, newLine - 1);
+      match.rest = candidate.substr(newLine + 1);
+    }
+    return true;
+  }
+
+  bool isCommentOnlyLine(std::string_view line) {
+    std::string_view candidate = trimLeft(line);
+    return (!candidate.empty() && (candidate.front() == '!'));
+  }
+
+  // "^([^!]*?)[,;]([^\\n]*[\\n]?)(.*)", where '^' matches at the beginning of text and after
+  // every new line
+  bool line(std::string_view text, LineMatch& match) {
+    size_t start = 0;
+    while (start < text.size()) {
+      size_t separator = text.find_first_of("!,;", start);
+      if (separator == std::string_view::npos) {
+        return false;
+      }
+      if (text[separator] == '!') {
+        // no match starting on this line, try the next one
+        size_t newLine = text.find('\n', separator);
+        if (newLine == std::string_view::npos) {
+          return false;
+        }
+        start = newLine + 1;
+        continue;
+      }
+      size_t newLine = text.find('\n', separator);
+      size_t restEnd = (newLine == std::string_view::npos) ? text.size() : newLine + 1;
+      match.content = text.substr(start, separator - start);
+      match.rest = text.substr(separator + 1, restEnd - separator - 1);
+      match.remainder = text.substr(restEnd);
+      return true;
+    }
+    return false;
+  }
+
+  // "^[^!]*?[;].*"
+  bool isObjectEnd(std::string_view line) {
+    size_t separator = line.find_first_of("!;");
+    return ((separator != std::string_view::npos) && (line[separator] == ';'));
+  }
+
+  // "^[\\h]*$"
+  bool isWhitespaceOnlyLine(std::string_view line) {
+    return std::all_of(line.begin(), line.end(), isBlank);
+  }
+
+  // "^[\\h]*(?:!-([^\\n\\r\\v]*))?$"
+  bool isEditorCommentWhitespaceOnlyLine(std::string_view comment) {
+    size_t i = 0;
+    while ((i < comment.size()) && isBlank(comment[i])) {
+      ++i;
+    }
+    if (i == comment.size()) {
+      return true;
+    }
+    if (comment.substr(i, 2) != "!-") {
+      return false;
+    }
+    return (comment.find_first_of("\n\r\v", i + 2) == std::string_view::npos);
+  }
+
+  // ".*[vV]ersion.*"
+  bool isVersionObjectName(std::string_view name) {
+    size_t pos = name.find("ersion");
+    while (pos != std::string_view::npos) {
+      if ((pos > 0) && ((name[pos - 1] == 'v') || (name[pos - 1] == 'V'))) {
+        return true;
+      }
+      pos = name.find("ersion", pos + 1);
+    }
+    return false;
+  }
+
+  void normalizeLineEndings(std::string& text) {
+    // nothing to do for most files
+    size_t pos = text.find('\r');
+    if (pos == std::string::npos) {
+      return;
+    }
+    size_t out = pos;
+    for (size_t n = text.size(); pos < n; ++pos) {
+      if (text[pos] == '\r') {
+        text[out++] = '\n';
+        if ((pos + 1 < n) && (text[pos + 1] == '\n')) {
+          ++pos;
+        }
+      } else {
+        text[out++] = text[pos];
+      }
+    }
+    text.resize(out);
+  }
+
+  std::string readNormalized(std::istream& is) {
+    std::string result;
+
+    // read in one go if the stream lets us know its size
+    std::streampos begin = is.tellg();
+    if ((begin != std::streampos(-1)) && is.seekg(0, std::ios_base::end)) {
+      std::streampos end = is.tellg();
+      is.seekg(begin);
+      if (end > begin) {
+        result.resize(static_cast<size_t>(end - begin));
+        is.read(&result[0], static_cast<std::streamsize>(result.size()));
+        result.resize(static_cast<size_t>(is.gcount()));
+      }
+    } else {
+      is.clear();
+      result.assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+    }
+
+    normalizeLineEndings(result);
+
+    return result;
+  }
+
+}  // namespace idfTokenizer
+}  // namespace openstudio
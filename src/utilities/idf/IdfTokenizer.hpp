@@ -0,0 +1,90 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_IDF_IDFTOKENIZER_HPP
+#define UTILITIES_IDF_IDFTOKENIZER_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include <iosfwd>
+#include <string>
+#include <string_view>
+
+namespace openstudio {
+namespace idfTokenizer {
+
+  // Hand-written equivalents of the idfRegex and commentRegex patterns used to load IdfFiles.
+  // Each function documents the pattern it replaces, and is expected to give exactly the same
+  // result as boost::regex on the same ('\n'-delimited) text. Results are views into the input.
+
+  // The \s character class (also std::isspace in the "C" locale)
+  inline bool isSpace(char c) {
+    return (c == ' ') || (c == '\t') || (c == '\n') || (c == '\v') || (c == '\f') || (c == '\r');
+  }
+
+  // The \h character class
+  inline bool isBlank(char c) {
+    return (c == ' ') || (c == '\t');
+  }
+
+  // Equivalents of boost::trim_left, boost::trim_right and boost::trim
+  UTILITIES_API std::string_view trimLeft(std::string_view text);
+  UTILITIES_API std::string_view trimRight(std::string_view text);
+  UTILITIES_API std::string_view trim(std::string_view text);
+
+  // Result of commentOnlyLine
+  // comment, the comment (matches[1])
+  // rest, after new line (matches[2])
+  struct CommentMatch
+  {
+    std::string_view comment;
+    std::string_view rest;
+  };
+
+  // Equivalent of boost::regex_match(text, idfRegex::commentOnlyLine()) followed by
+  // boost::regex_search(text, matches, idfRegex::commentOnlyLine())
+  UTILITIES_API bool commentOnlyLine(std::string_view text, CommentMatch& match);
+
+  // Equivalent of boost::regex_match(line, idfRegex::commentOnlyLine()) for a single line
+  UTILITIES_API bool isCommentOnlyLine(std::string_view line);
+
+  // Result of line
+  // content, before separator (matches[1])
+  // rest, after separator and up to and including new line (matches[2])
+  // remainder, after new line (matches[3])
+  struct LineMatch
+  {
+    std::string_view content;
+    std::string_view rest;
+    std::string_view remainder;
+  };
+
+  // Equivalent of boost::regex_search(text, matches, idfRegex::line()), that is, finds the first
+  // line start (or the beginning of text) followed by a ',' or a ';' that is not preceded by '!'
+  UTILITIES_API bool line(std::string_view text, LineMatch& match);
+
+  // Equivalent of boost::regex_match(line, idfRegex::objectEnd())
+  UTILITIES_API bool isObjectEnd(std::string_view line);
+
+  // Equivalent of boost::regex_match(line, commentRegex::whitespaceOnlyLine())
+  UTILITIES_API bool isWhitespaceOnlyLine(std::string_view line);
+
+  // Equivalent of boost::regex_match(comment, commentRegex::editorCommentWhitespaceOnlyLine())
+  UTILITIES_API bool isEditorCommentWhitespaceOnlyLine(std::string_view comment);
+
+  // Equivalent of boost::regex_match(name, iddRegex::versionObjectName())
+  UTILITIES_API bool isVersionObjectName(std::string_view name);
+
+  // Converts "\r\n" and lone '\r' to '\n' in place (as the boost::iostreams::newline_filter
+  // used by the regex-based loader does)
+  UTILITIES_API void normalizeLineEndings(std::string& text);
+
+  // Copies the content of is into a string, then calls normalizeLineEndings
+  UTILITIES_API std::string readNormalized(std::istream& is);
+
+}  // namespace idfTokenizer
+}  // namespace openstudio
+
+#endif  //UTILITIES_IDF_IDFTOKENIZER_HPP
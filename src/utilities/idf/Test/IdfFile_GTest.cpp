@@ -74,6 +74,105 @@ TEST_F(IdfFixture, IdfFile_Header) {
   file.setHeader(header);
   EXPECT_EQ("! Multi-line \n! Non-comment.", file.header());
 }
+
+TEST_F(IdfFixture, IdfFile_TokenizedLoadMatchesRegex) {
+  std::vector<std::pair<openstudio::path, IddFileType>> testCases{
+    {resourcesPath() / toPath("energyplus/5ZoneAirCooled/in.idf"), IddFileType::EnergyPlus},
+    {resourcesPath() / toPath("energyplus/Daylighting_School/in.idf"), IddFileType::EnergyPlus},
+    {resourcesPath() / toPath("model/offset_tests.osm"), IddFileType::OpenStudio},
+  };
+
+  for (const auto& [p, iddFileType] : testCases) {
+    openstudio::filesystem::ifstream tokenizedFile(p);
+    OptionalIdfFile tokenized = IdfFile::load(tokenizedFile, iddFileType);
+    openstudio::filesystem::ifstream regexFile(p);
+    OptionalIdfFile regex = IdfFile::loadUsingRegex(regexFile, iddFileType);
+    ASSERT_TRUE(tokenized) << toString(p);
+    ASSERT_TRUE(regex) << toString(p);
+
+    EXPECT_EQ(regex->header(), tokenized->header());
+    ASSERT_EQ(regex->objects().size(), tokenized->objects().size());
+    std::stringstream tokenizedText;
+    tokenized->print(tokenizedText);
+    std::stringstream regexText;
+    regex->print(regexText);
+    EXPECT_EQ(regexText.str(), tokenizedText.str()) << toString(p);
+  }
+
+  // comments, multiple fields per line and mixed line endings
+  std::string text = "! Header\r\n\r\n! A comment object\n\n! Zone comment\r\nZone, !- type comment\n  ! interior comment\n  Zone 1,0,0;\n"
+                     "\nBuilding,\r  Building 1, ! my building\n  0;                       !- North Axis {deg}\n";
+  std::stringstream tokenizedStream(text);
+  OptionalIdfFile tokenized = IdfFile::load(tokenizedStream, IddFileType::EnergyPlus);
+  std::stringstream regexStream(text);
+  OptionalIdfFile regex = IdfFile::loadUsingRegex(regexStream, IddFileType::EnergyPlus);
+  ASSERT_TRUE(tokenized);
+  ASSERT_TRUE(regex);
+  EXPECT_EQ("! Header", tokenized->header());
+  ASSERT_EQ(3u, tokenized->objects().size());
+  std::stringstream tokenizedText;
+  tokenized->print(tokenizedText);
+  std::stringstream regexText;
+  regex->print(regexText);
+  EXPECT_EQ(regexText.str(), tokenizedText.str());
+}
+
+TEST_F(IdfFixture, IdfFile_ParallelLoadMatchesSerial) {
+  // write one file with Windows line endings, which cannot be parsed straight from the mapped file
+  openstudio::path crlfPath = toPath("./IdfFile_ParallelLoad_CRLF.idf");
+  {
+    openstudio::filesystem::ifstream inFile(resourcesPath() / toPath("energyplus/5ZoneAirCooled/in.idf"));
+    openstudio::filesystem::ofstream outFile(crlfPath, std::ios_base::binary);
+    std::string line;
+    while (std::getline(inFile, line)) {
+      outFile << line << "\r\n";
+    }
+  }
+
+  std::vector<openstudio::path> testCases{
+    resourcesPath() / toPath("energyplus/HospitalBaseline/in.idf"),
+    resourcesPath() / toPath("model/offset_tests.osm"),
+    crlfPath,
+  };
+
+  EXPECT_EQ(1u, IdfFile::numLoadThreads());
+  for (const openstudio::path& p : testCases) {
+    OptionalIdfFile serial = IdfFile::load(p);
+    IdfFile::setNumLoadThreads(4);
+    OptionalIdfFile parallel = IdfFile::load(p);
+    IdfFile::setNumLoadThreads(1);
+    ASSERT_TRUE(serial) << toString(p);
+    ASSERT_TRUE(parallel) << toString(p);
+
+    EXPECT_EQ(serial->header(), parallel->header());
+    std::vector<IdfObject> serialObjects = serial->objects();
+    std::vector<IdfObject> parallelObjects = parallel->objects();
+    ASSERT_EQ(serialObjects.size(), parallelObjects.size());
+    for (size_t i = 0; i < serialObjects.size(); ++i) {
+      EXPECT_EQ(serialObjects[i].iddObject().type(), parallelObjects[i].iddObject().type());
+      if (serialObjects[i].iddObject().hasHandleField()) {
+        EXPECT_EQ(serialObjects[i].handle(), parallelObjects[i].handle());
+      }
+    }
+    std::stringstream serialText;
+    serial->print(serialText);
+    std::stringstream parallelText;
+    parallel->print(parallelText);
+    EXPECT_EQ(serialText.str(), parallelText.str()) << toString(p);
+  }
+
+  // same objects as loading the original through a stream
+  openstudio::filesystem::ifstream inFile(resourcesPath() / toPath("energyplus/5ZoneAirCooled/in.idf"));
+  OptionalIdfFile streamed = IdfFile::load(inFile, IddFileType::EnergyPlus);
+  OptionalIdfFile mapped = IdfFile::load(crlfPath);
+  ASSERT_TRUE(streamed);
+  ASSERT_TRUE(mapped);
+  std::stringstream streamedText;
+  streamed->print(streamedText);
+  std::stringstream mappedText;
+  mapped->print(mappedText);
+  EXPECT_EQ(streamedText.str(), mappedText.str());
+}
 /*
 TEST_F(IdfFixture, IdfFile_UnixLineEndings) {
   OptionalIdfFile oFile = IdfFile::load(resourcesPath()/toPath("utilities/Idf/UnixLineEndingTest.idf"));
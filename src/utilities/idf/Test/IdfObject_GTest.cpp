@@ -28,6 +28,7 @@
 #include <boost/lexical_cast.hpp>
 
 #include <limits>
+#include <thread>
 #include <type_traits>
 #include <sstream>
 
@@ -545,6 +546,86 @@ TEST_F(IdfFixture, IdfObject_IntFieldGetterWithReturnDefaultOption) {
   EXPECT_TRUE(object.getInt(5));
 }
 
+TEST_F(IdfFixture, IdfObject_NumericFieldGettersAfterChanges) {
+  // numeric getters parse each field once, make sure every kind of change is seen
+  IdfObject object(IddObjectType::Building);
+  EXPECT_FALSE(object.getDouble(1));
+  ASSERT_TRUE(object.getDouble(1, true));
+  EXPECT_DOUBLE_EQ(0.0, object.getDouble(1, true).get());
+  ASSERT_TRUE(object.getInt(6, true));
+  EXPECT_EQ(25, object.getInt(6, true).get());
+
+  EXPECT_TRUE(object.setDouble(1, 30.0));
+  ASSERT_TRUE(object.getDouble(1));
+  EXPECT_DOUBLE_EQ(30.0, object.getDouble(1).get());
+  EXPECT_TRUE(object.setString(1, "45.5"));
+  ASSERT_TRUE(object.getDouble(1, true));
+  EXPECT_DOUBLE_EQ(45.5, object.getDouble(1, true).get());
+  ASSERT_TRUE(object.getInt(1));
+  EXPECT_EQ(45, object.getInt(1).get());
+  EXPECT_TRUE(object.setString(1, ""));
+  EXPECT_FALSE(object.getDouble(1));
+  ASSERT_TRUE(object.getDouble(1, true));
+  EXPECT_DOUBLE_EQ(0.0, object.getDouble(1, true).get());
+
+  // not numbers
+  EXPECT_TRUE(object.setString(6, "autosize"));
+  EXPECT_FALSE(object.getInt(6));
+  EXPECT_FALSE(object.getInt(6, true));
+  EXPECT_TRUE(object.setString(6, "-3"));
+  ASSERT_TRUE(object.getInt(6));
+  EXPECT_EQ(-3, object.getInt(6).get());
+  EXPECT_FALSE(object.getUnsigned(6));
+  EXPECT_TRUE(object.setString(6, "not a number"));
+  EXPECT_FALSE(object.getDouble(6));
+  EXPECT_FALSE(object.getDouble(6));
+
+  // fields that are popped and pushed again
+  object = IdfObject(IddObjectType::BuildingSurface_Detailed);
+  EXPECT_FALSE(object.pushExtensibleGroup({"1.0", "2.0", "3.0"}).empty());
+  unsigned index = object.numFields() - 1;
+  ASSERT_TRUE(object.getDouble(index));
+  EXPECT_DOUBLE_EQ(3.0, object.getDouble(index).get());
+  EXPECT_FALSE(object.popExtensibleGroup().empty());
+  EXPECT_FALSE(object.getDouble(index));
+  EXPECT_FALSE(object.pushExtensibleGroup().empty());
+  EXPECT_FALSE(object.getDouble(index));
+  EXPECT_FALSE(object.popExtensibleGroup().empty());
+  EXPECT_FALSE(object.pushExtensibleGroup({"4.0", "5.0", "6.0"}).empty());
+  ASSERT_TRUE(object.getDouble(index));
+  EXPECT_DOUBLE_EQ(6.0, object.getDouble(index).get());
+
+  // inserting a group shifts the values
+  EXPECT_FALSE(object.insertExtensibleGroup(0, {"7.0", "8.0", "9.0"}).empty());
+  ASSERT_TRUE(object.getDouble(index));
+  EXPECT_DOUBLE_EQ(9.0, object.getDouble(index).get());
+  ASSERT_TRUE(object.getDouble(index + 3));
+  EXPECT_DOUBLE_EQ(6.0, object.getDouble(index + 3).get());
+}
+
+TEST_F(IdfFixture, IdfObject_NumericFieldGettersConcurrentReads) {
+  // const getters fill the cache of a freshly loaded object from several threads at once
+  OptionalIdfObject object = IdfObject::load("Building, Building 1, 30.0, , 0.04, 0.4, , 25, 6;");
+  ASSERT_TRUE(object);
+  std::vector<std::thread> threads;
+  std::vector<int> numCorrect(4, 0);
+  for (unsigned t = 0; t < numCorrect.size(); ++t) {
+    threads.emplace_back([&object, &numCorrect, t]() {
+      for (unsigned i = 0; i < 100; ++i) {
+        if ((object->getDouble(1) == 30.0) && (object->getDouble(3) == 0.04) && (object->getInt(6) == 25) && (object->getUnsigned(7) == 6u)) {
+          ++numCorrect[t];
+        }
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  for (int n : numCorrect) {
+    EXPECT_EQ(100, n);
+  }
+}
+
 TEST_F(IdfFixture, IdfObject_FieldSettingWithHiddenPushes) {
   std::stringstream text;
   OptionalIdfObject oObj;
@@ -0,0 +1,76 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "IdfFixture.hpp"
+
+#include "../IdfTokenizer.hpp"
+#include "../IdfRegex.hpp"
+#include "../../idd/CommentRegex.hpp"
+#include "../../idd/IddRegex.hpp"
+
+#include <sstream>
+
+using namespace openstudio;
+
+TEST_F(IdfFixture, IdfTokenizer_MatchesRegexOnLines) {
+  std::vector<std::string> lines{"",
+                                 "  ",
+                                 " \t ",
+                                 "\v",
+                                 "! comment",
+                                 "   !- Editor comment",
+                                 " \f! comment after form feed",
+                                 "Zone,",
+                                 "  Zone 1;                 !- Name",
+                                 "  1, 2, 3;  !- X,Y,Z",
+                                 "  Name ! not a separator, really",
+                                 "Version,9.6;",
+                                 "  a ! b; c",
+                                 "  a; ! b, c"};
+
+  for (const std::string& line : lines) {
+    EXPECT_EQ(boost::regex_match(line, idfRegex::commentOnlyLine()), idfTokenizer::isCommentOnlyLine(line)) << "'" << line << "'";
+    EXPECT_EQ(boost::regex_match(line, commentRegex::whitespaceOnlyLine()), idfTokenizer::isWhitespaceOnlyLine(line)) << "'" << line << "'";
+    EXPECT_EQ(boost::regex_match(line, idfRegex::objectEnd()), idfTokenizer::isObjectEnd(line)) << "'" << line << "'";
+    EXPECT_EQ(boost::regex_match(line, commentRegex::editorCommentWhitespaceOnlyLine()), idfTokenizer::isEditorCommentWhitespaceOnlyLine(line))
+      << "'" << line << "'";
+    EXPECT_EQ(boost::regex_match(line, iddRegex::versionObjectName()), idfTokenizer::isVersionObjectName(line)) << "'" << line << "'";
+  }
+}
+
+TEST_F(IdfFixture, IdfTokenizer_MatchesRegexOnText) {
+  std::vector<std::string> texts{"\n! comment one\n  ! comment two\nZone,\n  Zone 1;  !- Name\n",
+                                 "Zone,  !- type comment\n\n  ! interior comment\n  Zone 1,\n  0;\n",
+                                 "Foo ! x, y\n  a,\n b;\n",
+                                 "  1,2,3;  !- last field",
+                                 "no separators at all\n",
+                                 "! only a comment"};
+
+  for (const std::string& text : texts) {
+    boost::smatch matches;
+    idfTokenizer::LineMatch lineMatch;
+    bool found = boost::regex_search(text, matches, idfRegex::line());
+    ASSERT_EQ(found, idfTokenizer::line(text, lineMatch)) << text;
+    if (found) {
+      EXPECT_EQ(std::string(matches[1].first, matches[1].second), std::string(lineMatch.content));
+      EXPECT_EQ(std::string(matches[2].first, matches[2].second), std::string(lineMatch.rest));
+      EXPECT_EQ(std::string(matches[3].first, matches[3].second), std::string(lineMatch.remainder));
+    }
+
+    idfTokenizer::CommentMatch commentMatch;
+    found = boost::regex_match(text, idfRegex::commentOnlyLine()) && boost::regex_search(text, matches, idfRegex::commentOnlyLine());
+    ASSERT_EQ(found, idfTokenizer::commentOnlyLine(text, commentMatch)) << text;
+    if (found) {
+      EXPECT_EQ(std::string(matches[1].first, matches[1].second), std::string(commentMatch.comment));
+      EXPECT_EQ(std::string(matches[2].first, matches[2].second), std::string(commentMatch.rest));
+    }
+  }
+}
+
+TEST_F(IdfFixture, IdfTokenizer_ReadNormalized) {
+  std::stringstream ss("a\r\nb\rc\n\r\nd\r");
+  EXPECT_EQ("a\nb\nc\n\nd\n", idfTokenizer::readNormalized(ss));
+}
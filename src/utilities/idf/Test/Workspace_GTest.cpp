@@ -31,6 +31,7 @@
 #include <utilities/idd/Sizing_Zone_FieldEnums.hxx>
 #include <utilities/idd/OS_WeatherFile_FieldEnums.hxx>
 #include "../WorkspaceWatcher.hpp"
+#include "../WorkspaceObjectWatcher.hpp"
 #include "IdfTestQObjects.hpp"
 
 #include "../../core/Path.hpp"
@@ -1931,6 +1932,159 @@ TEST_F(IdfFixture, Workspace_Swap) {
   EXPECT_EQ(IddObjectType(IddObjectType::OS_Building), ws2.objects()[0].iddObject().type());
 }
 
+namespace {
+
+struct WorkspaceChangeCounter : public WorkspaceWatcher
+{
+  explicit WorkspaceChangeCounter(const Workspace& workspace) : WorkspaceWatcher(workspace) {}
+
+  virtual void onChangeWorkspace() override {
+    ++numChanges;
+  }
+
+  unsigned numChanges = 0;
+};
+
+struct RelationshipChangeCounter : public WorkspaceObjectWatcher
+{
+  explicit RelationshipChangeCounter(const WorkspaceObject& object) : WorkspaceObjectWatcher(object) {}
+
+  virtual void onRelationshipChange(int /*index*/, Handle newHandle, Handle oldHandle) override {
+    ++numRelationshipChanges;
+    lastNewHandle = newHandle;
+    lastOldHandle = oldHandle;
+  }
+
+  unsigned numRelationshipChanges = 0;
+  Handle lastNewHandle;
+  Handle lastOldHandle;
+};
+
+std::vector<WorkspaceObject> sortedByName(std::vector<WorkspaceObject> objects) {
+  std::sort(objects.begin(), objects.end(), [](const WorkspaceObject& a, const WorkspaceObject& b) { return a.nameString() < b.nameString(); });
+  return objects;
+}
+
+// points every Lights at the first zone, then at the last one, and changes its lighting level
+void repointLights(Workspace& workspace) {
+  WorkspaceObjectVector zones = sortedByName(workspace.getObjectsByType(IddObjectType::Zone));
+  for (WorkspaceObject& lights : workspace.getObjectsByType(IddObjectType::Lights)) {
+    EXPECT_TRUE(lights.setPointer(LightsFields::ZoneorZoneListorSpaceorSpaceListName, zones.front().handle()));
+    EXPECT_TRUE(lights.setPointer(LightsFields::ZoneorZoneListorSpaceorSpaceListName, zones.back().handle()));
+    EXPECT_TRUE(lights.setDouble(LightsFields::LightingLevel, 1000.0));
+  }
+}
+
+}  // namespace
+
+TEST_F(IdfFixture, Workspace_BatchEdit) {
+  Workspace eagerWorkspace(epIdfFile, StrictnessLevel::Draft);
+  WorkspaceChangeCounter eagerCounter(eagerWorkspace);
+  repointLights(eagerWorkspace);
+  ASSERT_EQ(5u, eagerWorkspace.getObjectsByType(IddObjectType::Lights).size());
+  EXPECT_EQ(15u, eagerCounter.numChanges);
+
+  Workspace batchWorkspace(epIdfFile, StrictnessLevel::Draft);
+  WorkspaceChangeCounter batchCounter(batchWorkspace);
+  WorkspaceObjectVector zones = sortedByName(batchWorkspace.getObjectsByType(IddObjectType::Zone));
+  WorkspaceObject lights = sortedByName(batchWorkspace.getObjectsByType(IddObjectType::Lights)).front();
+  ASSERT_TRUE(lights.getTarget(LightsFields::ZoneorZoneListorSpaceorSpaceListName));
+  Handle originalZoneHandle = lights.getTarget(LightsFields::ZoneorZoneListorSpaceorSpaceListName)->handle();
+  RelationshipChangeCounter relationshipCounter(lights);
+  {
+    Workspace::BatchEdit batchEdit(batchWorkspace);
+    EXPECT_TRUE(batchWorkspace.inBatchEdit());
+    repointLights(batchWorkspace);
+
+    // pointers and reverse pointers are up to date, the signals are held back
+    ASSERT_TRUE(lights.getTarget(LightsFields::ZoneorZoneListorSpaceorSpaceListName));
+    EXPECT_EQ(zones.back(), lights.getTarget(LightsFields::ZoneorZoneListorSpaceorSpaceListName).get());
+    EXPECT_EQ(5u, zones.back().getSources(IddObjectType::Lights).size());
+    EXPECT_EQ(0u, batchCounter.numChanges);
+    EXPECT_FALSE(batchCounter.dirty());
+    EXPECT_EQ(0u, relationshipCounter.numRelationshipChanges);
+    EXPECT_FALSE(relationshipCounter.dirty());
+  }
+  EXPECT_FALSE(batchWorkspace.inBatchEdit());
+  EXPECT_EQ(1u, batchCounter.numChanges);
+  EXPECT_TRUE(batchCounter.dirty());
+  EXPECT_EQ(1u, relationshipCounter.numRelationshipChanges);
+  EXPECT_EQ(originalZoneHandle, relationshipCounter.lastOldHandle);
+  EXPECT_EQ(zones.back().handle(), relationshipCounter.lastNewHandle);
+  EXPECT_TRUE(relationshipCounter.dataChanged());
+
+  // same end state as without the batch edit
+  std::stringstream eagerText;
+  eagerText << eagerWorkspace.toIdfFile();
+  std::stringstream batchText;
+  batchText << batchWorkspace.toIdfFile();
+  EXPECT_EQ(eagerText.str(), batchText.str());
+
+  // nested batch edits emit at the end of the outermost one, objects removed in between do not report their changes
+  batchCounter.clearState();
+  relationshipCounter.clearState();
+  {
+    Workspace::BatchEdit outerBatchEdit(batchWorkspace);
+    {
+      Workspace::BatchEdit innerBatchEdit(batchWorkspace);
+      EXPECT_TRUE(lights.setDouble(LightsFields::LightingLevel, 2000.0));
+    }
+    EXPECT_TRUE(batchWorkspace.inBatchEdit());
+    EXPECT_EQ(1u, batchCounter.numChanges);
+    EXPECT_EQ(1u, lights.remove().size());
+    EXPECT_EQ(1u, batchCounter.numChanges);
+  }
+  EXPECT_FALSE(batchWorkspace.inBatchEdit());
+  EXPECT_EQ(2u, batchCounter.numChanges);
+  EXPECT_TRUE(relationshipCounter.removedFromWorkspace());
+  EXPECT_FALSE(relationshipCounter.dataChanged());
+  EXPECT_EQ(4u, zones.back().getSources(IddObjectType::Lights).size());
+}
+
+TEST_F(IdfFixture, Workspace_ChangeGenerations) {
+  // change generations move on during a batch edit, when onChange is held back
+  Workspace ws(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  std::shared_ptr<detail::Workspace_Impl> impl = ws.getImpl<detail::Workspace_Impl>();
+  WorkspaceChangeCounter counter(ws);
+
+  Workspace::BatchEdit batchEdit(ws);
+  std::uint64_t zoneGeneration = impl->changeGeneration(IddObjectType::Zone);
+  std::uint64_t lightsGeneration = impl->changeGeneration(IddObjectType::Lights);
+  std::uint64_t relationshipGeneration = impl->relationshipGeneration();
+
+  boost::optional<WorkspaceObject> zone = ws.addObject(IdfObject(IddObjectType::Zone));
+  ASSERT_TRUE(zone);
+  EXPECT_LT(zoneGeneration, impl->changeGeneration(IddObjectType::Zone));
+  EXPECT_LT(relationshipGeneration, impl->relationshipGeneration());
+  EXPECT_EQ(lightsGeneration, impl->changeGeneration(IddObjectType::Lights));
+
+  boost::optional<WorkspaceObject> lights = ws.addObject(IdfObject(IddObjectType::Lights));
+  ASSERT_TRUE(lights);
+  lightsGeneration = impl->changeGeneration(IddObjectType::Lights);
+
+  // a data field only moves the generation of its type
+  zoneGeneration = impl->changeGeneration(IddObjectType::Zone);
+  relationshipGeneration = impl->relationshipGeneration();
+  EXPECT_TRUE(lights->setDouble(LightsFields::LightingLevel, 1000.0));
+  EXPECT_LT(lightsGeneration, impl->changeGeneration(IddObjectType::Lights));
+  EXPECT_EQ(zoneGeneration, impl->changeGeneration(IddObjectType::Zone));
+  EXPECT_EQ(relationshipGeneration, impl->relationshipGeneration());
+
+  // pointer fields move the relationship generation
+  EXPECT_TRUE(lights->setPointer(LightsFields::ZoneorZoneListorSpaceorSpaceListName, zone->handle()));
+  EXPECT_LT(relationshipGeneration, impl->relationshipGeneration());
+  relationshipGeneration = impl->relationshipGeneration();
+
+  // removing the zone nulls the pointer to it
+  lightsGeneration = impl->changeGeneration(IddObjectType::Lights);
+  EXPECT_FALSE(zone->remove().empty());
+  EXPECT_LT(zoneGeneration, impl->changeGeneration(IddObjectType::Zone));
+  EXPECT_LT(relationshipGeneration, impl->relationshipGeneration());
+  EXPECT_LT(lightsGeneration, impl->changeGeneration(IddObjectType::Lights));
+
+  EXPECT_EQ(0u, counter.numChanges);
+}
+
 TEST_F(IdfFixture, Workspace_DaylightingControlsZoneName) {
   // DaylightingControls is an odd object with field 0 not being a name field
   Workspace ws(StrictnessLevel::Draft, IddFileType::EnergyPlus);
@@ -2046,6 +2200,99 @@ TEST_F(IdfFixture, Workspace_DuplicateObjectName) {
   EXPECT_TRUE(zoneGroup2->setName("Zone Group"));
   EXPECT_EQ("Zone Group", zoneGroup1->nameString());
   EXPECT_EQ("Zone Group 1", zoneGroup2->nameString());
+
+  // conflicts are case insensitive, and renaming an object frees its name
+  EXPECT_TRUE(zoneGroup2->setName("ZONE GROUP"));
+  EXPECT_FALSE(istringEqual("Zone Group", zoneGroup2->nameString()));
+  EXPECT_TRUE(zoneGroup1->setName("Main Group"));
+  EXPECT_TRUE(zoneGroup2->setName("zone group"));
+  EXPECT_EQ("zone group", zoneGroup2->nameString());
+  EXPECT_TRUE(zoneGroup1->setName("Zone Group"));
+  EXPECT_EQ("Zone Group 1", zoneGroup1->nameString());
+}
+
+TEST_F(IdfFixture, Workspace_NameIndex) {
+  Workspace ws(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+
+  // name lookups must agree with a scan of all objects
+  auto checkNames = [](const Workspace& workspace, const std::string& name) {
+    unsigned exact = 0;
+    for (const WorkspaceObject& object : workspace.objects()) {
+      std::string objectName = object.nameString();
+      if (istringEqual(objectName, name)) {
+        ++exact;
+      }
+      if (!objectName.empty()) {
+        boost::optional<WorkspaceObject> found = workspace.getObjectByTypeAndName(object.iddObject().type(), objectName);
+        ASSERT_TRUE(found) << objectName;
+        EXPECT_EQ(object.handle(), found->handle());
+      }
+    }
+    EXPECT_EQ(exact, workspace.getObjectsByName(name, true).size()) << name;
+  };
+
+  std::vector<WorkspaceObject> zones;
+  for (int i = 0; i < 10; ++i) {
+    boost::optional<WorkspaceObject> zone = ws.addObject(IdfObject(IddObjectType::Zone));
+    ASSERT_TRUE(zone);
+    zones.push_back(*zone);
+  }
+  EXPECT_EQ("Zone 10", zones.back().nameString());
+  EXPECT_EQ(10u, ws.getObjectsByName("zone", false).size());
+  EXPECT_EQ(10u, ws.getObjectsByTypeAndName(IddObjectType::Zone, "ZONE 3").size());
+  EXPECT_EQ(0u, ws.getObjectsByTypeAndName(IddObjectType::Building, "Zone").size());
+  ASSERT_TRUE(ws.getObjectByTypeAndName(IddObjectType::Zone, "zone 4"));
+  EXPECT_EQ(zones[3].handle(), ws.getObjectByTypeAndName(IddObjectType::Zone, "zone 4")->handle());
+  EXPECT_EQ("Zone 11", ws.nextName(IddObjectType::Zone, false));
+  EXPECT_EQ("Zone 11", ws.nextName(IddObjectType::Zone, true));
+  checkNames(ws, "Zone 4");
+
+  // renaming frees up suffixes
+  EXPECT_TRUE(zones[3].setName("Core Zone"));
+  EXPECT_EQ("Zone 11", ws.nextName(IddObjectType::Zone, false));
+  EXPECT_EQ("Zone 4", ws.nextName(IddObjectType::Zone, true));
+  EXPECT_FALSE(ws.getObjectByTypeAndName(IddObjectType::Zone, "Zone 4"));
+  ASSERT_TRUE(ws.getObjectByTypeAndName(IddObjectType::Zone, "CORE ZONE"));
+  EXPECT_EQ(9u, ws.getObjectsByName("Zone", false).size());
+  checkNames(ws, "Core Zone");
+
+  // so does removing objects
+  EXPECT_FALSE(zones[0].remove().empty());
+  EXPECT_FALSE(zones[9].remove().empty());
+  EXPECT_EQ("Zone 10", ws.nextName(IddObjectType::Zone, false));
+  EXPECT_EQ("Zone 1", ws.nextName(IddObjectType::Zone, true));
+  EXPECT_FALSE(ws.getObjectByTypeAndName(IddObjectType::Zone, "Zone 10"));
+  EXPECT_EQ(7u, ws.getObjectsByName("Zone", false).size());
+  checkNames(ws, "Zone 10");
+
+  // objects of other types with the same name
+  boost::optional<WorkspaceObject> building = ws.addObject(IdfObject(IddObjectType::Building));
+  ASSERT_TRUE(building);
+  EXPECT_TRUE(building->setName("Zone 2"));
+  EXPECT_EQ(2u, ws.getObjectsByName("Zone 2", true).size());
+  ASSERT_TRUE(ws.getObjectByTypeAndName(IddObjectType::Building, "Zone 2"));
+  EXPECT_EQ(building->handle(), ws.getObjectByTypeAndName(IddObjectType::Building, "Zone 2")->handle());
+  EXPECT_EQ("Zone 10", ws.nextName(IddObjectType::Zone, false));
+  EXPECT_EQ("Zone 10", ws.nextName("Zone", false));
+  checkNames(ws, "Zone 2");
+
+  // underscore spacers are kept
+  Workspace underscores(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  boost::optional<WorkspaceObject> zone = underscores.addObject(IdfObject(IddObjectType::Zone));
+  ASSERT_TRUE(zone);
+  EXPECT_TRUE(zone->setName("Zone_1"));
+  EXPECT_EQ("Zone_2", underscores.nextName(IddObjectType::Zone, false));
+
+  // swapping workspaces swaps the indices, and renames go to the right one
+  ws.swap(underscores);
+  EXPECT_EQ("Zone_2", ws.nextName(IddObjectType::Zone, false));
+  EXPECT_EQ("Zone 10", underscores.nextName(IddObjectType::Zone, false));
+  EXPECT_TRUE(zone->setName("Zone 5"));
+  EXPECT_EQ("Zone 6", ws.nextName(IddObjectType::Zone, false));
+  EXPECT_EQ(1u, ws.getObjectsByName("Zone 5", true).size());
+  EXPECT_EQ(1u, underscores.getObjectsByName("Zone 5", true).size());
+  checkNames(ws, "Zone 5");
+  checkNames(underscores, "Zone 5");
 }
 
 // test for #1531 (and #1741)
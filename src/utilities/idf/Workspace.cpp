@@ -18,6 +18,8 @@
 #include "../core/StringHelpers.hpp"
 
 #include <boost/lexical_cast.hpp>
+#include <cctype>
+#include <iterator>
 #include <memory>
 
 using namespace std;
@@ -151,6 +153,20 @@ namespace detail {
     IdfReferencesMap tirm = m_idfReferencesMap;
     m_idfReferencesMap = otherImpl->m_idfReferencesMap;
     otherImpl->m_idfReferencesMap = tirm;
+
+    std::swap(m_nameIndex, otherImpl->m_nameIndex);
+    std::swap(m_iddObjectTypeNameIndex, otherImpl->m_iddObjectTypeNameIndex);
+    std::swap(m_nameSeriesIndex, otherImpl->m_nameSeriesIndex);
+    std::swap(m_iddObjectTypeNameSeriesIndex, otherImpl->m_iddObjectTypeNameSeriesIndex);
+    std::swap(m_indexedNames, otherImpl->m_indexedNames);
+
+    // objects now belong to the other workspace, so renames update the right name index
+    for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap) {
+      p.second->m_workspace = this;
+    }
+    for (const WorkspaceObjectMap::value_type& p : otherImpl->m_workspaceObjectMap) {
+      p.second->m_workspace = otherImpl.get();
+    }
   }
 
   // GETTERS
@@ -313,6 +329,29 @@ namespace detail {
 
   std::vector<WorkspaceObject> Workspace_Impl::getObjectsByName(const std::string& name, bool exactMatch) const {
     WorkspaceObjectVector result;
+    std::string key = istringKey(exactMatch ? name : getBaseName(name));
+    if (!key.empty()) {
+      if (exactMatch) {
+        auto loc = m_nameIndex.find(key);
+        if (loc != m_nameIndex.end()) {
+          result.reserve(loc->second.size());
+          for (const WorkspaceObjectMap::value_type& p : loc->second) {
+            result.push_back(WorkspaceObject(p.second));
+          }
+        }
+      } else {
+        auto loc = m_nameSeriesIndex.find(key);
+        if (loc != m_nameSeriesIndex.end()) {
+          result.reserve(loc->second.objects.size());
+          for (const WorkspaceObjectMap::value_type& p : loc->second.objects) {
+            result.push_back(WorkspaceObject(p.second));
+          }
+        }
+      }
+      return result;
+    }
+
+    // objects with empty names are not indexed
     if (exactMatch) {
       for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap) {
         if (OptionalString candidate = p.second->name()) {
@@ -358,6 +397,20 @@ namespace detail {
   }
 
   boost::optional<WorkspaceObject> Workspace_Impl::getObjectByTypeAndName(IddObjectType objectType, const std::string& name) const {
+    if (!name.empty()) {
+      auto typeLoc = m_iddObjectTypeNameIndex.find(objectType);
+      if (typeLoc == m_iddObjectTypeNameIndex.end()) {
+        return boost::none;
+      }
+      auto loc = typeLoc->second.find(istringKey(name));
+      if (loc == typeLoc->second.end()) {
+        return boost::none;
+      }
+      OS_ASSERT(!loc->second.empty());
+      return WorkspaceObject(loc->second.begin()->second);
+    }
+
+    // objects with empty names are not indexed
     for (const WorkspaceObject& object : getObjectsByType(objectType)) {
       OptionalString candidate = object.name();
       if (candidate && istringEqual(*candidate, name)) {
@@ -370,6 +423,21 @@ namespace detail {
   std::vector<WorkspaceObject> Workspace_Impl::getObjectsByTypeAndName(IddObjectType objectType, const std::string& name) const {
     WorkspaceObjectVector result;
     std::string baseName = getBaseName(name);
+    if (!baseName.empty()) {
+      auto typeLoc = m_iddObjectTypeNameSeriesIndex.find(objectType);
+      if (typeLoc != m_iddObjectTypeNameSeriesIndex.end()) {
+        auto loc = typeLoc->second.find(istringKey(baseName));
+        if (loc != typeLoc->second.end()) {
+          result.reserve(loc->second.objects.size());
+          for (const WorkspaceObjectMap::value_type& p : loc->second.objects) {
+            result.push_back(WorkspaceObject(p.second));
+          }
+        }
+      }
+      return result;
+    }
+
+    // objects with empty names are not indexed
     for (const WorkspaceObject& object : getObjectsByType(objectType)) {
       if (OptionalString candidate = object.name()) {
         if (baseNamesMatch(baseName, *candidate)) {
@@ -411,6 +479,26 @@ namespace detail {
 
   boost::optional<WorkspaceObject> Workspace_Impl::getObjectByNameAndReference(const std::string& name,
                                                                                const std::vector<std::string>& referenceNames) const {
+    if (!name.empty()) {
+      auto loc = m_nameIndex.find(istringKey(name));
+      if (loc == m_nameIndex.end()) {
+        return boost::none;
+      }
+      for (const std::string& referenceName : referenceNames) {
+        auto irmLoc = m_idfReferencesMap.find(referenceName);
+        if (irmLoc == m_idfReferencesMap.end()) {
+          continue;
+        }
+        for (const WorkspaceObjectMap::value_type& p : loc->second) {
+          if (irmLoc->second.find(p.first) != irmLoc->second.end()) {
+            return WorkspaceObject(p.second);
+          }
+        }
+      }
+      return boost::none;
+    }
+
+    // objects with empty names are not indexed
     for (const WorkspaceObject& object : getObjectsByReference(referenceNames)) {
       OptionalString candidate = object.name();
       if (candidate && istringEqual(*candidate, name)) {
@@ -420,6 +508,36 @@ namespace detail {
     return boost::none;
   }
 
+  std::vector<WorkspaceObject> Workspace_Impl::getObjectsByNameAndReference(const std::string& name,
+                                                                            const std::vector<std::string>& referenceNames) const {
+    std::vector<WorkspaceObject> result;
+    if (!name.empty()) {
+      auto loc = m_nameIndex.find(istringKey(name));
+      if (loc == m_nameIndex.end()) {
+        return result;
+      }
+      for (const WorkspaceObjectMap::value_type& p : loc->second) {
+        for (const std::string& referenceName : referenceNames) {
+          auto irmLoc = m_idfReferencesMap.find(referenceName);
+          if ((irmLoc != m_idfReferencesMap.end()) && (irmLoc->second.find(p.first) != irmLoc->second.end())) {
+            result.push_back(WorkspaceObject(p.second));
+            break;
+          }
+        }
+      }
+      return result;
+    }
+
+    // objects with empty names are not indexed
+    for (const WorkspaceObject& object : getObjectsByReference(referenceNames)) {
+      OptionalString candidate = object.name();
+      if (candidate && candidate->empty()) {
+        result.push_back(object);
+      }
+    }
+    return result;
+  }
+
   bool Workspace_Impl::fastNaming() const {
     return m_fastNaming;
   }
@@ -556,6 +674,7 @@ namespace detail {
       m_workspaceObjectMap.insert(WorkspaceObjectMap::value_type(newHandles.back(), ptr));
       insertIntoIddObjectTypeMap(ptr);
       insertIntoIdfReferencesMap(ptr);
+      insertIntoNameIndex(ptr);
       this->progressValue.nano_emit(++i);
     }
 
@@ -1387,7 +1506,7 @@ namespace detail {
     if ((m_strictnessLevel < StrictnessLevel::Final) || isValid()) {
       std::vector<Handle> removedHandles(1, handle);
       registerRemovalOfObject(objectData->objectImplPtr, sources, removedHandles);
-      this->onChange.nano_emit();
+      this->change();
       return true;
     } else {
       restoreObject(*objectData);
@@ -1420,7 +1539,7 @@ namespace detail {
 
     if ((m_strictnessLevel < StrictnessLevel::Final) || isValid()) {
       registerRemovalOfObjects(objectData, sources, handles);
-      this->onChange.nano_emit();
+      this->change();
       return true;
     } else {
       restoreObjects(objectData);
@@ -1494,6 +1613,78 @@ namespace detail {
     m_fastNaming = fastNaming;
   }
 
+  // BATCH EDITS
+
+  bool Workspace_Impl::inBatchEdit() const {
+    return (m_batchEditDepth > 0);
+  }
+
+  void Workspace_Impl::beginBatchEdit() {
+    ++m_batchEditDepth;
+  }
+
+  void Workspace_Impl::endBatchEdit() {
+    OS_ASSERT(m_batchEditDepth > 0);
+    if (--m_batchEditDepth > 0) {
+      return;
+    }
+
+    // slots may change more objects while the held back signals go out, the onChange of the
+    // Workspace is folded into the single one emitted at the very end
+    std::vector<std::shared_ptr<WorkspaceObject_Impl>> objects;
+    objects.swap(m_batchEditObjects);
+    m_batchEditObjectSet.clear();
+
+    bool wasEmitting = m_emittingBatchEdit;
+    m_emittingBatchEdit = true;
+    try {
+      for (const std::shared_ptr<WorkspaceObject_Impl>& object : objects) {
+        // objects removed during the batch edit do not report their changes
+        if (!object->handle().isNull()) {
+          object->emitChangeSignals();
+        }
+      }
+    } catch (...) {
+      m_emittingBatchEdit = wasEmitting;
+      throw;
+    }
+    m_emittingBatchEdit = wasEmitting;
+
+    if (m_batchEditChanged && !wasEmitting) {
+      m_batchEditChanged = false;
+      this->onChange.nano_emit();
+    }
+  }
+
+  void Workspace_Impl::deferChangeSignals(WorkspaceObject_Impl* object) {
+    OS_ASSERT(m_batchEditDepth > 0);
+    if (m_batchEditObjectSet.insert(object).second) {
+      m_batchEditObjects.push_back(std::static_pointer_cast<WorkspaceObject_Impl>(object->shared_from_this()));
+    }
+  }
+
+  // CHANGE GENERATIONS
+
+  std::uint64_t Workspace_Impl::changeGeneration(IddObjectType type) const {
+    auto it = m_changeGenerations.find(type);
+    if (it == m_changeGenerations.end()) {
+      return 0;
+    }
+    return it->second;
+  }
+
+  std::uint64_t Workspace_Impl::relationshipGeneration() const {
+    return m_relationshipGeneration;
+  }
+
+  void Workspace_Impl::registerChange(IddObjectType type) {
+    ++m_changeGenerations[type];
+  }
+
+  void Workspace_Impl::registerRelationshipChange() {
+    ++m_relationshipGeneration;
+  }
+
   // OBJECT ORDER
 
   WorkspaceObjectOrder Workspace_Impl::order() {
@@ -1564,6 +1755,15 @@ namespace detail {
       return toString(createUUID());
     }
 
+    std::string baseName = getBaseName(name);
+    if (!baseName.empty()) {
+      auto loc = m_nameSeriesIndex.find(istringKey(baseName));
+      if (loc == m_nameSeriesIndex.end()) {
+        return constructNextName(name, NameSeries(), fillIn);
+      }
+      return constructNextName(name, loc->second, fillIn);
+    }
+
     WorkspaceObjectVector objectsInSeries = getObjectsByName(name, false);
     return constructNextName(name, objectsInSeries, fillIn);
   }
@@ -1578,6 +1778,18 @@ namespace detail {
       return {};
     }
     std::string name = iddObjectNameToIdfObjectName(iddObject->name());
+    std::string baseName = getBaseName(name);
+    if (!baseName.empty()) {
+      auto typeLoc = m_iddObjectTypeNameSeriesIndex.find(iddObjectType);
+      if (typeLoc != m_iddObjectTypeNameSeriesIndex.end()) {
+        auto loc = typeLoc->second.find(istringKey(baseName));
+        if (loc != typeLoc->second.end()) {
+          return constructNextName(name, loc->second, fillIn);
+        }
+      }
+      return constructNextName(name, NameSeries(), fillIn);
+    }
+
     WorkspaceObjectVector objectsInSeries = getObjectsByTypeAndName(iddObjectType, name);
     return constructNextName(name, objectsInSeries, fillIn);
   }
@@ -1927,6 +2139,9 @@ namespace detail {
     // IdfReferencesMap
     insertIntoIdfReferencesMap(ptr);
 
+    // Name indices
+    insertIntoNameIndex(ptr);
+
     return true;
   }
 
@@ -1944,6 +2159,140 @@ namespace detail {
       m_idfReferencesMap[referenceName].insert(std::make_pair(objectImplPtr->handle(), objectImplPtr));
     }
   }
+
+  void Workspace_Impl::insertIntoNameIndex(const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr) {
+    OptionalString name = objectImplPtr->name();
+    if (!name || name->empty()) {
+      return;
+    }
+    Handle handle = objectImplPtr->handle();
+    IddObjectType type = objectImplPtr->iddObject().type();
+
+    std::string key = istringKey(*name);
+    m_nameIndex[key].insert(std::make_pair(handle, objectImplPtr));
+    m_iddObjectTypeNameIndex[type][key].insert(std::make_pair(handle, objectImplPtr));
+
+    std::string baseKey = istringKey(getBaseName(*name));
+    std::tuple<boost::optional<int>, std::string> suffix = getNameSuffix(*name);
+    bool underscoreSpacer = (std::get<1>(suffix) == "_");
+    m_nameSeriesIndex[baseKey].insert(handle, objectImplPtr, std::get<0>(suffix), underscoreSpacer);
+    m_iddObjectTypeNameSeriesIndex[type][baseKey].insert(handle, objectImplPtr, std::get<0>(suffix), underscoreSpacer);
+
+    m_indexedNames[handle] = *name;
+  }
+
+  void Workspace_Impl::removeFromNameIndex(const Handle& handle, IddObjectType type) {
+    auto inLoc = m_indexedNames.find(handle);
+    if (inLoc == m_indexedNames.end()) {
+      return;
+    }
+    const std::string& name = inLoc->second;
+
+    std::string key = istringKey(name);
+    auto eraseFromNameIndex = [&handle, &key](NameIndex& nameIndex) {
+      auto loc = nameIndex.find(key);
+      OS_ASSERT(loc != nameIndex.end());
+      loc->second.erase(handle);
+      // erase entry if set is empty
+      if (loc->second.empty()) {
+        nameIndex.erase(loc);
+      }
+    };
+    eraseFromNameIndex(m_nameIndex);
+    eraseFromNameIndex(m_iddObjectTypeNameIndex[type]);
+
+    std::string baseKey = istringKey(getBaseName(name));
+    std::tuple<boost::optional<int>, std::string> suffix = getNameSuffix(name);
+    bool underscoreSpacer = (std::get<1>(suffix) == "_");
+    auto eraseFromNameSeriesIndex = [&handle, &baseKey, &suffix, underscoreSpacer](NameSeriesIndex& nameSeriesIndex) {
+      auto loc = nameSeriesIndex.find(baseKey);
+      OS_ASSERT(loc != nameSeriesIndex.end());
+      loc->second.erase(handle, std::get<0>(suffix), underscoreSpacer);
+      // erase entry if series is empty
+      if (loc->second.objects.empty()) {
+        nameSeriesIndex.erase(loc);
+      }
+    };
+    eraseFromNameSeriesIndex(m_nameSeriesIndex);
+    eraseFromNameSeriesIndex(m_iddObjectTypeNameSeriesIndex[type]);
+
+    m_indexedNames.erase(inLoc);
+  }
+
+  void Workspace_Impl::updateNameIndex(const WorkspaceObject_Impl* object) {
+    auto loc = m_workspaceObjectMap.find(object->handle());
+    if ((loc == m_workspaceObjectMap.end()) || (loc->second.get() != object)) {
+      // not added yet
+      return;
+    }
+    removeFromNameIndex(loc->first, object->iddObject().type());
+    insertIntoNameIndex(loc->second);
+  }
+
+  void Workspace_Impl::NameSeries::insert(const Handle& handle, const std::shared_ptr<WorkspaceObject_Impl>& object, boost::optional<int> suffix,
+                                          bool underscoreSpacer) {
+    objects.insert(std::make_pair(handle, object));
+    if (underscoreSpacer) {
+      ++numUnderscoreSpacers;
+    }
+    if (!suffix || (++suffixCounts[*suffix] > 1)) {
+      return;
+    }
+
+    // new suffix, extend or merge the adjacent runs
+    int value = *suffix;
+    auto next = suffixRuns.upper_bound(value);
+    bool extendsPrevious = false;
+    if (next != suffixRuns.begin()) {
+      auto previous = std::prev(next);
+      if (previous->second == value - 1) {
+        previous->second = value;
+        extendsPrevious = true;
+      }
+    }
+    if ((next != suffixRuns.end()) && (next->first == value + 1)) {
+      int last = next->second;
+      suffixRuns.erase(next);
+      if (extendsPrevious) {
+        std::prev(suffixRuns.upper_bound(value))->second = last;
+      } else {
+        suffixRuns[value] = last;
+      }
+    } else if (!extendsPrevious) {
+      suffixRuns[value] = value;
+    }
+  }
+
+  void Workspace_Impl::NameSeries::erase(const Handle& handle, boost::optional<int> suffix, bool underscoreSpacer) {
+    objects.erase(handle);
+    if (underscoreSpacer) {
+      --numUnderscoreSpacers;
+    }
+    if (!suffix) {
+      return;
+    }
+    auto countLoc = suffixCounts.find(*suffix);
+    OS_ASSERT(countLoc != suffixCounts.end());
+    if (--countLoc->second > 0) {
+      return;
+    }
+    suffixCounts.erase(countLoc);
+
+    // suffix no longer in use, split its run
+    int value = *suffix;
+    auto run = std::prev(suffixRuns.upper_bound(value));
+    int first = run->first;
+    int last = run->second;
+    OS_ASSERT((first <= value) && (value <= last));
+    suffixRuns.erase(run);
+    if (first < value) {
+      suffixRuns[first] = value - 1;
+    }
+    if (value < last) {
+      suffixRuns[value + 1] = last;
+    }
+  }
+
   bool Workspace_Impl::resolvePotentialNameConflicts(Workspace& other) {
     return resolvePotentialNameConflicts(other, std::vector<unsigned>());
   }
@@ -2094,6 +2443,8 @@ namespace detail {
       OS_ASSERT(oObject);
     }
     WorkspaceObject_ImplPtr objectImplPtr = oObject->getImpl<WorkspaceObject_Impl>();
+    registerChange(objectImplPtr->iddObject().type());
+    registerRelationshipChange();
 
     // unlink from other objects
     // handle -> others
@@ -2146,6 +2497,9 @@ namespace detail {
       m_iddObjectTypeMap.erase(iotmLoc);
     }
 
+    // Name indices
+    removeFromNameIndex(handle, objectImplPtr->iddObject().type());
+
     // WorkspaceObjectOrder
     if (m_workspaceObjectOrder.isDirectOrder()) {
       m_workspaceObjectOrder.erase(handle);
@@ -2188,11 +2542,13 @@ namespace detail {
   }
 
   void Workspace_Impl::registerAdditionOfObject(const WorkspaceObject& object) {
+    registerChange(object.iddObject().type());
+    registerRelationshipChange();
     object.getImpl<WorkspaceObject_Impl>().get()->WorkspaceObject_Impl::onChange.connect<Workspace_Impl, &Workspace_Impl::change>(this);
     auto sh_ptr = object.getImpl<WorkspaceObject_Impl>();
     this->addWorkspaceObject.nano_emit(object, object.iddObject().type(), object.handle());
     this->addWorkspaceObjectPtr.nano_emit(sh_ptr, object.iddObject().type(), object.handle());
-    this->onChange.nano_emit();
+    this->change();
   }
 
   void Workspace_Impl::restoreObject(SavedWorkspaceObject& savedObject) {
@@ -2210,6 +2566,9 @@ namespace detail {
     // IdfReferencesMap
     insertIntoIdfReferencesMap(savedObject.objectImplPtr);
 
+    // Name indices
+    insertIntoNameIndex(savedObject.objectImplPtr);
+
     // Fix Pointers
     savedObject.objectImplPtr->restorePointers();
 
@@ -2262,6 +2621,26 @@ namespace detail {
     return getBaseName(objectName) + spacer + boost::lexical_cast<std::string>(suffix);
   }
 
+  std::string Workspace_Impl::constructNextName(const std::string& objectName, const NameSeries& series, bool fillIn) const {
+    int suffix(1);
+    if (fillIn) {
+      // first run starting at 1, if any, ends right before the smallest unused suffix
+      if (!series.suffixRuns.empty() && (series.suffixRuns.begin()->first == 1)) {
+        suffix = series.suffixRuns.begin()->second + 1;
+      }
+    } else {
+      if (!series.suffixCounts.empty()) {
+        suffix = series.suffixCounts.rbegin()->first + 1;
+      }
+    }
+    // keep using '_' if all objects in the series do
+    std::string spacer = " ";
+    if (!series.objects.empty() && (series.numUnderscoreSpacers == series.objects.size())) {
+      spacer = "_";
+    }
+    return getBaseName(objectName) + spacer + boost::lexical_cast<std::string>(suffix);
+  }
+
   std::vector<std::vector<WorkspaceObject>> Workspace_Impl::nameConflicts(const std::vector<WorkspaceObject>& candidates) const {
     std::vector<WorkspaceObjectVector> result;
     IStringSet examinedNames;
@@ -2325,6 +2704,10 @@ namespace detail {
   }
 
   void Workspace_Impl::change() {
+    if (inBatchEdit() || m_emittingBatchEdit) {
+      m_batchEditChanged = true;
+      return;
+    }
     this->onChange.nano_emit();
   }
 
@@ -2588,6 +2971,24 @@ void Workspace::setFastNaming(bool fastNaming) {
   m_impl->setFastNaming(fastNaming);
 }
 
+// BATCH EDITS
+
+bool Workspace::inBatchEdit() const {
+  return m_impl->inBatchEdit();
+}
+
+Workspace::BatchEdit::BatchEdit(const Workspace& workspace) : m_impl(workspace.m_impl) {
+  m_impl->beginBatchEdit();
+}
+
+Workspace::BatchEdit::~BatchEdit() {
+  try {
+    m_impl->endBatchEdit();
+  } catch (const std::exception& e) {
+    LOG(Error, "Exception while emitting the signals held back by a batch edit: " << e.what());
+  }
+}
+
 // ORDER
 
 WorkspaceObjectOrder Workspace::order() {
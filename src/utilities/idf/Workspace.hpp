@@ -210,6 +210,9 @@ class UTILITIES_API Workspace
    *  objects and does not do any name conflict checking. */
   bool fastNaming() const;
 
+  /** Returns true while a BatchEdit of this Workspace is alive. */
+  bool inBatchEdit() const;
+
   //@}
   /** @name Setters */
   //@{
@@ -316,6 +319,38 @@ class UTILITIES_API Workspace
    *  handle. */
   void setFastNaming(bool fastNaming);
 
+  //@}
+  /** @name Batch Edits */
+  //@{
+
+  /** BatchEdit holds back the change signals of a Workspace and its objects for its lifetime, for
+   *  instance while a measure sets the construction of every surface. Object data, pointers and
+   *  reverse pointers are updated immediately, so the end state is the same as without the batch
+   *  edit. When the outermost BatchEdit is destroyed, each changed object emits its signals once, in
+   *  the order the objects were first changed, and a pointer field that was changed several times
+   *  reports one relationship change from its original to its final target. The Workspace then
+   *  emits onChange once. Signals for added and removed objects are not held back, objects removed
+   *  during the batch edit do not report their earlier changes.
+   *
+   *  Caches an object keeps of its own fields, e.g. surface vertices or schedule day values, listen
+   *  to onImmediateChange and are cleared as soon as the object changes. Other observers that listen
+   *  to onChange only catch up when the batch edit ends. */
+  class UTILITIES_API BatchEdit
+  {
+   public:
+    explicit BatchEdit(const Workspace& workspace);
+
+    ~BatchEdit();
+
+    BatchEdit(const BatchEdit&) = delete;
+    BatchEdit(BatchEdit&&) = delete;
+    BatchEdit& operator=(const BatchEdit&) = delete;
+    BatchEdit& operator=(BatchEdit&&) = delete;
+
+   private:
+    std::shared_ptr<detail::Workspace_Impl> m_impl;
+  };
+
   //@}
   /** @name Object Order */
   //@{
@@ -17,6 +17,9 @@
 #include "../core/Assert.hpp"
 #include "../core/StringHelpers.hpp"
 
+#include <algorithm>
+#include <tuple>
+
 using namespace std;
 
 using openstudio::detail::WorkspaceObject_Impl;
@@ -928,9 +931,25 @@ namespace detail {
       return;
     }
 
+    // caches compare change generations, which move on even while the signals are held back
+    if (m_workspace) {
+      m_workspace->registerChange(iddObject().type());
+    }
+    this->onImmediateChange.nano_emit();
+
+    // keep the diffs until the batch edit ends, an object still being constructed (createName) has no listeners yet
+    if (m_workspace && m_workspace->inBatchEdit() && !weak_from_this().expired()) {
+      m_workspace->deferChangeSignals(this);
+      return;
+    }
+
     bool nameChange = false;
     bool dataChange = false;
 
+    // a pointer field changed several times, e.g. during a batch edit, reports its first old and
+    // last new target once
+    std::vector<std::tuple<unsigned, Handle, Handle>> relationshipChanges;
+
     for (const IdfObjectDiff& diff : m_diffs) {
 
       if (diff.isNull()) {
@@ -956,7 +975,13 @@ namespace detail {
             oldHandle = workspaceObjectDiff.oldHandle().get();
           }
 
-          this->onRelationshipChange.nano_emit(*index, newHandle, oldHandle);
+          auto it = std::find_if(relationshipChanges.begin(), relationshipChanges.end(),
+                                 [&index](const auto& relationshipChange) { return std::get<0>(relationshipChange) == *index; });
+          if (it == relationshipChanges.end()) {
+            relationshipChanges.emplace_back(*index, newHandle, oldHandle);
+          } else {
+            std::get<1>(*it) = newHandle;
+          }
 
         } else if (oIddField && oIddField->isNameField()) {
           nameChange = true;
@@ -966,6 +991,10 @@ namespace detail {
       }
     }
 
+    for (const auto& [index, newHandle, oldHandle] : relationshipChanges) {
+      this->onRelationshipChange.nano_emit(index, newHandle, oldHandle);
+    }
+
     if (nameChange) {
       this->onNameChange.nano_emit();
     }
@@ -996,6 +1025,7 @@ namespace detail {
   // Post-condition: field index is a pointer with a null targetHandle.
   void WorkspaceObject_Impl::nullifyPointer(unsigned index) {
     OS_ASSERT(!m_handle.isNull());
+    m_workspace->registerRelationshipChange();
     // reverse pointer
     OptionalWorkspaceObject oTarget = getTarget(index);
     if (oTarget) {
@@ -1072,6 +1102,12 @@ namespace detail {
     }
   }
 
+  void WorkspaceObject_Impl::nameFieldChanged() {
+    if (m_workspace) {
+      m_workspace->updateNameIndex(this);
+    }
+  }
+
   // PRIVATE
 
   // SETTERS
@@ -1095,6 +1131,7 @@ namespace detail {
       }
     }
     // add pointer
+    m_workspace->registerRelationshipChange();
     fpIt = getIteratorAtFieldIndex<SourceData>(m_sourceData->pointers, index);
     if (fpIt != m_sourceData->pointers.end()) {
       m_sourceData->pointers.erase(fpIt);
@@ -1178,6 +1215,7 @@ namespace detail {
       // delete field
       m_diffs.push_back(IdfObjectDiff(index, m_fields[index], boost::none));
       m_fields.pop_back();
+      truncateCachedDoubles(m_fields.size());
       if (m_fieldComments.size() > m_fields.size()) {
         m_fieldComments.resize(m_fields.size());
       }
@@ -1231,15 +1269,14 @@ namespace detail {
     if (!oName) {
       return true;
     }
-    WorkspaceObjectVector candidates = m_workspace->getObjectsByReference(iddObject().references());
+    // the name index narrows the candidates to the objects with the same name
+    WorkspaceObjectVector candidates = m_workspace->getObjectsByNameAndReference(*oName, iddObject().references());
     for (const WorkspaceObject& candidate : candidates) {
       if ((candidate.iddObject().type() == openstudio::IddObjectType::OS_Connection)
           || (candidate.iddObject().type() == openstudio::IddObjectType::OS_PortList)) {
         continue;
       }
-      OptionalString candidateName = candidate.name();
-      OS_ASSERT(candidateName);
-      if ((istringEqual(*oName, *candidateName) && (!initialized() || (getObject<WorkspaceObject>() != candidate)))) {
+      if (!initialized() || (getObject<WorkspaceObject>() != candidate)) {
         return false;
       }
     }
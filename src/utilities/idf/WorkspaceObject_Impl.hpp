@@ -311,6 +311,11 @@ namespace detail {
 
     virtual bool fieldIsNonnullIfRequired(unsigned index) const override;
 
+    // SETTER HELPERS
+
+    /** Keeps the Workspace's name index up to date. */
+    virtual void nameFieldChanged() override;
+
    private:
     bool m_initialized;
     Workspace_Impl* m_workspace;
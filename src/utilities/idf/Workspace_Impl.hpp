@@ -20,12 +20,14 @@
 
 #include <utilities/core/Logger.hpp>
 
+#include <cstdint>
 #include <string>
 #include <ostream>
 #include <vector>
 #include <set>
 #include <map>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace openstudio {
 
@@ -172,6 +174,10 @@ namespace detail {
      *  conflicts. */
     boost::optional<WorkspaceObject> getObjectByNameAndReference(const std::string& name, const std::vector<std::string>& referenceNames) const;
 
+    /** Returns all objects that are in at least one of the reference lists in referenceNames and
+     *  named name (case insensitive, but exact match). */
+    std::vector<WorkspaceObject> getObjectsByNameAndReference(const std::string& name, const std::vector<std::string>& referenceNames) const;
+
     /** Returns true if fast naming is enabled. */
     bool fastNaming() const;
 
@@ -302,6 +308,10 @@ namespace detail {
      *  targetObject in those reference lists, remove the association. */
     void removeForwardedReferences(const Handle& sourceHandle, unsigned index, const WorkspaceObject& targetObject);
 
+    /** Re-indexes object under its current name, if it belongs to this Workspace. Called by
+     *  WorkspaceObject_Impl whenever its name field is set. */
+    void updateNameIndex(const WorkspaceObject_Impl* object);
+
     /** Setting fast naming to true reduces the time taken to create names by using a UUID as the name.
      *   This UUID is not the same as the object's handle.
      */
@@ -311,6 +321,42 @@ namespace detail {
      *  in other. */
     bool resolvePotentialNameConflicts(Workspace& other);
 
+    //@}
+    /** @name Batch Edits */
+    //@{
+
+    /** Returns true between beginBatchEdit and the matching endBatchEdit. */
+    bool inBatchEdit() const;
+
+    /** Starts holding back change signals, see Workspace::BatchEdit. Calls may be nested. */
+    void beginBatchEdit();
+
+    /** Ends the innermost batch edit. Ending the outermost one emits the held back signals. */
+    void endBatchEdit();
+
+    /** Called by WorkspaceObject_Impl::emitChangeSignals during a batch edit. The object keeps its
+     *  diffs and emits its signals when the batch edit ends. */
+    void deferChangeSignals(WorkspaceObject_Impl* object);
+
+    //@}
+    /** @name Change Generations */
+    //@{
+
+    /** Returns a counter that is incremented whenever an object of type is added, removed or changed,
+     *  also during a batch edit. Caches derived from such objects keep the value they were built at
+     *  and compare it when used, rather than listening to onChange, which a batch edit holds back. */
+    std::uint64_t changeGeneration(IddObjectType type) const;
+
+    /** Returns a counter that is incremented whenever an object is added or removed, or a pointer
+     *  field of an object changes, also during a batch edit. */
+    std::uint64_t relationshipGeneration() const;
+
+    /** Called by WorkspaceObject_Impl whenever fields of an object of type change. */
+    void registerChange(IddObjectType type);
+
+    /** Called by WorkspaceObject_Impl whenever one of its pointer fields changes. */
+    void registerRelationshipChange();
+
     //@}
     /** @name Object Order */
     //@{
@@ -471,6 +517,42 @@ namespace detail {
     using IdfReferencesMap = std::unordered_map<std::string, WorkspaceObjectMap>;  // , IstringCompare
     IdfReferencesMap m_idfReferencesMap;
 
+    // objects in a series have the same base name, that is, their names only differ by an integer
+    // suffix. tracks the suffixes in use so nextName does not have to look at each object.
+    struct NameSeries
+    {
+      WorkspaceObjectMap objects;
+      std::map<int, unsigned> suffixCounts;  // number of objects using each suffix
+      std::map<int, int> suffixRuns;         // runs of consecutive suffixes in use, first -> last
+      unsigned numUnderscoreSpacers = 0;     // number of objects whose suffix follows a '_'
+
+      void insert(const Handle& handle, const std::shared_ptr<WorkspaceObject_Impl>& object, boost::optional<int> suffix, bool underscoreSpacer);
+      void erase(const Handle& handle, boost::optional<int> suffix, bool underscoreSpacer);
+    };
+
+    // maps of upper-cased name and base name to objects, so name lookups do not have to scan all
+    // objects. objects with empty names are not indexed.
+    using NameIndex = std::unordered_map<std::string, WorkspaceObjectMap>;
+    NameIndex m_nameIndex;
+    std::map<IddObjectType, NameIndex> m_iddObjectTypeNameIndex;
+    using NameSeriesIndex = std::unordered_map<std::string, NameSeries>;
+    NameSeriesIndex m_nameSeriesIndex;
+    std::map<IddObjectType, NameSeriesIndex> m_iddObjectTypeNameSeriesIndex;
+
+    // name each object is indexed under
+    std::unordered_map<Handle, std::string, boost::hash<boost::uuids::uuid>> m_indexedNames;
+
+    // batch edits, objects with held back signals are kept in the order they were first changed
+    unsigned m_batchEditDepth = 0;
+    bool m_emittingBatchEdit = false;
+    bool m_batchEditChanged = false;  // onChange is held back
+    std::vector<std::shared_ptr<WorkspaceObject_Impl>> m_batchEditObjects;
+    std::unordered_set<const WorkspaceObject_Impl*> m_batchEditObjectSet;
+
+    // change generations, incremented eagerly even when signals are held back
+    std::map<IddObjectType, std::uint64_t> m_changeGenerations;
+    std::uint64_t m_relationshipGeneration = 0;
+
     // data object for undos
     struct SavedWorkspaceObject
     {
@@ -512,6 +594,10 @@ namespace detail {
 
     void insertIntoIdfReferencesMap(const std::shared_ptr<WorkspaceObject_Impl>& object);
 
+    void insertIntoNameIndex(const std::shared_ptr<WorkspaceObject_Impl>& object);
+
+    void removeFromNameIndex(const Handle& handle, IddObjectType type);
+
     // note default parameter for toIgnore is empty vector
     bool resolvePotentialNameConflicts(Workspace& other, const std::vector<unsigned>& toIgnore);
 
@@ -551,6 +637,9 @@ namespace detail {
     /** Returns name with the next available integer suffix. */
     std::string constructNextName(const std::string& objectName, const std::vector<WorkspaceObject>& objectsInTheSeries, bool fillIn) const;
 
+    /** Returns name with the next available integer suffix in series. */
+    std::string constructNextName(const std::string& objectName, const NameSeries& series, bool fillIn) const;
+
     std::vector<std::vector<WorkspaceObject>> nameConflicts(const std::vector<WorkspaceObject>& candidates) const;
 
     bool potentialNameConflict(const std::string& currentName, const IddObject& iddObject) const;
@@ -41,3 +41,34 @@ static void BM_ParseAirLoopHVAC(benchmark::State& state) {
 };
 
 BENCHMARK(BM_ParseAirLoopHVAC);
+
+// Reads every vertex coordinate of a surface, as PlanarSurface::vertices and the ForwardTranslator do
+static void BM_GetDoubleVertices(benchmark::State& state) {
+  std::string text = R"(OS:Surface,
+  {a8c1f3d2-34b1-4a53-9c6c-1b2f0c5d7e91}, !- Handle
+  Surface 1,                              !- Name
+  Wall,                                   !- Surface Type
+  ,                                       !- Construction Name
+  {3c6b8f5e-1d2a-4e7b-8f90-2a1b3c4d5e6f}, !- Space Name
+  Outdoors,                               !- Outside Boundary Condition
+  ,                                       !- Outside Boundary Condition Object
+  SunExposed,                             !- Sun Exposure
+  WindExposed,                            !- Wind Exposure
+  ,                                       !- View Factor to Ground
+  ,                                       !- Number of Vertices
+  0, 0, 3.048,                            !- X,Y,Z Vertex 1 {m}
+  0, 0, 0,                                !- X,Y,Z Vertex 2 {m}
+  10.5, 0, 0,                             !- X,Y,Z Vertex 3 {m}
+  10.5, 0, 3.048;                         !- X,Y,Z Vertex 4 {m})";
+
+  auto idfObject = IdfObject::load(text).get();
+  unsigned n = idfObject.numFields();
+
+  for (auto _ : state) {
+    for (unsigned i = 11; i < n; ++i) {
+      benchmark::DoNotOptimize(idfObject.getDouble(i));
+    }
+  }
+}
+
+BENCHMARK(BM_GetDoubleVertices);
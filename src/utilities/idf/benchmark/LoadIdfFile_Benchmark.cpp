@@ -7,9 +7,11 @@
 
 #include "../IdfFile.hpp"
 #include "../../core/Filesystem.hpp"
+#include "../../core/PathHelpers.hpp"
 #include "../../core/Assert.hpp"
 
 #include <resources.hxx>
+#include <utilities/idd/IddEnums.hxx>
 
 #include <OpenStudio.hxx>
 
@@ -24,6 +26,30 @@ static void BM_LoadIdfFile(benchmark::State& state, const std::string& testCase)
   }
 }
 
+static void BM_LoadIdfFileUsingRegex(benchmark::State& state, const std::string& testCase) {
+
+  path idfPath = resourcesPath() / toPath(testCase);
+  IddFileType iddFileType = (getFileExtension(idfPath) == "osm") ? IddFileType::OpenStudio : IddFileType::EnergyPlus;
+
+  for (auto _ : state) {
+    openstudio::filesystem::ifstream inFile(idfPath);
+    OptionalIdfFile oIdfFile = IdfFile::loadUsingRegex(inFile, iddFileType);
+  }
+}
+
+// Scaling of the path-based load with the number of parsing threads, given by the benchmark argument
+static void BM_LoadIdfFileThreads(benchmark::State& state, const std::string& testCase) {
+
+  path idfPath = resourcesPath() / toPath(testCase);
+  IdfFile::setNumLoadThreads(static_cast<unsigned>(state.range(0)));
+
+  for (auto _ : state) {
+    OptionalIdfFile oIdfFile = IdfFile::load(idfPath);
+  }
+
+  IdfFile::setNumLoadThreads(1);
+}
+
 BENCHMARK_CAPTURE(BM_LoadIdfFile, 5ZoneAirCooled, std::string("energyplus/5ZoneAirCooled/in.idf"))->Unit(benchmark::kMillisecond);
 BENCHMARK_CAPTURE(BM_LoadIdfFile, Daylighting_School, std::string("energyplus/Daylighting_School/in.idf"))->Unit(benchmark::kMillisecond);
 BENCHMARK_CAPTURE(BM_LoadIdfFile, SmallOffice, std::string("energyplus/SmallOffice/SmallOffice.idf"))->Unit(benchmark::kMillisecond);
@@ -34,3 +60,25 @@ BENCHMARK_CAPTURE(BM_LoadIdfFile, RefBldgLargeOffice, std::string("energyplus/Re
 BENCHMARK_CAPTURE(BM_LoadIdfFile, HospitalBaseline, std::string("energyplus/HospitalBaseline/in.idf"))->Unit(benchmark::kMillisecond);
 
 BENCHMARK_CAPTURE(BM_LoadIdfFile, exampleModel_osm, std::string("model/exampleModel.osm"))->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BM_LoadIdfFileUsingRegex, 5ZoneAirCooled, std::string("energyplus/5ZoneAirCooled/in.idf"))->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_LoadIdfFileUsingRegex, Daylighting_School, std::string("energyplus/Daylighting_School/in.idf"))->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_LoadIdfFileUsingRegex, SmallOffice, std::string("energyplus/SmallOffice/SmallOffice.idf"))->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_LoadIdfFileUsingRegex, Office_With_Many_HVAC_Types, std::string("energyplus/Office_With_Many_HVAC_Types/in.idf"))
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_LoadIdfFileUsingRegex, RefBldgLargeOffice, std::string("energyplus/RefLargeOffice/RefBldgLargeOfficeNew2004_Chicago.idf"))
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_LoadIdfFileUsingRegex, HospitalBaseline, std::string("energyplus/HospitalBaseline/in.idf"))->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BM_LoadIdfFileUsingRegex, exampleModel_osm, std::string("model/exampleModel.osm"))->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BM_LoadIdfFileThreads, HospitalBaseline, std::string("energyplus/HospitalBaseline/in.idf"))
+  ->RangeMultiplier(2)
+  ->Range(1, 16)
+  ->UseRealTime()
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_LoadIdfFileThreads, exampleModel_osm, std::string("model/exampleModel.osm"))
+  ->RangeMultiplier(2)
+  ->Range(1, 16)
+  ->UseRealTime()
+  ->Unit(benchmark::kMillisecond);
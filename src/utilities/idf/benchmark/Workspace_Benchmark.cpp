@@ -11,6 +11,7 @@
 #include "../Workspace.hpp"
 #include "../WorkspaceObject.hpp"
 #include "../WorkspaceObject_Impl.hpp"
+#include "../WorkspaceWatcher.hpp"
 #include "../ValidityEnums.hpp"
 #include "../../core/Enum.hpp"
 #include "../../core/Optional.hpp"
@@ -18,6 +19,9 @@
 #include "../../idd/IddEnums.hpp"
 #include <utilities/idd/IddEnums.hxx>
 #include <utilities/idd/IddFactory.hxx>
+#include <utilities/idd/OS_Space_FieldEnums.hxx>
+
+#include <memory>
 
 //#include <iostream>
 
@@ -89,6 +93,103 @@ static void BM_WorkspaceSetNameWithoutAnyChecks(benchmark::State& state) {
   state.SetComplexityN(state.range(0));
 }
 
+// Adding N objects of the same type, each of which has to be given a unique name
+static void BM_WorkspaceAddNamedObjects(benchmark::State& state) {
+
+  for (auto _ : state) {
+    Workspace w = setUpMinimalWorkspace(state.range(0));
+    benchmark::DoNotOptimize(w);
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_WorkspaceGetObjectByTypeAndName(benchmark::State& state) {
+  Workspace w = setUpWorkspaceWithNObjectsOfEveryType(state.range(0));
+  std::vector<std::string> names;
+  for (const auto& obj : w.getObjectsByType(IddObjectType::OS_Space)) {
+    names.push_back(obj.nameString());
+  }
+
+  for (auto _ : state) {
+    for (const auto& name : names) {
+      benchmark::DoNotOptimize(w.getObjectByTypeAndName(IddObjectType::OS_Space, name));
+    }
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+// Swapping the space type of N spaces back and forth, with observers of the workspace standing in for the
+// caches (loops, schedules, watchers) that a model connects to its onChange signal
+void swapSpaceTypes(Workspace& w, const Handle& spaceType1, const Handle& spaceType2) {
+  for (auto& obj : w.getObjectsByType(IddObjectType::OS_Space)) {
+    obj.setPointer(OS_SpaceFields::SpaceTypeName, spaceType1);
+    obj.setPointer(OS_SpaceFields::SpaceTypeName, spaceType2);
+  }
+}
+
+// A watcher that refreshes a small cache on every change, as the model caches of its building or facility do
+class CachingWorkspaceWatcher : public WorkspaceWatcher
+{
+ public:
+  explicit CachingWorkspaceWatcher(const Workspace& workspace) : WorkspaceWatcher(workspace), m_workspace(workspace) {}
+
+  void onChangeWorkspace() override {
+    m_numSpaceTypes = m_workspace.getObjectsByType(IddObjectType::OS_SpaceType).size();
+  }
+
+ private:
+  Workspace m_workspace;
+  size_t m_numSpaceTypes = 0;
+};
+
+static void BM_WorkspaceSetPointers(benchmark::State& state, bool batchEdit, bool caching) {
+  Workspace w = setUpMinimalWorkspace(state.range(0));
+  Handle spaceType1 = w.addObject(IdfObject(IddObjectType::OS_SpaceType))->handle();
+  Handle spaceType2 = w.addObject(IdfObject(IddObjectType::OS_SpaceType))->handle();
+  std::vector<std::unique_ptr<WorkspaceWatcher>> watchers;
+  for (int i = 0; i < 100; ++i) {
+    if (caching) {
+      watchers.push_back(std::make_unique<CachingWorkspaceWatcher>(w));
+    } else {
+      watchers.push_back(std::make_unique<WorkspaceWatcher>(w));
+    }
+  }
+
+  for (auto _ : state) {
+    if (batchEdit) {
+      Workspace::BatchEdit batch(w);
+      swapSpaceTypes(w, spaceType1, spaceType2);
+    } else {
+      swapSpaceTypes(w, spaceType1, spaceType2);
+    }
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+// What a batch edit could still save by deferring the reverse pointer updates to its end: the same number of
+// field changes on N spaces without any observers, once on the space type pointer and once on a plain number field
+static void BM_WorkspaceSetFields(benchmark::State& state, bool pointers) {
+  Workspace w = setUpMinimalWorkspace(state.range(0));
+  Handle spaceType1 = w.addObject(IdfObject(IddObjectType::OS_SpaceType))->handle();
+  Handle spaceType2 = w.addObject(IdfObject(IddObjectType::OS_SpaceType))->handle();
+
+  for (auto _ : state) {
+    if (pointers) {
+      swapSpaceTypes(w, spaceType1, spaceType2);
+    } else {
+      for (auto& obj : w.getObjectsByType(IddObjectType::OS_Space)) {
+        obj.setDouble(OS_SpaceFields::XOrigin, 1.0);
+        obj.setDouble(OS_SpaceFields::XOrigin, 2.0);
+      }
+    }
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
 // Regular run, with n=512
 /*
 BENCHMARK(BM_WorkspaceSetNameWithChecks)->Unit(benchmark::kMillisecond)->Arg(512);
@@ -99,3 +200,15 @@ BENCHMARK(BM_WorkspaceSetNameWithoutAnyChecks)->Unit(benchmark::kMillisecond)->A
 BENCHMARK(BM_WorkspaceSetNameWithChecks)->Unit(benchmark::kMillisecond)->RangeMultiplier(8)->Range(2, 2048)->Complexity();
 
 BENCHMARK(BM_WorkspaceSetNameWithoutAnyChecks)->Unit(benchmark::kMillisecond)->RangeMultiplier(8)->Range(2, 2048)->Complexity();
+
+BENCHMARK(BM_WorkspaceAddNamedObjects)->Unit(benchmark::kMillisecond)->RangeMultiplier(8)->Range(2, 2048)->Complexity();
+
+BENCHMARK(BM_WorkspaceGetObjectByTypeAndName)->Unit(benchmark::kMillisecond)->RangeMultiplier(8)->Range(2, 2048)->Complexity();
+
+BENCHMARK_CAPTURE(BM_WorkspaceSetPointers, Eager, false, false)->Unit(benchmark::kMillisecond)->RangeMultiplier(8)->Range(8, 4096)->Complexity();
+BENCHMARK_CAPTURE(BM_WorkspaceSetPointers, BatchEdit, true, false)->Unit(benchmark::kMillisecond)->RangeMultiplier(8)->Range(8, 4096)->Complexity();
+BENCHMARK_CAPTURE(BM_WorkspaceSetPointers, EagerCaching, false, true)->Unit(benchmark::kMillisecond)->RangeMultiplier(8)->Range(8, 4096)->Complexity();
+BENCHMARK_CAPTURE(BM_WorkspaceSetPointers, BatchEditCaching, true, true)->Unit(benchmark::kMillisecond)->RangeMultiplier(8)->Range(8, 4096)->Complexity();
+
+BENCHMARK_CAPTURE(BM_WorkspaceSetFields, Pointers, true)->Unit(benchmark::kMillisecond)->RangeMultiplier(8)->Range(8, 4096)->Complexity();
+BENCHMARK_CAPTURE(BM_WorkspaceSetFields, Doubles, false)->Unit(benchmark::kMillisecond)->RangeMultiplier(8)->Range(8, 4096)->Complexity();
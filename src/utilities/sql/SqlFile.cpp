@@ -2147,6 +2147,12 @@ TimeSeriesVector SqlFile::timeSeries(const SqlFileTimeSeriesQuery& query) {
   return result;
 }
 
+void SqlFile::cacheTimeSeries(const std::string& envPeriod, const std::string& reportingFrequency, const std::vector<std::string>& timeSeriesNames) {
+  if (m_impl) {
+    m_impl->cacheTimeSeries(envPeriod, reportingFrequency, timeSeriesNames);
+  }
+}
+
 boost::optional<std::pair<DateTime, DateTime>> SqlFile::daylightSavingsPeriod() const {
   boost::optional<std::pair<DateTime, DateTime>> result;
   if (m_impl) {
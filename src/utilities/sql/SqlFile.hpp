@@ -1135,6 +1135,12 @@ class UTILITIES_API SqlFile
    *  down by ReportingFrequency and determine how many TimeSeries will be returned. */
   std::vector<TimeSeries> timeSeries(const SqlFileTimeSeriesQuery& query);
 
+  /** Reads the time series of all key values of timeSeriesNames for envPeriod and reportingFrequency at once. The
+   *  Time table of the environment period is only read once and the values of every series go through the same
+   *  statement. Subsequent calls to timeSeries for these series return them without reading the file again, which is
+   *  much faster than querying many series one by one. */
+  void cacheTimeSeries(const std::string& envPeriod, const std::string& reportingFrequency, const std::vector<std::string>& timeSeriesNames);
+
   //@}
   /** @name Illuminance Map Interface */
   //@{
@@ -14,6 +14,7 @@
 #include "../core/Assert.hpp"
 #include "../core/ASCIIStrings.hpp"
 #include "../core/StringHelpers.hpp"
+#include "../core/FileCache.hpp"
 
 #include <sqlite3.h>
 
@@ -327,6 +328,8 @@ namespace detail {
 
   void SqlFile_Impl::addSimulation(const openstudio::EpwFile& t_epwFile, const openstudio::DateTime& t_simulationTime,
                                    const openstudio::Calendar& t_calendar) {
+    // the Time table is about to change
+    m_environmentPeriodTimes.clear();
     int nextSimulationIndex = getNextIndex("simulations", "SimulationIndex");
 
     std::stringstream timeStamp;
@@ -442,6 +445,8 @@ namespace detail {
   }
 
   void SqlFile_Impl::init() {
+    m_environmentPeriodTimes.clear();
+    m_annualBuildingUtilityPerformanceSummary.reset();
     m_sqliteFilename = toString(m_path.make_preferred().native());
     std::string fileName = m_sqliteFilename;
 
@@ -803,6 +808,24 @@ namespace detail {
   }
 
   void SqlFile_Impl::retrieveDataDictionary() {
+    // files already opened in this process, e.g. by several measures of the same workflow, the copy only holds the entries
+    // read from the file, time series cached later on by timeSeries() stay with each SqlFile
+    static FileCache<std::shared_ptr<const DataDictionaryTable>> cache(32);
+
+    boost::optional<FileCacheKey> key = fileCacheKey(m_path);
+    if (key) {
+      if (auto cached = cache.find(*key)) {
+        // like the queries below, entries already there after a reopen are kept
+        if (m_dataDictionary.empty()) {
+          m_dataDictionary = **cached;
+        } else {
+          m_dataDictionary.insert((*cached)->begin(), (*cached)->end());
+        }
+        LOG(Debug, "Dictionary Built");
+        return;
+      }
+    }
+
     std::string table;
     std::string name;
     std::string keyValue;
@@ -879,6 +902,10 @@ namespace detail {
       }
       sqlite3_finalize(sqlStmtPtr);
     }
+
+    if (key) {
+      cache.insert(std::move(*key), std::make_shared<const DataDictionaryTable>(m_dataDictionary));
+    }
     LOG(Debug, "Dictionary Built");
   }
 
@@ -923,6 +950,58 @@ namespace detail {
     return execAndReturnFirstDouble(s, reportName, rowName, columnName);
   }
 
+  /// all values of the AnnualBuildingUtilityPerformanceSummary report, read with one query and shared by SqlFiles opened on the same file
+  std::shared_ptr<const SqlFile_Impl::AnnualBuildingUtilityPerformanceSummary> SqlFile_Impl::annualBuildingUtilityPerformanceSummary() const {
+    if (m_annualBuildingUtilityPerformanceSummary) {
+      return m_annualBuildingUtilityPerformanceSummary;
+    }
+
+    // files already read in this process, e.g. by another measure of the same workflow, entries are small
+    static FileCache<std::shared_ptr<const AnnualBuildingUtilityPerformanceSummary>> cache(1000);
+
+    boost::optional<FileCacheKey> key = fileCacheKey(m_path);
+    if (key) {
+      if (auto cached = cache.find(*key)) {
+        m_annualBuildingUtilityPerformanceSummary = *cached;
+        return m_annualBuildingUtilityPerformanceSummary;
+      }
+    }
+
+    auto result = std::make_shared<AnnualBuildingUtilityPerformanceSummary>();
+    if (m_db) {
+      const std::string s = "SELECT TableName, ColumnName, RowName, Units, Value FROM TabularDataWithStrings "
+                            "WHERE ReportName = 'AnnualBuildingUtilityPerformanceSummary' AND ReportForString = 'Entire Facility'";
+      sqlite3_stmt* sqlStmtPtr = nullptr;
+      if (sqlite3_prepare_v2(m_db, s.c_str(), -1, &sqlStmtPtr, nullptr) == SQLITE_OK) {
+        while (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
+          // keep the first row like a query for a single value would
+          result->emplace(std::make_tuple(columnText(sqlite3_column_text(sqlStmtPtr, 0)), columnText(sqlite3_column_text(sqlStmtPtr, 1)),
+                                          columnText(sqlite3_column_text(sqlStmtPtr, 2)), columnText(sqlite3_column_text(sqlStmtPtr, 3))),
+                          sqlite3_column_double(sqlStmtPtr, 4));
+        }
+      }
+      // must finalize to prevent memory leaks
+      sqlite3_finalize(sqlStmtPtr);
+    }
+
+    if (key) {
+      m_annualBuildingUtilityPerformanceSummary = cache.insert(std::move(*key), result);
+      return m_annualBuildingUtilityPerformanceSummary;
+    }
+    m_annualBuildingUtilityPerformanceSummary = result;
+    return m_annualBuildingUtilityPerformanceSummary;
+  }
+
+  boost::optional<double> SqlFile_Impl::annualBuildingUtilityPerformanceSummaryValue(const std::string& tableName, const std::string& columnName,
+                                                                                   const std::string& rowName, const std::string& units) const {
+    std::shared_ptr<const AnnualBuildingUtilityPerformanceSummary> values = annualBuildingUtilityPerformanceSummary();
+    auto it = values->find(std::make_tuple(tableName, columnName, rowName, units));
+    if (it == values->end()) {
+      return boost::none;
+    }
+    return it->second;
+  }
+
   /// hours simulated
   boost::optional<double> SqlFile_Impl::hoursSimulated() const {
     const std::string& s = R"(SELECT Value FROM TabularDataWithStrings
@@ -953,14 +1032,7 @@ namespace detail {
       LOG(Warn, "Reporting Net Site Energy with " << *hours << " hrs");
     }
 
-    std::string s = R"(SELECT Value FROM TabularDataWithStrings
-                           WHERE ReportName='AnnualBuildingUtilityPerformanceSummary'
-                           AND ReportForString='Entire Facility'
-                           AND TableName='Site and Source Energy'
-                           AND RowName='Net Site Energy'
-                           AND ColumnName='Total Energy'
-                           AND Units='GJ')";
-    boost::optional<double> d = execAndReturnFirstDouble(s);
+    boost::optional<double> d = annualBuildingUtilityPerformanceSummaryValue("Site and Source Energy", "Total Energy", "Net Site Energy", "GJ");
 
     if (!d) {
       LOG(Warn, "Tabular results were not found, trying to calculate it ourselves");
@@ -983,14 +1055,7 @@ namespace detail {
       LOG(Warn, "Reporting Net Source Energy with " << *hours << " hrs");
     }
 
-    const std::string& s = R"(SELECT Value FROM TabularDataWithStrings
-                                  WHERE ReportName='AnnualBuildingUtilityPerformanceSummary'
-                                  AND ReportForString='Entire Facility'
-                                  AND TableName='Site and Source Energy'
-                                  AND RowName='Net Source Energy'
-                                  AND ColumnName='Total Energy'
-                                  AND Units='GJ')";
-    return execAndReturnFirstDouble(s);
+    return annualBuildingUtilityPerformanceSummaryValue("Site and Source Energy", "Total Energy", "Net Source Energy", "GJ");
   }
 
   boost::optional<double> SqlFile_Impl::totalSiteEnergy() const {
@@ -1001,14 +1066,7 @@ namespace detail {
       LOG(Warn, "Reporting Total Site Energy with " << *hours << " hrs");
     }
 
-    const std::string& s = R"(SELECT Value FROM TabularDataWithStrings
-                                  WHERE ReportName='AnnualBuildingUtilityPerformanceSummary'
-                                  AND ReportForString='Entire Facility'
-                                  AND TableName='Site and Source Energy'
-                                  AND RowName='Total Site Energy'
-                                  AND ColumnName='Total Energy'
-                                  AND Units='GJ')";
-    return execAndReturnFirstDouble(s);
+    return annualBuildingUtilityPerformanceSummaryValue("Site and Source Energy", "Total Energy", "Total Site Energy", "GJ");
   }
 
   boost::optional<double> SqlFile_Impl::totalSourceEnergy() const {
@@ -1019,14 +1077,7 @@ namespace detail {
       LOG(Warn, "Reporting Total Source Energy with " << *hours << " hrs");
     }
 
-    const std::string& s = R"(SELECT Value FROM TabularDataWithStrings
-                                  WHERE ReportName='AnnualBuildingUtilityPerformanceSummary'
-                                  AND ReportForString='Entire Facility'
-                                  AND TableName='Site and Source Energy'
-                                  AND RowName='Total Source Energy'
-                                  AND ColumnName='Total Energy'
-                                  AND Units='GJ')";
-    return execAndReturnFirstDouble(s);
+    return annualBuildingUtilityPerformanceSummaryValue("Site and Source Energy", "Total Energy", "Total Source Energy", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::annualTotalCost(const FuelType& fuel) const {
@@ -1270,11 +1321,8 @@ namespace detail {
       std::string units = result.getUnitsForFuelType(fuelType);
       for (EndUseCategoryType category : result.categories()) {
 
-        std::string query = "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and "
-                            "(ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='"
-                            + fuelType.valueDescription() + "') and (RowName ='" + category.valueDescription() + "') and (Units = '" + units + "')";
-
-        boost::optional<double> value = execAndReturnFirstDouble(query);
+        boost::optional<double> value =
+          annualBuildingUtilityPerformanceSummaryValue("End Uses", fuelType.valueDescription(), category.valueDescription(), units);
         OS_ASSERT(value);
 
         if (*value != 0.0) {
@@ -1287,992 +1335,662 @@ namespace detail {
   }
 
   OptionalDouble SqlFile_Impl::electricityHeating() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Heating') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Electricity", "Heating", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityCooling() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Cooling') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Electricity", "Cooling", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityInteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Interior Lighting') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Electricity", "Interior Lighting", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityExteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Exterior Lighting') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Electricity", "Exterior Lighting", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityInteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Interior Equipment') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Electricity", "Interior Equipment", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityExteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Exterior Equipment') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Electricity", "Exterior Equipment", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityFans() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Fans') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Electricity", "Fans", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityPumps() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Pumps') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Electricity", "Pumps", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityHeatRejection() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Electricity", "Heat Rejection", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityHumidification() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Humidification') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Electricity", "Humidification", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityHeatRecovery() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Electricity", "Heat Recovery", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityWaterSystems() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Water Systems') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Electricity", "Water Systems", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityRefrigeration() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Refrigeration') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Electricity", "Refrigeration", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityGenerators() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Generators') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Electricity", "Generators", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityTotalEndUses() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Total End Uses') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Electricity", "Total End Uses", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasHeating() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Heating') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Natural Gas", "Heating", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasCooling() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Cooling') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Natural Gas", "Cooling", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasInteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Natural Gas", "Interior Lighting", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasExteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Natural Gas", "Exterior Lighting", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasInteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Natural Gas", "Interior Equipment", "GJ");
   }
   OptionalDouble SqlFile_Impl::naturalGasExteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Natural Gas", "Exterior Equipment", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasFans() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Fans') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Natural Gas", "Fans", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasPumps() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Pumps') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Natural Gas", "Pumps", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasHeatRejection() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Natural Gas", "Heat Rejection", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasHumidification() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Humidification') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Natural Gas", "Humidification", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasHeatRecovery() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Natural Gas", "Heat Recovery", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasWaterSystems() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Water Systems') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Natural Gas", "Water Systems", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasRefrigeration() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Refrigeration') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Natural Gas", "Refrigeration", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasGenerators() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Generators') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Natural Gas", "Generators", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasTotalEndUses() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Total End Uses') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Natural Gas", "Total End Uses", "GJ");
   }
 
   /* Gasoline */
   OptionalDouble SqlFile_Impl::gasolineHeating() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Gasoline') and (RowName ='Heating') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Gasoline", "Heating", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::gasolineCooling() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Gasoline') and (RowName ='Cooling') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Gasoline", "Cooling", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::gasolineInteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Gasoline') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Gasoline", "Interior Lighting", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::gasolineExteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Gasoline') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Gasoline", "Exterior Lighting", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::gasolineInteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Gasoline') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Gasoline", "Interior Equipment", "GJ");
   }
   OptionalDouble SqlFile_Impl::gasolineExteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Gasoline') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Gasoline", "Exterior Equipment", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::gasolineFans() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Gasoline') and (RowName ='Fans') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Gasoline", "Fans", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::gasolinePumps() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Gasoline') and (RowName ='Pumps') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Gasoline", "Pumps", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::gasolineHeatRejection() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Gasoline') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Gasoline", "Heat Rejection", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::gasolineHumidification() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Gasoline') and (RowName ='Humidification') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Gasoline", "Humidification", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::gasolineHeatRecovery() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Gasoline') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Gasoline", "Heat Recovery", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::gasolineWaterSystems() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Gasoline') and (RowName ='Water Systems') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Gasoline", "Water Systems", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::gasolineRefrigeration() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Gasoline') and (RowName ='Refrigeration') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Gasoline", "Refrigeration", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::gasolineGenerators() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Gasoline') and (RowName ='Generators') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Gasoline", "Generators", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::gasolineTotalEndUses() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Gasoline') and (RowName ='Total End Uses') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Gasoline", "Total End Uses", "GJ");
   }
 
   /* Diesel */
   OptionalDouble SqlFile_Impl::dieselHeating() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Diesel') and (RowName ='Heating') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Diesel", "Heating", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::dieselCooling() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Diesel') and (RowName ='Cooling') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Diesel", "Cooling", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::dieselInteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Diesel') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Diesel", "Interior Lighting", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::dieselExteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Diesel') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Diesel", "Exterior Lighting", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::dieselInteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Diesel') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Diesel", "Interior Equipment", "GJ");
   }
   OptionalDouble SqlFile_Impl::dieselExteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Diesel') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Diesel", "Exterior Equipment", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::dieselFans() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Diesel') and (RowName ='Fans') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Diesel", "Fans", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::dieselPumps() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Diesel') and (RowName ='Pumps') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Diesel", "Pumps", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::dieselHeatRejection() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Diesel') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Diesel", "Heat Rejection", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::dieselHumidification() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Diesel') and (RowName ='Humidification') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Diesel", "Humidification", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::dieselHeatRecovery() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Diesel') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Diesel", "Heat Recovery", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::dieselWaterSystems() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Diesel') and (RowName ='Water Systems') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Diesel", "Water Systems", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::dieselRefrigeration() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Diesel') and (RowName ='Refrigeration') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Diesel", "Refrigeration", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::dieselGenerators() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Diesel') and (RowName ='Generators') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Diesel", "Generators", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::dieselTotalEndUses() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Diesel') and (RowName ='Total End Uses') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Diesel", "Total End Uses", "GJ");
   }
 
   /* Coal */
   OptionalDouble SqlFile_Impl::coalHeating() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Coal') and (RowName ='Heating') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Coal", "Heating", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::coalCooling() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Coal') and (RowName ='Cooling') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Coal", "Cooling", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::coalInteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Coal') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Coal", "Interior Lighting", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::coalExteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Coal') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Coal", "Exterior Lighting", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::coalInteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Coal') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Coal", "Interior Equipment", "GJ");
   }
   OptionalDouble SqlFile_Impl::coalExteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Coal') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Coal", "Exterior Equipment", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::coalFans() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Coal') and (RowName ='Fans') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Coal", "Fans", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::coalPumps() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Coal') and (RowName ='Pumps') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Coal", "Pumps", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::coalHeatRejection() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Coal') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Coal", "Heat Rejection", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::coalHumidification() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Coal') and (RowName ='Humidification') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Coal", "Humidification", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::coalHeatRecovery() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Coal') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Coal", "Heat Recovery", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::coalWaterSystems() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Coal') and (RowName ='Water Systems') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Coal", "Water Systems", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::coalRefrigeration() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Coal') and (RowName ='Refrigeration') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Coal", "Refrigeration", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::coalGenerators() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Coal') and (RowName ='Generators') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Coal", "Generators", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::coalTotalEndUses() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Coal') and (RowName ='Total End Uses') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Coal", "Total End Uses", "GJ");
   }
 
   /* Fuel Oil No 1 */
   OptionalDouble SqlFile_Impl::fuelOilNo1Heating() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 1') and (RowName ='Heating') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Fuel Oil No 1", "Heating", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo1Cooling() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 1') and (RowName ='Cooling') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Fuel Oil No 1", "Cooling", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo1InteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 1') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Fuel Oil No 1", "Interior Lighting", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo1ExteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 1') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Fuel Oil No 1", "Exterior Lighting", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo1InteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 1') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Fuel Oil No 1", "Interior Equipment", "GJ");
   }
   OptionalDouble SqlFile_Impl::fuelOilNo1ExteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 1') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Fuel Oil No 1", "Exterior Equipment", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo1Fans() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 1') and (RowName ='Fans') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Fuel Oil No 1", "Fans", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo1Pumps() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 1') and (RowName ='Pumps') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Fuel Oil No 1", "Pumps", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo1HeatRejection() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 1') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Fuel Oil No 1", "Heat Rejection", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo1Humidification() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 1') and (RowName ='Humidification') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Fuel Oil No 1", "Humidification", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo1HeatRecovery() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 1') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Fuel Oil No 1", "Heat Recovery", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo1WaterSystems() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 1') and (RowName ='Water Systems') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Fuel Oil No 1", "Water Systems", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo1Refrigeration() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 1') and (RowName ='Refrigeration') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Fuel Oil No 1", "Refrigeration", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo1Generators() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 1') and (RowName ='Generators') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Fuel Oil No 1", "Generators", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo1TotalEndUses() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 1') and (RowName ='Total End Uses') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Fuel Oil No 1", "Total End Uses", "GJ");
   }
 
   /* Fuel Oil No 2 */
   OptionalDouble SqlFile_Impl::fuelOilNo2Heating() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 2') and (RowName ='Heating') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Fuel Oil No 2", "Heating", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo2Cooling() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 2') and (RowName ='Cooling') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Fuel Oil No 2", "Cooling", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo2InteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 2') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Fuel Oil No 2", "Interior Lighting", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo2ExteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 2') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Fuel Oil No 2", "Exterior Lighting", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo2InteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 2') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Fuel Oil No 2", "Interior Equipment", "GJ");
   }
   OptionalDouble SqlFile_Impl::fuelOilNo2ExteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 2') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Fuel Oil No 2", "Exterior Equipment", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo2Fans() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 2') and (RowName ='Fans') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Fuel Oil No 2", "Fans", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo2Pumps() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 2') and (RowName ='Pumps') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Fuel Oil No 2", "Pumps", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo2HeatRejection() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 2') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Fuel Oil No 2", "Heat Rejection", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo2Humidification() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 2') and (RowName ='Humidification') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Fuel Oil No 2", "Humidification", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo2HeatRecovery() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 2') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Fuel Oil No 2", "Heat Recovery", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo2WaterSystems() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 2') and (RowName ='Water Systems') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Fuel Oil No 2", "Water Systems", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo2Refrigeration() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 2') and (RowName ='Refrigeration') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Fuel Oil No 2", "Refrigeration", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo2Generators() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 2') and (RowName ='Generators') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Fuel Oil No 2", "Generators", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo2TotalEndUses() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 2') and (RowName ='Total End Uses') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Fuel Oil No 2", "Total End Uses", "GJ");
   }
 
   /* Propane */
   OptionalDouble SqlFile_Impl::propaneHeating() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Propane') and (RowName ='Heating') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Propane", "Heating", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::propaneCooling() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Propane') and (RowName ='Cooling') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Propane", "Cooling", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::propaneInteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Propane') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Propane", "Interior Lighting", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::propaneExteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Propane') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Propane", "Exterior Lighting", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::propaneInteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Propane') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Propane", "Interior Equipment", "GJ");
   }
   OptionalDouble SqlFile_Impl::propaneExteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Propane') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Propane", "Exterior Equipment", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::propaneFans() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Propane') and (RowName ='Fans') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Propane", "Fans", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::propanePumps() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Propane') and (RowName ='Pumps') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Propane", "Pumps", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::propaneHeatRejection() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Propane') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Propane", "Heat Rejection", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::propaneHumidification() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Propane') and (RowName ='Humidification') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Propane", "Humidification", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::propaneHeatRecovery() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Propane') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Propane", "Heat Recovery", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::propaneWaterSystems() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Propane') and (RowName ='Water Systems') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Propane", "Water Systems", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::propaneRefrigeration() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Propane') and (RowName ='Refrigeration') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Propane", "Refrigeration", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::propaneGenerators() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Propane') and (RowName ='Generators') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Propane", "Generators", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::propaneTotalEndUses() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Propane') and (RowName ='Total End Uses') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Propane", "Total End Uses", "GJ");
   }
 
   /* Other Fuel 1 */
   OptionalDouble SqlFile_Impl::otherFuel1Heating() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 1') and (RowName ='Heating') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Other Fuel 1", "Heating", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel1Cooling() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 1') and (RowName ='Cooling') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Other Fuel 1", "Cooling", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel1InteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 1') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Other Fuel 1", "Interior Lighting", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel1ExteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 1') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Other Fuel 1", "Exterior Lighting", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel1InteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 1') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Other Fuel 1", "Interior Equipment", "GJ");
   }
   OptionalDouble SqlFile_Impl::otherFuel1ExteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 1') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Other Fuel 1", "Exterior Equipment", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel1Fans() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 1') and (RowName ='Fans') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Other Fuel 1", "Fans", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel1Pumps() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 1') and (RowName ='Pumps') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Other Fuel 1", "Pumps", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel1HeatRejection() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 1') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Other Fuel 1", "Heat Rejection", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel1Humidification() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 1') and (RowName ='Humidification') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Other Fuel 1", "Humidification", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel1HeatRecovery() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 1') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Other Fuel 1", "Heat Recovery", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel1WaterSystems() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 1') and (RowName ='Water Systems') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Other Fuel 1", "Water Systems", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel1Refrigeration() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 1') and (RowName ='Refrigeration') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Other Fuel 1", "Refrigeration", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel1Generators() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 1') and (RowName ='Generators') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Other Fuel 1", "Generators", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel1TotalEndUses() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 1') and (RowName ='Total End Uses') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Other Fuel 1", "Total End Uses", "GJ");
   }
 
   /* Other Fuel 2 */
   OptionalDouble SqlFile_Impl::otherFuel2Heating() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 2') and (RowName ='Heating') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Other Fuel 2", "Heating", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel2Cooling() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 2') and (RowName ='Cooling') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Other Fuel 2", "Cooling", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel2InteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 2') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Other Fuel 2", "Interior Lighting", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel2ExteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 2') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Other Fuel 2", "Exterior Lighting", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel2InteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 2') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Other Fuel 2", "Interior Equipment", "GJ");
   }
   OptionalDouble SqlFile_Impl::otherFuel2ExteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 2') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Other Fuel 2", "Exterior Equipment", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel2Fans() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 2') and (RowName ='Fans') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Other Fuel 2", "Fans", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel2Pumps() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 2') and (RowName ='Pumps') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Other Fuel 2", "Pumps", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel2HeatRejection() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 2') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Other Fuel 2", "Heat Rejection", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel2Humidification() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 2') and (RowName ='Humidification') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Other Fuel 2", "Humidification", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel2HeatRecovery() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 2') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Other Fuel 2", "Heat Recovery", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel2WaterSystems() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 2') and (RowName ='Water Systems') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Other Fuel 2", "Water Systems", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel2Refrigeration() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 2') and (RowName ='Refrigeration') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Other Fuel 2", "Refrigeration", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel2Generators() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 2') and (RowName ='Generators') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Other Fuel 2", "Generators", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel2TotalEndUses() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 2') and (RowName ='Total End Uses') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Other Fuel 2", "Total End Uses", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingHeating() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Heating') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Cooling", "Heating", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingCooling() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Cooling') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Cooling", "Cooling", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingInteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Cooling", "Interior Lighting", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingExteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Cooling", "Exterior Lighting", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingInteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Cooling", "Interior Equipment", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingExteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Cooling", "Exterior Equipment", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingFans() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Fans') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Cooling", "Fans", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingPumps() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Pumps') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Cooling", "Pumps", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingHeatRejection() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Cooling", "Heat Rejection", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingHumidification() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Humidification') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Cooling", "Humidification", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingHeatRecovery() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Cooling", "Heat Recovery", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingWaterSystems() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Water Systems') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Cooling", "Water Systems", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingRefrigeration() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Refrigeration') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Cooling", "Refrigeration", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingGenerators() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Generators') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Cooling", "Generators", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingTotalEndUses() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Total End Uses') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Cooling", "Total End Uses", "GJ");
   }
 
   OptionalDouble addTwoOptionalDoubles(OptionalDouble val1_, OptionalDouble val2_) {
@@ -2349,273 +2067,183 @@ namespace detail {
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingWaterHeating() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Water') and (RowName ='Heating') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Heating Water", "Heating", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingWaterCooling() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Water') and (RowName ='Cooling') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Heating Water", "Cooling", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingWaterInteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Water') and (RowName ='Interior Lights') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Heating Water", "Interior Lights", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingWaterExteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Water') and (RowName ='Exterior Lights') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Heating Water", "Exterior Lights", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingWaterInteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Water') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Heating Water", "Interior Equipment", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingWaterExteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Water') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Heating Water", "Exterior Equipment", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingWaterFans() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Water') and (RowName ='Fans') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Heating Water", "Fans", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingWaterPumps() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Water') and (RowName ='Pumps') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Heating Water", "Pumps", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingWaterHeatRejection() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Water') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Heating Water", "Heat Rejection", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingWaterHumidification() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Water') and (RowName ='Humidification') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Heating Water", "Humidification", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingWaterHeatRecovery() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Water') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Heating Water", "Heat Recovery", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingWaterWaterSystems() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Water') and (RowName ='Water Systems') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Heating Water", "Water Systems", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingWaterRefrigeration() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Water') and (RowName ='Refrigeration') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Heating Water", "Refrigeration", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingWaterGenerators() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Water') and (RowName ='Generators') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Heating Water", "Generators", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingWaterTotalEndUses() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Water') and (RowName ='Total End Uses') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Heating Water", "Total End Uses", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingSteamHeating() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Steam') and (RowName ='Heating') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Heating Steam", "Heating", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingSteamCooling() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Steam') and (RowName ='Cooling') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Heating Steam", "Cooling", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingSteamInteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Steam') and (RowName ='Interior Lights') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Heating Steam", "Interior Lights", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingSteamExteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Steam') and (RowName ='Exterior Lights') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Heating Steam", "Exterior Lights", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingSteamInteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Steam') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Heating Steam", "Interior Equipment", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingSteamExteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Steam') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Heating Steam", "Exterior Equipment", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingSteamFans() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Steam') and (RowName ='Fans') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Heating Steam", "Fans", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingSteamPumps() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Steam') and (RowName ='Pumps') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Heating Steam", "Pumps", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingSteamHeatRejection() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Steam') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Heating Steam", "Heat Rejection", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingSteamHumidification() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Steam') and (RowName ='Humidification') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Heating Steam", "Humidification", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingSteamHeatRecovery() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Steam') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Heating Steam", "Heat Recovery", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingSteamWaterSystems() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Steam') and (RowName ='Water Systems') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Heating Steam", "Water Systems", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingSteamRefrigeration() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Steam') and (RowName ='Refrigeration') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Heating Steam", "Refrigeration", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingSteamGenerators() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Steam') and (RowName ='Generators') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Heating Steam", "Generators", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingSteamTotalEndUses() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Steam') and (RowName ='Total End Uses') and (Units = 'GJ')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "District Heating Steam", "Total End Uses", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::waterHeating() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Heating') and (Units = 'm3')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Water", "Heating", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterCooling() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Cooling') and (Units = 'm3')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Water", "Cooling", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterInteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Interior Lighting') and (Units = 'm3')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Water", "Interior Lighting", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterExteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Exterior Lighting') and (Units = 'm3')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Water", "Exterior Lighting", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterInteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Interior Equipment') and (Units = 'm3')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Water", "Interior Equipment", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterExteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Exterior Equipment') and (Units = 'm3')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Water", "Exterior Equipment", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterFans() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Fans') and (Units = 'm3')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Water", "Fans", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterPumps() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Pumps') and (Units = 'm3')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Water", "Pumps", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterHeatRejection() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Heat Rejection') and (Units = 'm3')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Water", "Heat Rejection", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterHumidification() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Humidification') and (Units = 'm3')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Water", "Humidification", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterHeatRecovery() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Heat Recovery') and (Units = 'm3')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Water", "Heat Recovery", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterWaterSystems() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Water Systems') and (Units = 'm3')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Water", "Water Systems", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterRefrigeration() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Refrigeration') and (Units = 'm3')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Water", "Refrigeration", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterGenerators() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Generators') and (Units = 'm3')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Water", "Generators", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterTotalEndUses() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Total End Uses') and (Units = 'm3')");
+    return annualBuildingUtilityPerformanceSummaryValue("End Uses", "Water", "Total End Uses", "m3");
   }
 
   OptionalDouble SqlFile_Impl::hoursHeatingSetpointNotMet() const {
@@ -2668,6 +2296,8 @@ namespace detail {
     openstudio::OptionalTimeSeries ts;
 
     std::vector<std::string> vecKeyValues = availableKeyValues(envPeriod, reportingFrequency, timeSeriesName);
+    // read all key values at once, the lookups below then find them in the data dictionary
+    cacheTimeSeries(envPeriod, reportingFrequency, {timeSeriesName});
     std::vector<std::string>::iterator iter;
     for (iter = vecKeyValues.begin(); iter != vecKeyValues.end(); ++iter) {
       ts = timeSeries(envPeriod, reportingFrequency, timeSeriesName, *iter);
@@ -2986,173 +2616,291 @@ namespace detail {
   }
 
   openstudio::OptionalTimeSeries SqlFile_Impl::timeSeries(const DataDictionaryItem& dataDictionary) {
-    openstudio::OptionalTimeSeries ts;
-    std::string units = dataDictionary.units;
+    return timeSeries(std::vector<DataDictionaryItem>{dataDictionary}).front();
+  }
 
-    boost::optional<openstudio::DateTime> firstReportDateTime;
-    std::vector<long> stdSecondsFromFirstReport;
-    stdSecondsFromFirstReport.reserve(8760);
+  const SqlFile_Impl::TimeRow* SqlFile_Impl::EnvironmentPeriodTimes::find(int timeIndex) const {
+    if ((timeIndex < firstTimeIndex) || (timeIndex - firstTimeIndex >= static_cast<int>(rows.size()))) {
+      return nullptr;
+    }
+    const TimeRow& row = rows[timeIndex - firstTimeIndex];
+    return row.valid ? &row : nullptr;
+  }
 
-    std::vector<double> stdValues;
-    stdValues.reserve(8760);
-    boost::optional<unsigned> reportingIntervalMinutes;
+  std::shared_ptr<const SqlFile_Impl::EnvironmentPeriodTimes> SqlFile_Impl::environmentPeriodTimes(int envPeriodIndex) {
+    auto it = m_environmentPeriodTimes.find(envPeriodIndex);
+    if (it != m_environmentPeriodTimes.end()) {
+      return it->second;
+    }
 
-    ReportingFrequency reportingFrequency(ReportingFrequency::RunPeriod);
-    bool isIntervalTimeSeries = false;
-    try {
-      reportingFrequency = ReportingFrequency(dataDictionary.reportingFrequency);
-      isIntervalTimeSeries = (reportingFrequency == ReportingFrequency::Timestep) || (reportingFrequency == ReportingFrequency::Hourly)
-                             || (reportingFrequency == ReportingFrequency::Daily);
+    auto result = std::make_shared<EnvironmentPeriodTimes>();
+    if (m_db) {
+      std::string statement = hasYear() ? "SELECT TimeIndex, Year, Month, Day, Interval FROM Time WHERE EnvironmentPeriodIndex = ? ORDER BY TimeIndex"
+                                        : "SELECT TimeIndex, Month, Day, Interval FROM Time WHERE EnvironmentPeriodIndex = ? ORDER BY TimeIndex";
+      sqlite3_stmt* sqlStmtPtr = nullptr;
+      if (sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr) == SQLITE_OK) {
+        sqlite3_bind_int(sqlStmtPtr, 1, envPeriodIndex);
+        while (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
+          int b = 0;
+          int timeIndex = sqlite3_column_int(sqlStmtPtr, b++);
+          if (result->rows.empty()) {
+            result->firstTimeIndex = timeIndex;
+          }
+          // rows are sorted, gaps in TimeIndex are left as invalid rows
+          result->rows.resize(timeIndex - result->firstTimeIndex + 1);
+          TimeRow& row = result->rows.back();
+          row.valid = true;
+          if (hasYear()) {
+            row.year = sqlite3_column_int(sqlStmtPtr, b++);
+          }
+          row.month = sqlite3_column_int(sqlStmtPtr, b++);
+          row.day = sqlite3_column_int(sqlStmtPtr, b++);
+          row.intervalMinutes = sqlite3_column_int(sqlStmtPtr, b++);
+        }
+      }
+      // must finalize to prevent memory leaks
+      sqlite3_finalize(sqlStmtPtr);
+    }
 
-    } catch (const std::exception&) {
+    m_environmentPeriodTimes[envPeriodIndex] = result;
+    return result;
+  }
+
+  std::vector<openstudio::OptionalTimeSeries> SqlFile_Impl::timeSeries(const std::vector<DataDictionaryItem>& dataDictionaries) {
+    std::vector<openstudio::OptionalTimeSeries> result(dataDictionaries.size());
+    if (!m_db) {
+      return result;
     }
 
-    if (m_db) {
-      std::string energyPlusVersion = this->energyPlusVersion();
-      VersionString version(energyPlusVersion);
+    VersionString version(this->energyPlusVersion());
 
-      std::stringstream s;
-      // v8.9.0 added the 'Year' field
-      s << "SELECT dt.VariableValue, ";
-      if (hasYear()) {
-        s << "Time.Year, ";
+    // last series built for each environment period and reporting frequency, the next series reporting at the same
+    // time indices shares its times instead of building them again
+    struct SeriesAxis
+    {
+      std::vector<int> timeIndices;
+      boost::optional<openstudio::TimeSeries> reportingTimes;
+    };
+    std::map<std::pair<int, std::string>, SeriesAxis> seriesAxes;
+
+    // one statement per table, reset and rebound for each series
+    std::map<std::string, sqlite3_stmt*> statements;
+
+    std::vector<int> timeIndices;
+    std::vector<double> stdValues;
+
+    for (size_t i = 0; i < dataDictionaries.size(); ++i) {
+      const DataDictionaryItem& dataDictionary = dataDictionaries[i];
+
+      std::shared_ptr<const EnvironmentPeriodTimes> times = environmentPeriodTimes(dataDictionary.envPeriodIndex);
+      if (times->rows.empty()) {
+        continue;
       }
-      s << "Time.Month, Time.Day, "
-        // << "Time.Hour, Time.Minute, "
-        << "Time.Interval FROM ";
-      s << dataDictionary.table;
-      s << " dt INNER JOIN Time ON Time.timeIndex = dt.TimeIndex";
-      s << " WHERE ";
-      if (dataDictionary.table == "ReportMeterData") {
-        s << " dt.ReportMeterDataDictionaryIndex=";
-      } else if (dataDictionary.table == "ReportVariableData") {
-        s << " dt.ReportVariableDataDictionaryIndex=";
+
+      sqlite3_stmt*& sqlStmtPtr = statements[dataDictionary.table];
+      if (!sqlStmtPtr) {
+        std::string s = "SELECT dt.TimeIndex, dt.VariableValue FROM " + dataDictionary.table + " dt WHERE ";
+        if (dataDictionary.table == "ReportMeterData") {
+          s += "dt.ReportMeterDataDictionaryIndex = ?";
+        } else {
+          s += "dt.ReportVariableDataDictionaryIndex = ?";
+        }
+        s += " AND dt.TimeIndex BETWEEN ? AND ?";
+        int code = sqlite3_prepare_v2(m_db, s.c_str(), -1, &sqlStmtPtr, nullptr);
+        LOG(Debug, "SQL Query:" << '\n' << s << '\n' << "Return Code:" << '\n' << code);
+        if (code != SQLITE_OK) {
+          sqlite3_finalize(sqlStmtPtr);
+          sqlStmtPtr = nullptr;
+          continue;
+        }
+      } else {
+        sqlite3_reset(sqlStmtPtr);
       }
-      s << boost::lexical_cast<std::string>(dataDictionary.recordIndex);
-      s << " AND Time.EnvironmentPeriodIndex = ";
-      s << boost::lexical_cast<std::string>(dataDictionary.envPeriodIndex);
+      sqlite3_bind_int(sqlStmtPtr, 1, dataDictionary.recordIndex);
+      sqlite3_bind_int(sqlStmtPtr, 2, times->firstTimeIndex);
+      sqlite3_bind_int(sqlStmtPtr, 3, times->firstTimeIndex + static_cast<int>(times->rows.size()) - 1);
 
-      sqlite3_stmt* sqlStmtPtr;
+      timeIndices.clear();
+      stdValues.clear();
+      while (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
+        int timeIndex = sqlite3_column_int(sqlStmtPtr, 0);
+        if (times->find(timeIndex)) {
+          timeIndices.push_back(timeIndex);
+          stdValues.push_back(sqlite3_column_double(sqlStmtPtr, 1));
+        }
+      }
 
-      int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+      if (timeIndices.empty()) {
+        continue;
+      }
 
-      code = sqlite3_step(sqlStmtPtr);
-      std::stringstream s2;
-      s2 << "SQL Query:" << '\n';
-      s2 << s.str();
-      s2 << "Return Code:" << '\n';
-      s2 << code;
-      LOG(Debug, s2.str());
+      // values are read into a reused buffer, then copied once into storage that a series sharing an axis takes over
+      openstudio::Vector values(stdValues.size());
+      std::copy(stdValues.begin(), stdValues.end(), values.begin());
 
-      long cumulativeSeconds = 0;
+      SeriesAxis& axis = seriesAxes[std::make_pair(dataDictionary.envPeriodIndex, dataDictionary.reportingFrequency)];
+      if (axis.reportingTimes && (axis.timeIndices == timeIndices)) {
+        result[i] = openstudio::TimeSeries(*axis.reportingTimes, std::move(values), dataDictionary.units);
+      } else {
+        axis = SeriesAxis();
+        axis.timeIndices = timeIndices;
 
-      while (code == SQLITE_ROW) {
-        int b = 0;
-        double value = sqlite3_column_double(sqlStmtPtr, b++);
-        stdValues.push_back(value);
+        boost::optional<openstudio::DateTime> firstReportDateTime;
+        std::vector<long> secondsFromFirstReport;
+        boost::optional<unsigned> reportingIntervalMinutes;
 
-        boost::optional<unsigned> year;
-        if (hasYear()) {
-          year = sqlite3_column_int(sqlStmtPtr, b++);
+        ReportingFrequency reportingFrequency(ReportingFrequency::RunPeriod);
+        bool isIntervalTimeSeries = false;
+        try {
+          reportingFrequency = ReportingFrequency(dataDictionary.reportingFrequency);
+          isIntervalTimeSeries = (reportingFrequency == ReportingFrequency::Timestep) || (reportingFrequency == ReportingFrequency::Hourly)
+                                 || (reportingFrequency == ReportingFrequency::Daily);
+
+        } catch (const std::exception&) {
+        }
+
+        secondsFromFirstReport.reserve(timeIndices.size());
+        long cumulativeSeconds = 0;
+
+        for (int timeIndex : timeIndices) {
+          const TimeRow& row = *times->find(timeIndex);
+
+          boost::optional<unsigned> year;
           // As of EnergyPlus 9.4 and perhaps earlier, the anual run periods will have a valid year,
           // however the sizing periods will have year = 0
-          if (year.get() == 0) {
-            year.reset();
+          if (hasYear() && (row.year != 0)) {
+            year = row.year;
           }
-        }
 
-        unsigned month = sqlite3_column_int(sqlStmtPtr, b++);
-        unsigned day = sqlite3_column_int(sqlStmtPtr, b++);
-
-        // In cases where you report the same meter key for eg at Daily and at Timestep frequency
-        // the intervalMinutes will be reported by E+ for the Timestep one, so you get the wrong one for Daily...
-        // And since we can compute this easily, might as well do it
-        unsigned intervalMinutes;
-        if (reportingFrequency == ReportingFrequency::Hourly) {
-          intervalMinutes = 60;
-        } else if (reportingFrequency == ReportingFrequency::Daily) {
-          intervalMinutes = 24 * 60;
-        } else if (reportingFrequency == ReportingFrequency::Monthly) {
-          intervalMinutes = day * 24 * 60;
-        } else {
-          // If Detailed, Timestep, RunPeriod, or Annual: it varies
-          intervalMinutes = sqlite3_column_int(sqlStmtPtr, b);  // Notice I'm not incrementing the counter here on purpose
-
-          if (reportingFrequency == ReportingFrequency::Annual) {
-            // Annual actually reports blank for Month, Day, Minute **and Interval** up to 9.3.0 at least
-            // We cannot let it be zero (when blank), since it will make the firstReportDateTime creation fail below
-            // cf https://github.com/NREL/EnergyPlus/issues/7939
-            if (intervalMinutes == 0) {
-              intervalMinutes = 365 * 24 * 60;
-            } else if ((intervalMinutes != 365 * 24 * 60) && (intervalMinutes != 366 * 24 * 60)) {
-              // Issue a Debug log, but retain value. Technically Annual reports on 12/31, regardless of when the start date was
-              LOG(Debug, "For an 'Annual' frequency, intervalMinutes (= " << intervalMinutes << ") doesn't correspond to 365 or 366 days");
+          unsigned month = row.month;
+          unsigned day = row.day;
+
+          // In cases where you report the same meter key for eg at Daily and at Timestep frequency
+          // the intervalMinutes will be reported by E+ for the Timestep one, so you get the wrong one for Daily...
+          // And since we can compute this easily, might as well do it
+          unsigned intervalMinutes;
+          if (reportingFrequency == ReportingFrequency::Hourly) {
+            intervalMinutes = 60;
+          } else if (reportingFrequency == ReportingFrequency::Daily) {
+            intervalMinutes = 24 * 60;
+          } else if (reportingFrequency == ReportingFrequency::Monthly) {
+            intervalMinutes = day * 24 * 60;
+          } else {
+            // If Detailed, Timestep, RunPeriod, or Annual: it varies
+            intervalMinutes = row.intervalMinutes;
+
+            if (reportingFrequency == ReportingFrequency::Annual) {
+              // Annual actually reports blank for Month, Day, Minute **and Interval** up to 9.3.0 at least
+              // We cannot let it be zero (when blank), since it will make the firstReportDateTime creation fail below
+              // cf https://github.com/NREL/EnergyPlus/issues/7939
+              if (intervalMinutes == 0) {
+                intervalMinutes = 365 * 24 * 60;
+              } else if ((intervalMinutes != 365 * 24 * 60) && (intervalMinutes != 366 * 24 * 60)) {
+                // Issue a Debug log, but retain value. Technically Annual reports on 12/31, regardless of when the start date was
+                LOG(Debug, "For an 'Annual' frequency, intervalMinutes (= " << intervalMinutes << ") doesn't correspond to 365 or 366 days");
+              }
             }
           }
-        }
-        // Don't forget to increment the counter anyway, no matter whether we did call sqlite3_column_int or not
-        ++b;
-
-        if ((version.major() == 8) && (version.minor() == 3)) {
-          // workaround for bug in E+ 8.3, issue #1692
-          if (reportingFrequency == ReportingFrequency::RunPeriod) {
-            DateTime firstDateTime = this->firstDateTime(false, dataDictionary.envPeriodIndex);
-            DateTime lastDateTime = this->lastDateTime(false, dataDictionary.envPeriodIndex);
-            Time deltaT = lastDateTime - firstDateTime;
-            intervalMinutes = (unsigned)deltaT.totalMinutes() + 60;
+
+          if ((version.major() == 8) && (version.minor() == 3)) {
+            // workaround for bug in E+ 8.3, issue #1692
+            if (reportingFrequency == ReportingFrequency::RunPeriod) {
+              DateTime firstDateTime = this->firstDateTime(false, dataDictionary.envPeriodIndex);
+              DateTime lastDateTime = this->lastDateTime(false, dataDictionary.envPeriodIndex);
+              Time deltaT = lastDateTime - firstDateTime;
+              intervalMinutes = (unsigned)deltaT.totalMinutes() + 60;
+            }
           }
-        }
 
-        if (!firstReportDateTime) {
-          if ((month == 0) || (day == 0)) {
-            // gets called for RunPeriod reports
-            firstReportDateTime = lastDateTime(false, dataDictionary.envPeriodIndex);
-          } else {
-            // DLM: get standard time zone?
-            if (intervalMinutes >= 24 * 60) {
-              // Daily or Monthly
-              OS_ASSERT(intervalMinutes % (24 * 60) == 0);
-              firstReportDateTime = year ? openstudio::DateTime(openstudio::Date(month, day, *year), openstudio::Time(1, 0, 0, 0))
-                                         : openstudio::DateTime(openstudio::Date(month, day), openstudio::Time(1, 0, 0, 0));
+          if (!firstReportDateTime) {
+            if ((month == 0) || (day == 0)) {
+              // gets called for RunPeriod reports
+              firstReportDateTime = lastDateTime(false, dataDictionary.envPeriodIndex);
             } else {
-              firstReportDateTime = year ? openstudio::DateTime(openstudio::Date(month, day, *year), openstudio::Time(0, 0, intervalMinutes, 0))
-                                         : openstudio::DateTime(openstudio::Date(month, day), openstudio::Time(0, 0, intervalMinutes, 0));
+              // DLM: get standard time zone?
+              if (intervalMinutes >= 24 * 60) {
+                // Daily or Monthly
+                OS_ASSERT(intervalMinutes % (24 * 60) == 0);
+                firstReportDateTime = year ? openstudio::DateTime(openstudio::Date(month, day, *year), openstudio::Time(1, 0, 0, 0))
+                                           : openstudio::DateTime(openstudio::Date(month, day), openstudio::Time(1, 0, 0, 0));
+              } else {
+                firstReportDateTime = year ? openstudio::DateTime(openstudio::Date(month, day, *year), openstudio::Time(0, 0, intervalMinutes, 0))
+                                           : openstudio::DateTime(openstudio::Date(month, day), openstudio::Time(0, 0, intervalMinutes, 0));
+              }
             }
           }
-        }
 
-        // Use the new way to create the time series with nonzero first entry
-        cumulativeSeconds += 60 * intervalMinutes;
-        stdSecondsFromFirstReport.push_back(cumulativeSeconds);
+          // Use the new way to create the time series with nonzero first entry
+          cumulativeSeconds += 60 * intervalMinutes;
+          secondsFromFirstReport.push_back(cumulativeSeconds);
 
-        // check if this interval is same as the others
-        if (isIntervalTimeSeries && !reportingIntervalMinutes) {
-          reportingIntervalMinutes = intervalMinutes;
-        } else if (reportingIntervalMinutes && (reportingIntervalMinutes.get() != intervalMinutes)) {
-          isIntervalTimeSeries = false;
-          reportingIntervalMinutes.reset();
+          // check if this interval is same as the others
+          if (isIntervalTimeSeries && !reportingIntervalMinutes) {
+            reportingIntervalMinutes = intervalMinutes;
+          } else if (reportingIntervalMinutes && (reportingIntervalMinutes.get() != intervalMinutes)) {
+            isIntervalTimeSeries = false;
+            reportingIntervalMinutes.reset();
+          }
         }
 
-        // step to next row
-        code = sqlite3_step(sqlStmtPtr);
+        if (firstReportDateTime) {
+          if (reportingIntervalMinutes) {
+            openstudio::Time intervalTime(0, 0, *reportingIntervalMinutes, 0);
+            result[i] = openstudio::TimeSeries(*firstReportDateTime, intervalTime, values, dataDictionary.units);
+          } else {
+            result[i] = openstudio::TimeSeries(*firstReportDateTime, secondsFromFirstReport, values, dataDictionary.units);
+          }
+          axis.reportingTimes = result[i];
+        }
       }
+    }
 
-      // must finalize to prevent memory leaks
-      sqlite3_finalize(sqlStmtPtr);
+    // must finalize to prevent memory leaks
+    for (auto& statement : statements) {
+      sqlite3_finalize(statement.second);
+    }
 
-      if (firstReportDateTime && !stdSecondsFromFirstReport.empty()) {
-        if (isIntervalTimeSeries) {
-          openstudio::Time intervalTime(0, 0, *reportingIntervalMinutes, 0);
-          openstudio::Vector values = createVector(stdValues);
-          ts = openstudio::TimeSeries(*firstReportDateTime, intervalTime, values, units);
-        } else {
-          openstudio::Vector values = createVector(stdValues);
-          ts = openstudio::TimeSeries(*firstReportDateTime, stdSecondsFromFirstReport, values, units);
+    return result;
+  }
+
+  void SqlFile_Impl::cacheTimeSeries(const std::string& envPeriod, const std::string& reportingFrequency,
+                                     const std::vector<std::string>& timeSeriesNames) {
+    std::string queryEnvPeriod = boost::to_upper_copy(envPeriod);
+
+    std::vector<std::string> reportingFrequencies{reportingFrequency};
+    if (openstudio::OptionalReportingFrequency freq = reportingFrequencyFromDB(reportingFrequency)) {
+      if (freq->valueDescription() != reportingFrequency) {
+        reportingFrequencies.push_back(freq->valueDescription());
+      }
+    }
+
+    auto& index = m_dataDictionary.get<envPeriodReportingFrequencyNameKeyValue>();
+    std::vector<DataDictionaryTable::index<envPeriodReportingFrequencyNameKeyValue>::type::iterator> toRead;
+    for (const std::string& rf : reportingFrequencies) {
+      for (const std::string& timeSeriesName : timeSeriesNames) {
+        auto range = index.equal_range(boost::make_tuple(queryEnvPeriod, rf, timeSeriesName));
+        for (auto it = range.first; it != range.second; ++it) {
+          if (it->timeSeries.values().empty()) {
+            toRead.push_back(it);
+          }
         }
       }
     }
 
-    return ts;
+    std::vector<DataDictionaryItem> dataDictionaries;
+    dataDictionaries.reserve(toRead.size());
+    for (const auto& it : toRead) {
+      dataDictionaries.push_back(*it);
+    }
+
+    std::vector<openstudio::OptionalTimeSeries> timeSeries = this->timeSeries(dataDictionaries);
+    for (size_t i = 0; i < toRead.size(); ++i) {
+      if (timeSeries[i]) {
+        DataDictionaryItem ddi = dataDictionaries[i];
+        ddi.timeSeries = *timeSeries[i];
+        index.replace(toRead[i], ddi);
+      }
+    }
   }
 
   openstudio::DateTimeVector SqlFile_Impl::dateTimeVec(const DataDictionaryItem& dataDictionary) {
@@ -3539,6 +3287,7 @@ namespace detail {
     ReportingFrequency rf = *(wquery.reportingFrequency());
     std::string tsName = *(wquery.timeSeries().get().name());
     if (wquery.keyValues()) {
+      cacheTimeSeries(envPeriod, rf.valueDescription(), {tsName});
       for (const std::string& kvName : wquery.keyValues().get().names()) {
         OptionalTimeSeries ots = timeSeries(envPeriod, rf.valueDescription(), tsName, kvName);
         if (ots) {
@@ -21,7 +21,10 @@
 
 #include <boost/optional.hpp>
 
+#include <map>
+#include <memory>
 #include <string>
+#include <tuple>
 #include <vector>
 
 struct sqlite3;
@@ -1091,6 +1094,8 @@ namespace detail {
        *  down by ReportingFrequency and determine how many TimeSeries will be returned. */
     std::vector<TimeSeries> timeSeries(const SqlFileTimeSeriesQuery& query);
 
+    void cacheTimeSeries(const std::string& envPeriod, const std::string& reportingFrequency, const std::vector<std::string>& timeSeriesNames);
+
     // returns an optional pair of date times for begin and end of daylight savings time
     boost::optional<std::pair<openstudio::DateTime, openstudio::DateTime>> daylightSavingsPeriod() const;
 
@@ -1318,6 +1323,10 @@ namespace detail {
 
     // return a single timeseries matching recordIndex - internally used to retrieve timeseries
     boost::optional<TimeSeries> timeSeries(const DataDictionaryItem& dataDictionary);
+
+    // return the timeseries of each data dictionary item, values are read with one reused statement per table and
+    // series reporting at the same times share their time axis
+    std::vector<boost::optional<TimeSeries>> timeSeries(const std::vector<DataDictionaryItem>& dataDictionaries);
     std::vector<double> timeSeriesValues(const DataDictionaryItem& dataDictionary);
     boost::optional<Date> timeSeriesStartDate(const DataDictionaryItem& dataDictionary);
 
@@ -1334,6 +1343,37 @@ namespace detail {
 
     bool isValidConnection();
 
+    // row of the Time table, year is 0 if not reported
+    struct TimeRow
+    {
+      bool valid = false;
+      unsigned year = 0;
+      unsigned month = 0;
+      unsigned day = 0;
+      unsigned intervalMinutes = 0;
+    };
+
+    // rows of the Time table for one environment period, indexed by TimeIndex - firstTimeIndex
+    struct EnvironmentPeriodTimes
+    {
+      int firstTimeIndex = 0;
+      std::vector<TimeRow> rows;
+
+      const TimeRow* find(int timeIndex) const;
+    };
+
+    // reads the Time table of an environment period once, the result is reused until the file is reopened or written to
+    std::shared_ptr<const EnvironmentPeriodTimes> environmentPeriodTimes(int envPeriodIndex);
+
+    // values of the AnnualBuildingUtilityPerformanceSummary report for the Entire Facility, keyed by table, column, row and units
+    using AnnualBuildingUtilityPerformanceSummary = std::map<std::tuple<std::string, std::string, std::string, std::string>, double>;
+
+    // reads the whole report in a single query on first use, other SqlFiles opened on the same file, unchanged since, reuse it
+    std::shared_ptr<const AnnualBuildingUtilityPerformanceSummary> annualBuildingUtilityPerformanceSummary() const;
+
+    boost::optional<double> annualBuildingUtilityPerformanceSummaryValue(const std::string& tableName, const std::string& columnName,
+                                                                         const std::string& rowName, const std::string& units) const;
+
     void mf_makeConsistent(std::vector<SqlFileTimeSeriesQuery>& queries);
 
     openstudio::path m_path;
@@ -1350,6 +1390,10 @@ namespace detail {
 
     bool m_illuminanceMapHasOnly2RefPts;
 
+    std::map<int, std::shared_ptr<const EnvironmentPeriodTimes>> m_environmentPeriodTimes;
+
+    mutable std::shared_ptr<const AnnualBuildingUtilityPerformanceSummary> m_annualBuildingUtilityPerformanceSummary;
+
     REGISTER_LOGGER("openstudio.energyplus.SqlFile");
   };
 
@@ -28,6 +28,7 @@
 #include <algorithm>
 #include <iostream>
 #include <boost/regex.hpp>
+#include <boost/optional/optional_io.hpp>
 #include <resources.hxx>
 #include <stdexcept>
 
@@ -197,6 +198,115 @@ TEST_F(SqlFileFixture, TimeSeries) {
   EXPECT_DOUBLE_EQ(365 - 1.0 / 24.0, duration.totalDays());
 }
 
+TEST_F(SqlFileFixture, CacheTimeSeries) {
+  // a separate file so that nothing is cached yet
+  openstudio::SqlFile cached(sqlFile.path());
+
+  // values are checked against one row at a time from ReportData rather than against another bulk read
+  const std::string valuesQuery =
+    "SELECT rd.Value FROM ReportData AS rd "
+    "INNER JOIN ReportDataDictionary AS rdd ON rd.ReportDataDictionaryIndex = rdd.ReportDataDictionaryIndex "
+    "INNER JOIN Time AS t ON rd.TimeIndex = t.TimeIndex "
+    "INNER JOIN EnvironmentPeriods AS ep ON t.EnvironmentPeriodIndex = ep.EnvironmentPeriodIndex "
+    "WHERE UPPER(ep.EnvironmentName) = UPPER(?) AND rdd.ReportingFrequency = ? AND rdd.Name = ? AND IFNULL(rdd.KeyValue, '') = ? "
+    "ORDER BY rd.TimeIndex";
+
+  std::vector<std::string> availableEnvPeriods = cached.availableEnvPeriods();
+  ASSERT_FALSE(availableEnvPeriods.empty());
+
+  unsigned numChecked = 0;
+  for (const std::string& envPeriod : availableEnvPeriods) {
+    for (const std::string& reportingFrequency : cached.availableReportingFrequencies(envPeriod)) {
+      std::vector<std::string> names = cached.availableVariableNames(envPeriod, reportingFrequency);
+      cached.cacheTimeSeries(envPeriod, reportingFrequency, names);
+      for (const std::string& name : names) {
+        for (const std::string& keyValue : cached.availableKeyValues(envPeriod, reportingFrequency, name)) {
+          boost::optional<std::vector<double>> expected = cached.execAndReturnVectorOfDouble(valuesQuery, envPeriod, reportingFrequency, name, keyValue);
+          ASSERT_TRUE(expected) << name << ", " << keyValue;
+          openstudio::OptionalTimeSeries ts = cached.timeSeries(envPeriod, reportingFrequency, name, keyValue);
+          ASSERT_TRUE(ts) << name << ", " << keyValue;
+          ASSERT_EQ(expected->size(), ts->values().size()) << name << ", " << keyValue;
+          ASSERT_EQ(expected->size(), ts->secondsFromFirstReport().size()) << name << ", " << keyValue;
+          for (unsigned i = 0; i < expected->size(); ++i) {
+            EXPECT_EQ((*expected)[i], ts->values(i));
+          }
+          ++numChecked;
+        }
+      }
+    }
+  }
+  EXPECT_LT(0u, numChecked);
+
+  // and against known values of the test file
+  openstudio::OptionalTimeSeries ts = cached.timeSeries(availableEnvPeriods[0], "Hourly", "Site Outdoor Air Drybulb Temperature", "Environment");
+  ASSERT_TRUE(ts);
+  ASSERT_EQ(8760u, ts->values().size());
+  EXPECT_EQ(DateTime(Date(MonthOfYear::Jan, 1, 2013), Time(0, 1, 0, 0)), ts->firstReportDateTime());
+  EXPECT_DOUBLE_EQ(-8.2625, ts->values(0));
+  EXPECT_DOUBLE_EQ(-11.8875, ts->values(1));
+  EXPECT_DOUBLE_EQ(-4.775, ts->values(8758));
+  EXPECT_DOUBLE_EQ(-5.6875, ts->values(8759));
+  EXPECT_EQ(3600, ts->secondsFromFirstReport(1));
+  EXPECT_EQ(8759 * 3600, ts->secondsFromFirstReport(8759));
+
+  // other hourly series of the same period report at the same times, with their own values and units
+  openstudio::OptionalTimeSeries facility = cached.timeSeries(availableEnvPeriods[0], "Hourly", "Electricity:Facility", "");
+  ASSERT_TRUE(facility);
+  EXPECT_EQ(ts->firstReportDateTime(), facility->firstReportDateTime());
+  EXPECT_EQ(ts->secondsFromFirstReport(), facility->secondsFromFirstReport());
+  EXPECT_EQ("J", facility->units());
+  EXPECT_EQ("C", ts->units());
+}
+
+TEST_F(SqlFileFixture, AnnualBuildingUtilityPerformanceSummary) {
+  auto query = [](const openstudio::SqlFile& sql, const std::string& tableName, const std::string& columnName, const std::string& rowName,
+                  const std::string& units) {
+    return sql.execAndReturnFirstDouble("SELECT Value FROM TabularDataWithStrings WHERE ReportName = 'AnnualBuildingUtilityPerformanceSummary' "
+                                        "AND ReportForString = 'Entire Facility' AND TableName = ? AND ColumnName = ? AND RowName = ? AND Units = ?",
+                                        tableName, columnName, rowName, units);
+  };
+
+  for (openstudio::SqlFile* sql : {&sqlFile, &sqlFile2, &sqlFile3}) {
+    // a second file on the same path reuses the values read by the first one
+    openstudio::SqlFile reopened(sql->path());
+    for (openstudio::SqlFile* file : {sql, &reopened}) {
+      EXPECT_EQ(query(*sql, "End Uses", "Electricity", "Heating", "GJ"), file->electricityHeating());
+      EXPECT_EQ(query(*sql, "End Uses", "Electricity", "Interior Lighting", "GJ"), file->electricityInteriorLighting());
+      EXPECT_EQ(query(*sql, "End Uses", "Natural Gas", "Heating", "GJ"), file->naturalGasHeating());
+      EXPECT_EQ(query(*sql, "End Uses", "Water", "Total End Uses", "m3"), file->waterTotalEndUses());
+      EXPECT_EQ(query(*sql, "Site and Source Energy", "Total Energy", "Total Site Energy", "GJ"), file->totalSiteEnergy());
+      EXPECT_EQ(query(*sql, "Site and Source Energy", "Total Energy", "Net Source Energy", "GJ"), file->netSourceEnergy());
+    }
+  }
+}
+
+TEST_F(SqlFileFixture, DataDictionaryReopened) {
+  for (openstudio::SqlFile* sql : {&sqlFile, &sqlFile2, &sqlFile3}) {
+    // files opened again on the same path copy the dictionary read by the first one
+    std::vector<std::string> availableEnvPeriods = sql->availableEnvPeriods();
+    ASSERT_FALSE(availableEnvPeriods.empty());
+    openstudio::OptionalTimeSeries ts = sql->timeSeries(availableEnvPeriods[0], "Hourly", "Site Outdoor Air Drybulb Temperature", "Environment");
+
+    openstudio::SqlFile reopened(sql->path());
+    openstudio::SqlFile reopenedAgain(sql->path());
+    for (openstudio::SqlFile* file : {&reopened, &reopenedAgain}) {
+      EXPECT_EQ(sql->availableTimeSeries(), file->availableTimeSeries());
+      EXPECT_EQ(availableEnvPeriods, file->availableEnvPeriods());
+      for (const std::string& reportingFrequency : sql->availableReportingFrequencies(availableEnvPeriods[0])) {
+        EXPECT_EQ(sql->availableVariableNames(availableEnvPeriods[0], reportingFrequency),
+                  file->availableVariableNames(availableEnvPeriods[0], reportingFrequency));
+      }
+
+      openstudio::OptionalTimeSeries fileTs =
+        file->timeSeries(availableEnvPeriods[0], "Hourly", "Site Outdoor Air Drybulb Temperature", "Environment");
+      ASSERT_EQ(bool(ts), bool(fileTs));
+      if (ts) {
+        EXPECT_EQ(openstudio::toStandardVector(ts->values()), openstudio::toStandardVector(fileTs->values()));
+      }
+    }
+  }
+}
+
 TEST_F(SqlFileFixture, BadStatement) {
   const std::string query = "SELECT * FROM NonExistantTable;";
   try {
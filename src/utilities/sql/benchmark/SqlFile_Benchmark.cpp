@@ -0,0 +1,47 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../SqlFile.hpp"
+#include "../../data/TimeSeries.hpp"
+
+#include <resources.hxx>
+
+#include <string>
+#include <vector>
+
+using namespace openstudio;
+
+// every time series of every environment period at reportingFrequency, reading them one by one or caching them all first
+static void BM_SqlFileTimeSeries(benchmark::State& state, const std::string& reportingFrequency) {
+  const bool cache = (state.range(0) != 0);
+  const openstudio::path sqlPath = resourcesPath() / toPath("energyplus/Office_With_Many_HVAC_Types/eplusout.sql");
+
+  size_t numTimeSeries = 0;
+  for (auto _ : state) {
+    // a new file each time, so nothing is cached yet
+    SqlFile sqlFile(sqlPath);
+    numTimeSeries = 0;
+    for (const std::string& envPeriod : sqlFile.availableEnvPeriods()) {
+      std::vector<std::string> names = sqlFile.availableVariableNames(envPeriod, reportingFrequency);
+      if (cache) {
+        sqlFile.cacheTimeSeries(envPeriod, reportingFrequency, names);
+      }
+      for (const std::string& name : names) {
+        for (const std::string& keyValue : sqlFile.availableKeyValues(envPeriod, reportingFrequency, name)) {
+          boost::optional<TimeSeries> ts = sqlFile.timeSeries(envPeriod, reportingFrequency, name, keyValue);
+          benchmark::DoNotOptimize(ts);
+          ++numTimeSeries;
+        }
+      }
+    }
+  }
+
+  state.counters["timeSeries"] = benchmark::Counter(static_cast<double>(numTimeSeries), benchmark::Counter::kIsIterationInvariantRate);
+}
+
+BENCHMARK_CAPTURE(BM_SqlFileTimeSeries, Hourly, std::string("Hourly"))->ArgName("cache")->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_SqlFileTimeSeries, Timestep, std::string("Zone Timestep"))->ArgName("cache")->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);